@@ -0,0 +1,911 @@
+/*
+ * convert.c
+ *
+ * Converter of FANN .net and .test files to the headers of the firmware, in
+ * a single pass over each file (replaces strip-train-data, strip-test-data
+ * and pack-test-data):
+ *   - <name>.net: <name>.h, the network as defines and arrays, for any of
+ *     the float, fixed point (float-to-fixed) or Q15 .net files;
+ *   - <name>.test: <name>_test.h, the test vectors as floating point, Q15 and
+ *     fixed point arrays, and <name>_packed.h, all the tests packed for
+ *     utils/packed_tests.c (binary inputs and class bit-packed, other inputs
+ *     quantized to 16 bits).
+ * The straight-line code of the network is generated by gen-infer.
+ *
+ * Usage: convert <file.net>... [<file.test> [number_of_tests] [decimal_point]]...
+ *
+ * The number of tests of the arrays defaults to all the tests of the file (0
+ * as well), the decimal point of the fixed point tests to the one of
+ * <name>_trained_fixed.h. The counts of the header line of a .test file are
+ * checked against its tests. The output only depends on the input files.
+ *
+ * Build it on the host with make (database/Makefile).
+ */
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Growing output buffer. */
+struct text {
+    char *s;
+    size_t len;
+    size_t cap;
+};
+
+/* Parsed .test file. */
+struct tests {
+    unsigned int num_tests;     /* tests of the file */
+    unsigned int num_data;      /* tests converted to arrays */
+    unsigned int num_input;
+    unsigned int num_output;
+    char **in_token;            /* values as written in the file */
+    char **out_token;
+    double *in_value;
+    double *out_value;
+};
+
+static void fail(const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fputc('\n', stderr);
+    exit(1);
+}
+
+static void *xmalloc(size_t size)
+{
+    void *p = malloc(size ? size : 1);
+
+    if (!p) {
+        fail("out of memory");
+    }
+    return p;
+}
+
+static void text_append(struct text *t, const char *s, size_t len)
+{
+    if (t->len + len + 1 > t->cap) {
+        t->cap = 2 * (t->len + len + 1) + 4096;
+        t->s = realloc(t->s, t->cap);
+        if (!t->s) {
+            fail("out of memory");
+        }
+    }
+    memcpy(t->s + t->len, s, len);
+    t->len += len;
+    t->s[t->len] = '\0';
+}
+
+static void text_printf(struct text *t, const char *format, ...)
+{
+    char buffer[512];
+    va_list args;
+    int len;
+
+    va_start(args, format);
+    len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0 || (size_t) len >= sizeof(buffer)) {
+        fail("line too long");
+    }
+    text_append(t, buffer, len);
+}
+
+static char *read_file(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    char *data;
+    long size;
+
+    if (!f) {
+        fail("%s: no such file", path);
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = xmalloc(size + 1);
+    if (fread(data, 1, size, f) != (size_t) size) {
+        fail("%s: read error", path);
+    }
+    data[size] = '\0';
+    fclose(f);
+    return data;
+}
+
+static void write_file(const char *path, const struct text *t)
+{
+    FILE *f = fopen(path, "wb");
+
+    if (!f || fwrite(t->s, 1, t->len, f) != t->len || fclose(f)) {
+        fail("%s: write error", path);
+    }
+}
+
+/* Path without extension, with a suffix. */
+static char *base_name(const char *path, const char *suffix)
+{
+    const char *dot = strrchr(path, '.');
+    size_t len = dot ? (size_t) (dot - path) : strlen(path);
+    char *name = xmalloc(len + strlen(suffix) + 1);
+
+    memcpy(name, path, len);
+    strcpy(name + len, suffix);
+    return name;
+}
+
+/* Include guard of a header: __<NAME>__. */
+static void print_guard(struct text *t, const char *name)
+{
+    text_printf(t, "__");
+    for (; *name; name++) {
+        text_printf(t, "%c", toupper((unsigned char) *name));
+    }
+    text_printf(t, "__");
+}
+
+/* Define followed by each value of a list, numbered from 1. */
+static void print_list(struct text *t, const char *prefix, const char *values)
+{
+    char name[64];
+    const char *p = values;
+    int idx = 1, len;
+
+    for (;;) {
+        while (isspace((unsigned char) *p)) {
+            p++;
+        }
+        if (!*p) {
+            break;
+        }
+        for (len = 0; p[len] && !isspace((unsigned char) p[len]); len++)
+            ;
+        snprintf(name, sizeof(name), "%s_%d", prefix, idx++);
+        text_printf(t, "#define %-36s %.*s\n", name, len, p);
+        p += len;
+    }
+}
+
+/* Split a line into whitespace-separated tokens, in place. */
+static unsigned int split(char *line, char **tokens, unsigned int max)
+{
+    unsigned int count = 0;
+
+    for (;;) {
+        while (isspace((unsigned char) *line)) {
+            line++;
+        }
+        if (!*line) {
+            return count;
+        }
+        if (count < max) {
+            tokens[count] = line;
+        }
+        count++;
+        while (*line && !isspace((unsigned char) *line)) {
+            line++;
+        }
+        if (*line) {
+            *line++ = '\0';
+        }
+    }
+}
+
+/* Fields of a "(a, b) (c, d)" list, split in a copy (freed by the caller). */
+static unsigned int split_tuples(const char *values, char **copy, char ***fields)
+{
+    size_t len = strlen(values);
+    char *p;
+
+    *copy = xmalloc(len + 1);
+    *fields = xmalloc((len / 2 + 1) * sizeof(char *));
+    for (p = strcpy(*copy, values); *p; p++) {
+        if (*p == '(' || *p == ')' || *p == ',') {
+            *p = ' ';
+        }
+    }
+    return split(*copy, *fields, len / 2 + 1);
+}
+
+/*
+ * Neuron descriptors as typed arrays: the number of inputs (uint8_t, or
+ * uint16_t above 255), the activation function (uint8_t) and the steepness
+ * (fann_type), so that fann_create_msp430 does no float conversion.
+ */
+static void print_neurons(struct text *t, const char *path, const char *neurons)
+{
+    char *copy, **fields;
+    unsigned int num_neurons, n, max_inputs = 0;
+
+    num_neurons = split_tuples(neurons, &copy, &fields);
+    if (num_neurons % 3) {
+        fail("%s: malformed neurons", path);
+    }
+    num_neurons /= 3;
+    for (n = 0; n < num_neurons; n++) {
+        if ((unsigned int) atoi(fields[3 * n]) > max_inputs) {
+            max_inputs = (unsigned int) atoi(fields[3 * n]);
+        }
+    }
+
+    text_printf(t, "\n#pragma DATA_SECTION(neuron_inputs, \".fann_weights\") // Place data in FRAM\n");
+    text_printf(t, "const %s neuron_inputs[%u] = {", (max_inputs > 255) ? "uint16_t" : "uint8_t", num_neurons);
+    for (n = 0; n < num_neurons; n++) {
+        text_printf(t, "%s%s", (n % 16) ? ", " : (n ? ",\n    " : "\n    "), fields[3 * n]);
+    }
+    text_printf(t, "\n};\n\n");
+
+    text_printf(t, "#pragma DATA_SECTION(neuron_activations, \".fann_weights\") // Place data in FRAM\n");
+    text_printf(t, "const uint8_t neuron_activations[%u] = {", num_neurons);
+    for (n = 0; n < num_neurons; n++) {
+        text_printf(t, "%s%s", (n % 16) ? ", " : (n ? ",\n    " : "\n    "), fields[3 * n + 1]);
+    }
+    text_printf(t, "\n};\n\n");
+
+    text_printf(t, "#pragma DATA_SECTION(neuron_steepnesses, \".fann_weights\") // Place data in FRAM\n");
+    text_printf(t, "const fann_type neuron_steepnesses[%u] = {\n", num_neurons);
+    for (n = 0; n < num_neurons; n++) {
+        text_printf(t, "    %s%s\n", fields[3 * n + 2], (n < num_neurons - 1) ? "," : "");
+    }
+    text_printf(t, "};\n\n");
+
+    free(fields);
+    free(copy);
+}
+
+/*
+ * Weights of the connections, read in place by fann_create_msp430. In a
+ * floating point network the steepness of each neuron is folded into its
+ * weights, in single precision as fann_mult(steepness, weight) on the
+ * target. Sparse networks also get the column index of each connection.
+ */
+static void print_connections(struct text *t, const char *path, const char *neurons,
+                              const char *connections, int fold, int sparse)
+{
+    char *neuron_copy, *connection_copy, **neuron_fields, **connection_fields;
+    unsigned int num_neurons, num_connections, n, c, last;
+    float steepness, weight;
+
+    num_neurons = split_tuples(neurons, &neuron_copy, &neuron_fields);
+    num_connections = split_tuples(connections, &connection_copy, &connection_fields);
+    if (num_neurons % 3 || num_connections % 2) {
+        fail("%s: malformed neurons or connections", path);
+    }
+    num_neurons /= 3;
+    num_connections /= 2;
+
+    text_printf(t, "#pragma DATA_SECTION(connection_weights, \".fann_weights\") // Place data in FRAM\n");
+    text_printf(t, "const fann_type connection_weights[%u] = {\n", num_connections);
+    for (n = 0, c = 0; n < num_neurons; n++) {
+        steepness = strtof(neuron_fields[3 * n + 2], NULL);
+        last = c + (unsigned int) atoi(neuron_fields[3 * n]);
+        if (last > num_connections) {
+            fail("%s: the neurons have more than %u connections", path, num_connections);
+        }
+        for (; c < last; c++) {
+            if (fold) {
+                weight = steepness * strtof(connection_fields[2 * c + 1], NULL);
+                text_printf(t, "    %.8e", weight);
+            } else {
+                text_printf(t, "    %s", connection_fields[2 * c + 1]);
+            }
+            text_printf(t, (c < num_connections - 1) ? ",\n" : "\n");
+        }
+    }
+    if (c != num_connections) {
+        fail("%s: %u connections, the neurons have %u", path, num_connections, c);
+    }
+    text_printf(t, "};\n\n");
+
+    text_printf(t, "#define %-36s %d\n\n", "COLUMNS_INCLUDED", sparse);
+    if (sparse) {
+        text_printf(t, "#pragma DATA_SECTION(connection_columns, \".fann_weights\") // Place data in FRAM\n");
+        text_printf(t, "const fann_index_type connection_columns[%u] = {\n", num_connections);
+        for (c = 0; c < num_connections; c++) {
+            text_printf(t, "    %s%s\n", connection_fields[2 * c], (c < num_connections - 1) ? "," : "");
+        }
+        text_printf(t, "};\n\n");
+    }
+
+    free(neuron_fields);
+    free(connection_fields);
+    free(neuron_copy);
+    free(connection_copy);
+}
+
+/*
+ * .net file: every "key=value" line becomes a define, the lists are numbered,
+ * the neurons and connections become the typed arrays of print_neurons and
+ * print_connections.
+ */
+static void convert_net(const char *path)
+{
+    char *data = read_file(path);
+    char *header_name = base_name(path, "");
+    char *header_file = base_name(path, ".h");
+    struct text out = { 0, 0, 0 };
+    char *line, *end, *value, *last, *neurons = NULL, name[128];
+    int fold = 0, sparse = 0;
+    size_t i, len;
+
+    text_printf(&out, "#ifndef ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n#define ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n\n\n");
+
+    for (line = data; *line; line = end) {
+        end = line + strcspn(line, "\n");
+        if (*end) {
+            *end++ = '\0';
+        }
+        value = strchr(line, '=');
+        value = value ? value + 1 : line;
+
+        if (strncmp(line, "connection_rate=", 16) == 0) {
+            sparse = strtod(value, NULL) < 1;
+        }
+
+        if (strstr(line, "FANN")) {
+            /* version */
+            fold = strstr(line, "FANN_FLO") != NULL;
+            text_printf(&out, "// %s\n\n", line);
+        } else if (strstr(line, "cascade_activation_functions=")) {
+            print_list(&out, "CASCADE_ACTIVATION_FUNCTION", value);
+        } else if (strstr(line, "cascade_activation_steepnesses=")) {
+            print_list(&out, "CASCADE_ACTIVATION_STEEPNESS", value);
+        } else if (strstr(line, "weight_decimal_points=")) {
+            print_list(&out, "WEIGHT_DECIMAL_POINT", value);
+        } else if (strstr(line, "layer_sizes=")) {
+            print_list(&out, "LAYER_SIZE", value);
+        } else if (strstr(line, "neurons")) {
+            print_neurons(&out, path, value);
+            neurons = value;
+        } else if (strstr(line, "connections")) {
+            if (neurons == NULL) {
+                fail("%s: connections before the neurons", path);
+            }
+            print_connections(&out, path, neurons, value, fold, sparse);
+        } else {
+            /* name up to the last '=', value after the first one */
+            last = strrchr(line, '=');
+            len = last ? (size_t) (last - line) : strlen(line);
+            if (len >= sizeof(name)) {
+                fail("%s: name too long: %s", path, line);
+            }
+            for (i = 0; i < len; i++) {
+                name[i] = toupper((unsigned char) line[i]);
+            }
+            name[len] = '\0';
+            text_printf(&out, "#define %-36s ", name);
+            text_append(&out, value, strlen(value));
+            text_printf(&out, "\n");
+        }
+    }
+
+    text_printf(&out, "\n#endif // ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n");
+
+    write_file(header_file, &out);
+
+    free(out.s);
+    free(header_file);
+    free(header_name);
+    free(data);
+}
+
+/* Values of a line of a .test file: exactly count of them. */
+static void read_values(const char *path, char *text, unsigned int line, unsigned int count,
+                        char **tokens, double *values)
+{
+    unsigned int k, found = split(text, tokens, count);
+
+    if (found != count) {
+        fail("%s:%u: %u values instead of %u", path, line, found, count);
+    }
+    for (k = 0; k < count; k++) {
+        values[k] = strtod(tokens[k], NULL);
+    }
+}
+
+static void read_tests(const char *path, unsigned int num_data, struct tests *tests)
+{
+    char *data = read_file(path);
+    char **lines;
+    unsigned int num_lines = 0, num_tests, t;
+    char *p;
+
+    /* lines, without the blank ones at the end */
+    lines = xmalloc(sizeof(char *) * (strlen(data) + 1));
+    for (p = data; *p; ) {
+        lines[num_lines++] = p;
+        p += strcspn(p, "\n");
+        if (*p) {
+            *p++ = '\0';
+        }
+    }
+    while (num_lines > 0 && lines[num_lines - 1][strspn(lines[num_lines - 1], " \t\r")] == '\0') {
+        num_lines--;
+    }
+
+    if (num_lines == 0 ||
+        sscanf(lines[0], "%u %u %u", &num_tests, &tests->num_input, &tests->num_output) != 3) {
+        fail("%s:1: expected \"<number_of_tests> <number_of_inputs> <number_of_outputs>\"", path);
+    }
+    if (num_lines - 1 != 2 * num_tests) {
+        fail("%s: %u lines of tests instead of %u (%u tests)", path, num_lines - 1, 2 * num_tests, num_tests);
+    }
+    if (num_data == 0) {
+        num_data = num_tests;
+    } else if (num_data > num_tests) {
+        fail("%s: %u tests requested, %u in the file", path, num_data, num_tests);
+    }
+    tests->num_tests = num_tests;
+    tests->num_data = num_data;
+    tests->in_token = xmalloc(sizeof(char *) * num_tests * tests->num_input);
+    tests->out_token = xmalloc(sizeof(char *) * num_tests * tests->num_output);
+    tests->in_value = xmalloc(sizeof(double) * num_tests * tests->num_input);
+    tests->out_value = xmalloc(sizeof(double) * num_tests * tests->num_output);
+
+    /* all the tests are checked, even the ones not converted */
+    for (t = 0; t < num_tests; t++) {
+        read_values(path, lines[1 + 2 * t], 2 + 2 * t, tests->num_input,
+                    tests->in_token + t * tests->num_input, tests->in_value + t * tests->num_input);
+        read_values(path, lines[2 + 2 * t], 3 + 2 * t, tests->num_output,
+                    tests->out_token + t * tests->num_output, tests->out_value + t * tests->num_output);
+    }
+    free(lines);
+}
+
+static long fix(double x, double multiplier, int saturate)
+{
+    long r = (long) (x * multiplier + (x < 0 ? -0.5 : 0.5));
+
+    if (saturate) {
+        if (r > 32767) {
+            r = 32767;
+        } else if (r < -32768) {
+            r = -32768;
+        }
+    }
+    return r;
+}
+
+/* Array of test vectors, as written in the file (multiplier 0) or fixed point. */
+static void print_vectors(struct text *t, const char *name, unsigned int num_data, unsigned int width,
+                          char **tokens, const double *values, double multiplier, int saturate)
+{
+    unsigned int i, k;
+
+    text_printf(t, "#pragma PERSISTENT(%s) // Place data in FRAM\n", name);
+    text_printf(t, "fann_type %s [%u][%u] = {\n", name, num_data, width);
+    for (i = 0; i < num_data; i++) {
+        for (k = 0; k < width; k++) {
+            text_printf(t, k ? ", " : "    {");
+            if (multiplier) {
+                text_printf(t, "%ld", fix(values[i * width + k], multiplier, saturate));
+            } else {
+                text_append(t, tokens[i * width + k], strlen(tokens[i * width + k]));
+            }
+        }
+        text_printf(t, (i < num_data - 1) ? "},\n" : "}\n");
+    }
+    text_printf(t, "};\n\n");
+}
+
+static void print_fixed_tests(struct text *t, const struct tests *tests, int dp, int saturate)
+{
+    double multiplier = (double) (1L << dp);
+
+    text_printf(t, "#define TEST_DECIMAL_POINT %d\n\n", dp);
+    print_vectors(t, "input", tests->num_data, tests->num_input,
+                  tests->in_token, tests->in_value, multiplier, saturate);
+    print_vectors(t, "output", tests->num_data, tests->num_output,
+                  tests->out_token, tests->out_value, multiplier, saturate);
+}
+
+/* <name>_test.h: test vectors in FRAM, for each number format. */
+static void write_test_header(const char *path, const struct tests *tests, int dp)
+{
+    char *header_name = base_name(path, "_test");
+    char *header_file = base_name(path, "_test.h");
+    const char *count_type = (tests->num_data > 255) ? "uint16_t" : "uint8_t";
+    struct text out = { 0, 0, 0 };
+
+    text_printf(&out, "#ifndef ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n#define ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n\n#include <stdint.h>\n\n\n");
+    text_printf(&out, "%s num_data = %u;\n", count_type, tests->num_data);
+    text_printf(&out, "uint8_t num_input = %u;\n", tests->num_input);
+    text_printf(&out, "uint8_t num_output = %u;\n\n", tests->num_output);
+
+    text_printf(&out, "#ifndef FIXEDFANN\n\n");
+    print_vectors(&out, "input", tests->num_data, tests->num_input,
+                  tests->in_token, tests->in_value, 0, 0);
+    print_vectors(&out, "output", tests->num_data, tests->num_output,
+                  tests->out_token, tests->out_value, 0, 0);
+
+    /* Q15 (16 bits, saturated) */
+    text_printf(&out, "#elif defined(FANN_Q15)\n\n");
+    print_fixed_tests(&out, tests, 15, 1);
+
+    /* fixed point (long) */
+    text_printf(&out, "#else\n\n");
+    if (dp < 0) {
+        text_printf(&out, "#error \"No fixed point test data, run convert with a decimal point\"\n\n");
+    } else {
+        print_fixed_tests(&out, tests, dp, 0);
+    }
+    text_printf(&out, "#endif // FIXEDFANN\n");
+
+    text_printf(&out, "\n#endif // ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n");
+
+    write_file(header_file, &out);
+
+    free(out.s);
+    free(header_file);
+    free(header_name);
+}
+
+/* Layout of the packed records. */
+struct packing {
+    unsigned int num_binary;
+    unsigned int num_continuous;
+    int *column;                /* per input: bit, or -1 - index of a quantized input */
+    unsigned int *continuous;   /* per quantized input: input */
+    double *minimum;
+    double *maximum;
+    unsigned int *class;        /* per test */
+    double low, high;
+    unsigned int class_bit, class_mask, flag_words, record_words;
+};
+
+/* Number as awk prints it: integers in full, other values with 6 digits. */
+static void print_number(struct text *t, double x)
+{
+    if (x == (double) (long) x) {
+        text_printf(t, "%ld", (long) x);
+    } else {
+        text_printf(t, "%.6g", x);
+    }
+}
+
+/* Minimums, scales and descriptor of one number format (multiplier 0: floating point). */
+static void print_packed_tables(struct text *t, const char *name, const struct tests *tests,
+                                const struct packing *pk, double multiplier, int saturate)
+{
+    unsigned int count = pk->num_continuous ? pk->num_continuous : 1;
+    unsigned int f;
+    long s;
+
+    text_printf(t, "const fann_type %s_packed_minimum[%u] = {", name, count);
+    for (f = 0; f < pk->num_continuous; f++) {
+        if (multiplier) {
+            text_printf(t, "%s%ld", f ? ", " : "", fix(pk->minimum[f], multiplier, saturate));
+        } else {
+            text_printf(t, "%s%.9e", f ? ", " : "", pk->minimum[f]);
+        }
+    }
+    text_printf(t, pk->num_continuous ? "};\n" : "0};\n");
+    text_printf(t, "const fann_type %s_packed_scale[%u] = {", name, count);
+    for (f = 0; f < pk->num_continuous; f++) {
+        if (multiplier) {
+            s = fix(pk->maximum[f] - pk->minimum[f], multiplier, saturate);
+            if (s > 65535) {
+                fail("range of input %u too large for the decimal point", pk->continuous[f]);
+            }
+            text_printf(t, "%s%ld", f ? ", " : "", s);
+        } else {
+            text_printf(t, "%s%.9e", f ? ", " : "", (pk->maximum[f] - pk->minimum[f]) / 65535);
+        }
+    }
+    text_printf(t, pk->num_continuous ? "};\n\n" : "0};\n\n");
+
+    text_printf(t, "struct packed_tests %s_tests = {\n", name);
+    text_printf(t, "    0, %u, %u, %u, %u, %u, %u, %u,\n", tests->num_data, tests->num_input,
+                tests->num_output, pk->record_words, pk->flag_words, pk->class_bit, pk->class_mask);
+    text_printf(t, "    %s_packed_columns, %s_packed_minimum, %s_packed_scale,\n", name, name, name);
+    if (multiplier) {
+        text_printf(t, "    %ld, %ld, %ld\n", fix(1, multiplier, saturate),
+                    fix(pk->low, multiplier, saturate), fix(pk->high, multiplier, saturate));
+    } else {
+        text_printf(t, "    1, ");
+        print_number(t, pk->low);
+        text_printf(t, ", ");
+        print_number(t, pk->high);
+        text_printf(t, "\n");
+    }
+    text_printf(t, "};\n\n");
+}
+
+static void layout_packed(const struct tests *tests, struct packing *pk)
+{
+    unsigned int num_data = tests->num_data, num_input = tests->num_input, num_output = tests->num_output;
+    unsigned int t, k, f, class_bits;
+    double v;
+    int binary;
+
+    pk->column = xmalloc(sizeof(int) * num_input);
+    pk->continuous = xmalloc(sizeof(unsigned int) * num_input);
+    pk->minimum = xmalloc(sizeof(double) * num_input);
+    pk->maximum = xmalloc(sizeof(double) * num_input);
+    pk->class = xmalloc(sizeof(unsigned int) * num_data);
+
+    /* binary and continuous inputs */
+    pk->num_binary = 0;
+    pk->num_continuous = 0;
+    for (k = 0; k < num_input; k++) {
+        binary = 1;
+        for (t = 0; t < num_data; t++) {
+            v = tests->in_value[t * num_input + k];
+            if (v != 0 && v != 1) {
+                binary = 0;
+                break;
+            }
+        }
+        if (binary) {
+            pk->column[k] = pk->num_binary++;
+        } else {
+            f = pk->num_continuous++;
+            pk->continuous[f] = k;
+            pk->column[k] = -1 - (int) f;
+            pk->minimum[f] = pk->maximum[f] = tests->in_value[k];
+            for (t = 1; t < num_data; t++) {
+                v = tests->in_value[t * num_input + k];
+                if (v < pk->minimum[f]) {
+                    pk->minimum[f] = v;
+                }
+                if (v > pk->maximum[f]) {
+                    pk->maximum[f] = v;
+                }
+            }
+        }
+    }
+
+    /* one-hot outputs: low and high values, class of each test */
+    pk->low = pk->high = tests->out_value[0];
+    for (t = 0; t < num_data * num_output; t++) {
+        if (tests->out_value[t] < pk->low) {
+            pk->low = tests->out_value[t];
+        }
+        if (tests->out_value[t] > pk->high) {
+            pk->high = tests->out_value[t];
+        }
+    }
+    for (t = 0; t < num_data; t++) {
+        int class = -1;
+
+        for (k = 0; k < num_output; k++) {
+            v = tests->out_value[t * num_output + k];
+            if (v == pk->high) {
+                class = (class == -1) ? (int) k : -2;
+            } else if (v != pk->low) {
+                class = -2;
+            }
+            if (class == -2) {
+                break;
+            }
+        }
+        if (class < 0) {
+            fail("test %u: the outputs are not one-hot", t + 1);
+        }
+        pk->class[t] = class;
+    }
+
+    /* the class follows the binary inputs, without crossing a word */
+    for (class_bits = 1; (1u << class_bits) < num_output; class_bits++)
+        ;
+    pk->class_mask = (1u << class_bits) - 1;
+    pk->class_bit = pk->num_binary;
+    if (pk->class_bit / 16 != (pk->class_bit + class_bits - 1) / 16) {
+        pk->class_bit = (pk->class_bit / 16 + 1) * 16;
+    }
+    pk->flag_words = (pk->class_bit + class_bits + 15) / 16;
+    pk->record_words = pk->flag_words + pk->num_continuous;
+}
+
+/* <name>_packed.h: packed test set in FRAM2, see utils/packed_tests.h. */
+static void write_packed_header(const char *path, const struct tests *tests, int dp)
+{
+    char *header_name = base_name(path, "_packed");
+    char *header_file = base_name(path, "_packed.h");
+    const char *file_name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    char *name = base_name(file_name, "");
+    char *upper_name = base_name(file_name, "");
+    unsigned int num_data = tests->num_data, num_input = tests->num_input;
+    unsigned int t, k, w, f, q, word[16];
+    struct packing pk;
+    struct text out = { 0, 0, 0 };
+    char *c;
+
+    layout_packed(tests, &pk);
+    if (pk.flag_words > 16) {
+        fail("%s: too many binary inputs", path);
+    }
+
+    text_printf(&out, "#ifndef ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n#define ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n\n#include <stdint.h>\n\n#include \"packed_tests.h\"\n\n\n");
+    text_printf(&out, "/* %u tests, %u bytes each: %u binary inputs and the class in %u words, */\n",
+                num_data, 2 * pk.record_words, pk.num_binary, pk.flag_words);
+    text_printf(&out, "/* %u inputs quantized to 16 bits. */\n", pk.num_continuous);
+    for (c = upper_name; *c; c++) {
+        *c = toupper((unsigned char) *c);
+    }
+    text_printf(&out, "#define %s_PACKED_NUM_DATA %u\n", upper_name, num_data);
+    text_printf(&out, "#define %s_PACKED_NUM_INPUT %u\n", upper_name, num_input);
+    text_printf(&out, "#define %s_PACKED_NUM_OUTPUT %u\n\n", upper_name, tests->num_output);
+
+    text_printf(&out, "uint16_t num_data = %u;\n", num_data);
+    text_printf(&out, "uint8_t num_input = %u;\n", num_input);
+    text_printf(&out, "uint8_t num_output = %u;\n\n", tests->num_output);
+
+    text_printf(&out, "#pragma DATA_SECTION(%s_packed_records, \".tests\") // Place data in FRAM2\n", name);
+    text_printf(&out, "const uint16_t %s_packed_records[%u] = {\n", name, num_data * pk.record_words);
+    for (t = 0; t < num_data; t++) {
+        memset(word, 0, sizeof(word));
+        for (k = 0; k < num_input; k++) {
+            if (pk.column[k] >= 0 && tests->in_value[t * num_input + k] == 1) {
+                word[pk.column[k] / 16] += 1u << (pk.column[k] % 16);
+            }
+        }
+        word[pk.class_bit / 16] += pk.class[t] << (pk.class_bit % 16);
+        text_printf(&out, "    %u", word[0]);
+        for (w = 1; w < pk.flag_words; w++) {
+            text_printf(&out, ", %u", word[w]);
+        }
+        for (f = 0; f < pk.num_continuous; f++) {
+            if (pk.maximum[f] > pk.minimum[f]) {
+                q = (unsigned int) ((tests->in_value[t * num_input + pk.continuous[f]] - pk.minimum[f]) /
+                                    (pk.maximum[f] - pk.minimum[f]) * 65535 + 0.5);
+            } else {
+                q = 0;
+            }
+            text_printf(&out, ", %u", q);
+        }
+        text_printf(&out, (t < num_data - 1) ? ",\n" : "\n");
+    }
+    text_printf(&out, "};\n\n");
+
+    text_printf(&out, "/* bit of each binary input, -1 - index of each quantized input */\n");
+    text_printf(&out, "const int16_t %s_packed_columns[%u] = {", name, num_input);
+    for (k = 0; k < num_input; k++) {
+        text_printf(&out, "%s%d", k ? ", " : "", pk.column[k]);
+    }
+    text_printf(&out, "};\n\n");
+
+    text_printf(&out, "#ifndef FIXEDFANN\n\n");
+    print_packed_tables(&out, name, tests, &pk, 0, 0);
+    text_printf(&out, "#elif defined(FANN_Q15)\n\n");
+    text_printf(&out, "#define TEST_DECIMAL_POINT 15\n\n");
+    print_packed_tables(&out, name, tests, &pk, 32768, 1);
+    text_printf(&out, "#else\n\n");
+    if (dp < 0) {
+        text_printf(&out, "#error \"No fixed point test data, run convert with a decimal point\"\n\n");
+    } else {
+        text_printf(&out, "#define TEST_DECIMAL_POINT %d\n\n", dp);
+        print_packed_tables(&out, name, tests, &pk, (double) (1L << dp), 0);
+    }
+    text_printf(&out, "#endif // FIXEDFANN\n\n");
+
+    text_printf(&out, "#endif // ");
+    print_guard(&out, header_name);
+    text_printf(&out, "\n");
+
+    write_file(header_file, &out);
+
+    free(out.s);
+    free(pk.column);
+    free(pk.continuous);
+    free(pk.minimum);
+    free(pk.maximum);
+    free(pk.class);
+    free(upper_name);
+    free(name);
+    free(header_file);
+    free(header_name);
+}
+
+/* Decimal point of the fixed point network <name>_trained_fixed.h, -1 if none. */
+static int default_decimal_point(const char *path)
+{
+    char *fixed_file = base_name(path, "_trained_fixed.h");
+    FILE *f = fopen(fixed_file, "r");
+    char line[256], name[64];
+    int dp = -1, value;
+
+    if (f) {
+        while (fgets(line, sizeof(line), f)) {
+            if (sscanf(line, "#define %63s %d", name, &value) == 2 && !strcmp(name, "DECIMAL_POINT")) {
+                dp = value;
+                break;
+            }
+        }
+        fclose(f);
+    }
+    free(fixed_file);
+    return dp;
+}
+
+static void convert_test(const char *path, unsigned int num_data, int dp)
+{
+    struct tests tests;
+
+    read_tests(path, num_data, &tests);
+    if (dp < 0) {
+        dp = default_decimal_point(path);
+    }
+    if (dp > 30) {
+        fail("decimal point %d too large", dp);
+    }
+    write_test_header(path, &tests, dp);
+    /* all the tests fit in FRAM2 when packed */
+    tests.num_data = tests.num_tests;
+    write_packed_header(path, &tests, dp);
+}
+
+static int has_extension(const char *path, const char *extension)
+{
+    size_t len = strlen(path), elen = strlen(extension);
+
+    return len > elen && !strcmp(path + len - elen, extension);
+}
+
+static int is_number(const char *s)
+{
+    if (!*s) {
+        return 0;
+    }
+    for (; *s; s++) {
+        if (!isdigit((unsigned char) *s)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int num_data;
+    const char *path;
+    int i, dp;
+
+    if (argc < 2) {
+        fprintf(stderr, "Missing input file! Usage:\n"
+                "%s <file.net>... [<file.test> [number_of_tests] [decimal_point]]...\n", argv[0]);
+        return 1;
+    }
+
+    for (i = 1; i < argc; i++) {
+        if (has_extension(argv[i], ".net")) {
+            convert_net(argv[i]);
+        } else if (has_extension(argv[i], ".test")) {
+            path = argv[i];
+            num_data = 0;
+            dp = -1;
+            if (i + 1 < argc && is_number(argv[i + 1])) {
+                num_data = atoi(argv[++i]);
+                if (i + 1 < argc && is_number(argv[i + 1])) {
+                    dp = atoi(argv[++i]);
+                }
+            }
+            convert_test(path, num_data, dp);
+        } else {
+            fail("%s: not a .net or .test file", argv[i]);
+        }
+    }
+
+    return 0;
+}
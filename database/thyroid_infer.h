@@ -0,0 +1,538 @@
+#ifndef __THYROID_INFER__
+#define __THYROID_INFER__
+
+/*
+ * Straight-line inference function generated by gen-infer, one flavour per
+ * network: weights are immediate constants, no struct fann is involved.
+ */
+
+#include "fann.h"
+
+#if !defined(FIXEDFANN)
+
+/* Floating point, generated from thyroid_trained.net */
+
+#define THYROID_NUM_INPUT                    21
+#define THYROID_NUM_OUTPUT                   3
+#define THYROID_MULTIPLIER                   1
+#define THYROID_OUTPUT_SYMMETRIC             0
+
+static void thyroid_infer(const fann_type in[21], fann_type out[3])
+{
+    fann_type l2[5];
+    fann_sum_type sum;
+
+    /* layer 2: 5 neurons, activation 4, steepness 5.00000000000000000000e-01 */
+    sum = 1.80704677e+00f * in[0]
+        - 7.48860717e-01f * in[1]
+        - 1.91387272e+00f * in[2]
+        + 4.24051613e-01f * in[3]
+        + 4.99437046e+00f * in[4]
+        - 1.53383225e-01f * in[5]
+        + 1.40092647e+00f * in[6]
+        - 3.20110941e+00f * in[7]
+        - 2.82713264e-01f * in[8]
+        + 6.92393124e-01f * in[9]
+        - 7.24546553e-04f * in[10]
+        + 8.29365611e-01f * in[11]
+        + 1.36203969e+00f * in[12]
+        + 1.74610659e-01f * in[13]
+        + 2.58809417e-01f * in[14]
+        + 6.79947138e-01f * in[15]
+        - 2.61315247e+02f * in[16]
+        + 2.40025654e+01f * in[17]
+        + 7.34438992e+00f * in[18]
+        + 3.80151081e+00f * in[19]
+        + 2.48054647e+00f * in[20]
+        - 1.42801833e+00f;
+    l2[0] = fann_sigmoid_stepwise_real(sum);
+    sum = -2.13987350e+00f * in[0]
+        - 7.30148196e-01f * in[1]
+        + 4.25153065e+00f * in[2]
+        - 7.81058729e-01f * in[3]
+        - 1.16193438e+00f * in[4]
+        - 1.06622732e+00f * in[5]
+        + 7.76764154e-01f * in[6]
+        + 5.86801243e+00f * in[7]
+        - 4.07636499e+00f * in[8]
+        - 8.33430111e-01f * in[9]
+        + 2.17335773e+00f * in[10]
+        - 5.61780453e+00f * in[11]
+        + 9.21104193e-01f * in[12]
+        - 9.84272361e-01f * in[13]
+        + 1.95831552e-01f * in[14]
+        - 3.68902653e-01f * in[15]
+        - 2.07059814e+02f * in[16]
+        + 1.47279453e+01f * in[17]
+        + 7.81866074e+00f * in[18]
+        + 1.38453360e+01f * in[19]
+        + 2.91275358e+00f * in[20]
+        - 3.59865546e-01f;
+    l2[1] = fann_sigmoid_stepwise_real(sum);
+    sum = 5.22149992e+00f * in[0]
+        + 8.39167118e+00f * in[1]
+        + 1.73513947e+01f * in[2]
+        + 3.03654718e+00f * in[3]
+        - 3.53087568e+00f * in[4]
+        + 2.50030041e+00f * in[5]
+        + 6.34308815e-01f * in[6]
+        - 7.29063463e+00f * in[7]
+        + 2.32250094e+00f * in[8]
+        - 3.84322381e+00f * in[9]
+        - 5.36510897e+00f * in[10]
+        + 5.28955364e+00f * in[11]
+        + 9.86408532e-01f * in[12]
+        + 4.51735783e+00f * in[13]
+        + 1.72344863e-01f * in[14]
+        + 7.10959959e+00f * in[15]
+        - 5.97624550e+01f * in[16]
+        + 4.84008646e+00f * in[17]
+        - 7.03933954e+00f * in[18]
+        - 3.65562034e+00f * in[19]
+        - 2.32551858e-01f * in[20]
+        - 5.88854647e+00f;
+    l2[2] = fann_sigmoid_stepwise_real(sum);
+    sum = 6.93114221e-01f * in[0]
+        + 7.83797562e-01f * in[1]
+        + 2.70361156e+01f * in[2]
+        - 4.65040535e-01f * in[3]
+        - 2.33562851e+00f * in[4]
+        + 1.91488838e+00f * in[5]
+        + 1.27542973e+00f * in[6]
+        + 3.41309128e+01f * in[7]
+        + 1.21196318e+01f * in[8]
+        - 2.41700448e-02f * in[9]
+        - 7.35338449e+00f * in[10]
+        + 4.41504192e+00f * in[11]
+        + 1.06752717e+00f * in[12]
+        + 6.70902058e-02f * in[13]
+        + 6.81623369e-02f * in[14]
+        + 6.18837297e-01f * in[15]
+        - 2.18934265e+02f * in[16]
+        + 1.80720196e+01f * in[17]
+        - 2.16701908e+01f * in[18]
+        - 1.67877350e+01f * in[19]
+        + 8.71159649e+00f * in[20]
+        + 3.02866507e+00f;
+    l2[3] = fann_sigmoid_stepwise_real(sum);
+    sum = -3.00255746e-01f * in[0]
+        + 1.83196336e-01f * in[1]
+        - 1.35274577e+00f * in[2]
+        + 1.07756603e+00f * in[3]
+        + 3.20794725e+00f * in[4]
+        - 4.85601664e-01f * in[5]
+        + 9.40083414e-02f * in[6]
+        - 1.75679541e+00f * in[7]
+        - 1.24631691e+00f * in[8]
+        + 1.07939291e+00f * in[9]
+        + 4.33938533e-01f * in[10]
+        + 7.86406946e+00f * in[11]
+        + 9.54017818e-01f * in[12]
+        - 9.05515909e-01f * in[13]
+        - 5.77457398e-02f * in[14]
+        + 1.69703178e+01f * in[15]
+        - 3.90921116e+00f * in[16]
+        + 3.49799309e+01f * in[17]
+        + 7.02143326e+01f * in[18]
+        - 1.71621494e+01f * in[19]
+        + 8.40449753e+01f * in[20]
+        - 8.48918819e+00f;
+    l2[4] = fann_sigmoid_stepwise_real(sum);
+
+    /* layer 3: 3 neurons, activation 4, steepness 5.00000000000000000000e-01 */
+    sum = -3.39457417e+00f * l2[0]
+        - 2.98730397e+00f * l2[1]
+        + 5.66771775e-02f * l2[2]
+        - 1.44509518e+00f * l2[3]
+        - 4.00198936e+00f * l2[4]
+        + 2.03013515e+00f;
+    out[0] = fann_sigmoid_stepwise_real(sum);
+    sum = -3.04338288e+00f * l2[0]
+        - 2.93320227e+00f * l2[1]
+        - 1.12706006e+00f * l2[2]
+        - 2.91778398e+00f * l2[3]
+        + 6.25999308e+00f * l2[4]
+        - 2.31198692e+00f;
+    out[1] = fann_sigmoid_stepwise_real(sum);
+    sum = 3.27958536e+00f * l2[0]
+        + 2.97028971e+00f * l2[1]
+        + 1.07357693e+00f * l2[2]
+        + 3.05739737e+00f * l2[3]
+        - 3.12593341e-01f * l2[4]
+        - 3.45614934e+00f;
+    out[2] = fann_sigmoid_stepwise_real(sum);
+}
+
+#elif defined(FIXEDFANN) && !defined(FANN_Q15)
+
+/* Fixed point, generated from thyroid_trained_fixed.net */
+
+#define THYROID_NUM_INPUT                    21
+#define THYROID_NUM_OUTPUT                   3
+#define THYROID_MULTIPLIER                   1024
+#define THYROID_OUTPUT_SYMMETRIC             0
+
+static const fann_type thyroid_sigmoid_results[6] = {5, 51, 256, 768, 973, 1019};
+static const fann_type thyroid_sigmoid_symmetric_results[6] = {-1014, -922, -512, 512, 922, 1013};
+static const fann_type thyroid_gaussian_results[6] = {1024, 973, 768, 256, 51, 5};
+
+/* Stepwise linear function, breakpoints v and results r */
+static fann_type thyroid_stepwise(const fann_type *v, const fann_type *r,
+                                 fann_type min, fann_type max, fann_sum_type sum)
+{
+    unsigned int i;
+
+    if (sum < v[0])
+        return min;
+    if (sum >= v[5])
+        return max;
+
+    for (i = 1; sum >= v[i]; i++);
+
+    return (fann_type) (r[i - 1] + ((fann_sum_type) (r[i] - r[i - 1]) * (sum - v[i - 1])) /
+                                   ((fann_sum_type) v[i] - v[i - 1]));
+}
+
+static const fann_type thyroid_layer2_breakpoints[6] = {-5444, -3019, -1124, 1124, 3019, 5444};
+static const fann_type thyroid_layer3_breakpoints[6] = {-5444, -3019, -1124, 1124, 3019, 5444};
+
+static void thyroid_infer(const fann_type in[21], fann_type out[3])
+{
+    fann_type l2[5];
+    fann_sum_type sum;
+
+    /* layer 2: 5 neurons, activation 4, steepness 512 */
+    sum = ((3701 * in[0]) >> 10)
+        + ((-1534 * in[1]) >> 10)
+        + ((-3920 * in[2]) >> 10)
+        + ((868 * in[3]) >> 10)
+        + ((10228 * in[4]) >> 10)
+        + ((-314 * in[5]) >> 10)
+        + ((2869 * in[6]) >> 10)
+        + ((-6556 * in[7]) >> 10)
+        + ((-579 * in[8]) >> 10)
+        + ((1418 * in[9]) >> 10)
+        + ((-1 * in[10]) >> 10)
+        + ((1699 * in[11]) >> 10)
+        + ((2789 * in[12]) >> 10)
+        + ((358 * in[13]) >> 10)
+        + ((530 * in[14]) >> 10)
+        + ((1393 * in[15]) >> 10)
+        + ((-535174 * in[16]) >> 10)
+        + ((49157 * in[17]) >> 10)
+        + ((15041 * in[18]) >> 10)
+        + ((7785 * in[19]) >> 10)
+        + ((5080 * in[20]) >> 10)
+        + -2925;
+    l2[0] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 1024, sum);
+    sum = ((-4382 * in[0]) >> 10)
+        + ((-1495 * in[1]) >> 10)
+        + ((8707 * in[2]) >> 10)
+        + ((-1600 * in[3]) >> 10)
+        + ((-2380 * in[4]) >> 10)
+        + ((-2184 * in[5]) >> 10)
+        + ((1591 * in[6]) >> 10)
+        + ((12018 * in[7]) >> 10)
+        + ((-8348 * in[8]) >> 10)
+        + ((-1707 * in[9]) >> 10)
+        + ((4451 * in[10]) >> 10)
+        + ((-11505 * in[11]) >> 10)
+        + ((1886 * in[12]) >> 10)
+        + ((-2016 * in[13]) >> 10)
+        + ((401 * in[14]) >> 10)
+        + ((-756 * in[15]) >> 10)
+        + ((-424059 * in[16]) >> 10)
+        + ((30163 * in[17]) >> 10)
+        + ((16013 * in[18]) >> 10)
+        + ((28355 * in[19]) >> 10)
+        + ((5965 * in[20]) >> 10)
+        + -737;
+    l2[1] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 1024, sum);
+    sum = ((10694 * in[0]) >> 10)
+        + ((17186 * in[1]) >> 10)
+        + ((35536 * in[2]) >> 10)
+        + ((6219 * in[3]) >> 10)
+        + ((-7231 * in[4]) >> 10)
+        + ((5121 * in[5]) >> 10)
+        + ((1299 * in[6]) >> 10)
+        + ((-14931 * in[7]) >> 10)
+        + ((4756 * in[8]) >> 10)
+        + ((-7871 * in[9]) >> 10)
+        + ((-10988 * in[10]) >> 10)
+        + ((10833 * in[11]) >> 10)
+        + ((2020 * in[12]) >> 10)
+        + ((9252 * in[13]) >> 10)
+        + ((353 * in[14]) >> 10)
+        + ((14560 * in[15]) >> 10)
+        + ((-122394 * in[16]) >> 10)
+        + ((9912 * in[17]) >> 10)
+        + ((-14417 * in[18]) >> 10)
+        + ((-7487 * in[19]) >> 10)
+        + ((-476 * in[20]) >> 10)
+        + -12060;
+    l2[2] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 1024, sum);
+    sum = ((1419 * in[0]) >> 10)
+        + ((1605 * in[1]) >> 10)
+        + ((55370 * in[2]) >> 10)
+        + ((-952 * in[3]) >> 10)
+        + ((-4783 * in[4]) >> 10)
+        + ((3922 * in[5]) >> 10)
+        + ((2612 * in[6]) >> 10)
+        + ((69900 * in[7]) >> 10)
+        + ((24821 * in[8]) >> 10)
+        + ((-50 * in[9]) >> 10)
+        + ((-15060 * in[10]) >> 10)
+        + ((9042 * in[11]) >> 10)
+        + ((2186 * in[12]) >> 10)
+        + ((137 * in[13]) >> 10)
+        + ((140 * in[14]) >> 10)
+        + ((1267 * in[15]) >> 10)
+        + ((-448377 * in[16]) >> 10)
+        + ((37011 * in[17]) >> 10)
+        + ((-44381 * in[18]) >> 10)
+        + ((-34381 * in[19]) >> 10)
+        + ((17841 * in[20]) >> 10)
+        + 6203;
+    l2[3] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 1024, sum);
+    sum = ((-615 * in[0]) >> 10)
+        + ((375 * in[1]) >> 10)
+        + ((-2770 * in[2]) >> 10)
+        + ((2207 * in[3]) >> 10)
+        + ((6570 * in[4]) >> 10)
+        + ((-995 * in[5]) >> 10)
+        + ((193 * in[6]) >> 10)
+        + ((-3598 * in[7]) >> 10)
+        + ((-2552 * in[8]) >> 10)
+        + ((2211 * in[9]) >> 10)
+        + ((889 * in[10]) >> 10)
+        + ((16106 * in[11]) >> 10)
+        + ((1954 * in[12]) >> 10)
+        + ((-1854 * in[13]) >> 10)
+        + ((-118 * in[14]) >> 10)
+        + ((34755 * in[15]) >> 10)
+        + ((-8006 * in[16]) >> 10)
+        + ((71639 * in[17]) >> 10)
+        + ((143799 * in[18]) >> 10)
+        + ((-35148 * in[19]) >> 10)
+        + ((172124 * in[20]) >> 10)
+        + -17386;
+    l2[4] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 1024, sum);
+
+    /* layer 3: 3 neurons, activation 4, steepness 512 */
+    sum = ((-6952 * l2[0]) >> 10)
+        + ((-6118 * l2[1]) >> 10)
+        + ((116 * l2[2]) >> 10)
+        + ((-2960 * l2[3]) >> 10)
+        + ((-8196 * l2[4]) >> 10)
+        + 4158;
+    out[0] = thyroid_stepwise(thyroid_layer3_breakpoints, thyroid_sigmoid_results, 0, 1024, sum);
+    sum = ((-6233 * l2[0]) >> 10)
+        + ((-6007 * l2[1]) >> 10)
+        + ((-2308 * l2[2]) >> 10)
+        + ((-5976 * l2[3]) >> 10)
+        + ((12820 * l2[4]) >> 10)
+        + -4735;
+    out[1] = thyroid_stepwise(thyroid_layer3_breakpoints, thyroid_sigmoid_results, 0, 1024, sum);
+    sum = ((6717 * l2[0]) >> 10)
+        + ((6083 * l2[1]) >> 10)
+        + ((2199 * l2[2]) >> 10)
+        + ((6262 * l2[3]) >> 10)
+        + ((-640 * l2[4]) >> 10)
+        + -7078;
+    out[2] = thyroid_stepwise(thyroid_layer3_breakpoints, thyroid_sigmoid_results, 0, 1024, sum);
+}
+
+#elif defined(FANN_Q15)
+
+/* Q15, generated from thyroid_trained_q15.net */
+
+#define THYROID_NUM_INPUT                    21
+#define THYROID_NUM_OUTPUT                   3
+#define THYROID_MULTIPLIER                   32767
+#define THYROID_OUTPUT_SYMMETRIC             0
+
+static const fann_type thyroid_sigmoid_results[6] = {164, 1638, 8192, 24575, 31129, 32603};
+static const fann_type thyroid_sigmoid_symmetric_results[6] = {-32439, -29490, -16384, 16383, 29490, 32439};
+static const fann_type thyroid_gaussian_results[6] = {32767, 31129, 24575, 8192, 1638, 164};
+
+/* Stepwise linear function, breakpoints v and results r */
+static fann_type thyroid_stepwise(const fann_type *v, const fann_type *r,
+                                 fann_type min, fann_type max, fann_sum_type sum)
+{
+    unsigned int i;
+
+    if (sum < v[0])
+        return min;
+    if (sum >= v[5])
+        return max;
+
+    for (i = 1; sum >= v[i]; i++);
+
+    return (fann_type) (r[i - 1] + ((fann_sum_type) (r[i] - r[i - 1]) * (sum - v[i - 1])) /
+                                   ((fann_sum_type) v[i] - v[i - 1]));
+}
+
+static const fann_type thyroid_layer2_breakpoints[6] = {-1354, -752, -280, 280, 752, 1354};
+static const fann_type thyroid_layer3_breakpoints[6] = {-1354, -752, -280, 280, 752, 1354};
+
+static void thyroid_infer(const fann_type in[21], fann_type out[3])
+{
+    fann_type l2[5];
+    fann_sum_type sum;
+
+    /* layer 2: 5 neurons, activation 4, steepness 128 */
+    sum = (int32_t) 116 * in[0]
+        + (int32_t) -48 * in[1]
+        + (int32_t) -122 * in[2]
+        + (int32_t) 27 * in[3]
+        + (int32_t) 320 * in[4]
+        + (int32_t) -10 * in[5]
+        + (int32_t) 90 * in[6]
+        + (int32_t) -205 * in[7]
+        + (int32_t) -18 * in[8]
+        + (int32_t) 44 * in[9]
+        + (int32_t) 0 * in[10]
+        + (int32_t) 53 * in[11]
+        + (int32_t) 87 * in[12]
+        + (int32_t) 11 * in[13]
+        + (int32_t) 17 * in[14]
+        + (int32_t) 44 * in[15]
+        + (int32_t) -16724 * in[16]
+        + (int32_t) 1536 * in[17]
+        + (int32_t) 470 * in[18]
+        + (int32_t) 243 * in[19]
+        + (int32_t) 159 * in[20]
+        + -2981797L;
+    sum = fann_clip(sum >> 12, INT16_MIN, INT16_MAX);
+    l2[0] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 32767, sum);
+    sum = (int32_t) -137 * in[0]
+        + (int32_t) -47 * in[1]
+        + (int32_t) 272 * in[2]
+        + (int32_t) -50 * in[3]
+        + (int32_t) -74 * in[4]
+        + (int32_t) -68 * in[5]
+        + (int32_t) 50 * in[6]
+        + (int32_t) 376 * in[7]
+        + (int32_t) -261 * in[8]
+        + (int32_t) -53 * in[9]
+        + (int32_t) 139 * in[10]
+        + (int32_t) -360 * in[11]
+        + (int32_t) 59 * in[12]
+        + (int32_t) -63 * in[13]
+        + (int32_t) 13 * in[14]
+        + (int32_t) -24 * in[15]
+        + (int32_t) -13252 * in[16]
+        + (int32_t) 943 * in[17]
+        + (int32_t) 500 * in[18]
+        + (int32_t) 886 * in[19]
+        + (int32_t) 186 * in[20]
+        + -753641L;
+    sum = fann_clip(sum >> 12, INT16_MIN, INT16_MAX);
+    l2[1] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 32767, sum);
+    sum = (int32_t) 334 * in[0]
+        + (int32_t) 537 * in[1]
+        + (int32_t) 1110 * in[2]
+        + (int32_t) 194 * in[3]
+        + (int32_t) -226 * in[4]
+        + (int32_t) 160 * in[5]
+        + (int32_t) 41 * in[6]
+        + (int32_t) -467 * in[7]
+        + (int32_t) 149 * in[8]
+        + (int32_t) -246 * in[9]
+        + (int32_t) -343 * in[10]
+        + (int32_t) 339 * in[11]
+        + (int32_t) 63 * in[12]
+        + (int32_t) 289 * in[13]
+        + (int32_t) 11 * in[14]
+        + (int32_t) 455 * in[15]
+        + (int32_t) -3825 * in[16]
+        + (int32_t) 310 * in[17]
+        + (int32_t) -451 * in[18]
+        + (int32_t) -234 * in[19]
+        + (int32_t) -15 * in[20]
+        + -12353159L;
+    sum = fann_clip(sum >> 12, INT16_MIN, INT16_MAX);
+    l2[2] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 32767, sum);
+    sum = (int32_t) 44 * in[0]
+        + (int32_t) 50 * in[1]
+        + (int32_t) 1730 * in[2]
+        + (int32_t) -30 * in[3]
+        + (int32_t) -149 * in[4]
+        + (int32_t) 123 * in[5]
+        + (int32_t) 82 * in[6]
+        + (int32_t) 2184 * in[7]
+        + (int32_t) 776 * in[8]
+        + (int32_t) -2 * in[9]
+        + (int32_t) -471 * in[10]
+        + (int32_t) 283 * in[11]
+        + (int32_t) 68 * in[12]
+        + (int32_t) 4 * in[13]
+        + (int32_t) 4 * in[14]
+        + (int32_t) 40 * in[15]
+        + (int32_t) -14012 * in[16]
+        + (int32_t) 1157 * in[17]
+        + (int32_t) -1387 * in[18]
+        + (int32_t) -1074 * in[19]
+        + (int32_t) 558 * in[20]
+        + 6356798L;
+    sum = fann_clip(sum >> 12, INT16_MIN, INT16_MAX);
+    l2[3] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 32767, sum);
+    sum = (int32_t) -19 * in[0]
+        + (int32_t) 12 * in[1]
+        + (int32_t) -87 * in[2]
+        + (int32_t) 69 * in[3]
+        + (int32_t) 205 * in[4]
+        + (int32_t) -31 * in[5]
+        + (int32_t) 6 * in[6]
+        + (int32_t) -112 * in[7]
+        + (int32_t) -80 * in[8]
+        + (int32_t) 69 * in[9]
+        + (int32_t) 28 * in[10]
+        + (int32_t) 503 * in[11]
+        + (int32_t) 61 * in[12]
+        + (int32_t) -58 * in[13]
+        + (int32_t) -4 * in[14]
+        + (int32_t) 1086 * in[15]
+        + (int32_t) -250 * in[16]
+        + (int32_t) 2239 * in[17]
+        + (int32_t) 4494 * in[18]
+        + (int32_t) -1098 * in[19]
+        + (int32_t) 5379 * in[20]
+        + -17792481L;
+    sum = fann_clip(sum >> 12, INT16_MIN, INT16_MAX);
+    l2[4] = thyroid_stepwise(thyroid_layer2_breakpoints, thyroid_sigmoid_results, 0, 32767, sum);
+
+    /* layer 3: 3 neurons, activation 4, steepness 128 */
+    sum = (int32_t) -6952 * l2[0]
+        + (int32_t) -6118 * l2[1]
+        + (int32_t) 116 * l2[2]
+        + (int32_t) -2960 * l2[3]
+        + (int32_t) -8196 * l2[4]
+        + 136245186L;
+    sum = fann_clip(sum >> 17, INT16_MIN, INT16_MAX);
+    out[0] = thyroid_stepwise(thyroid_layer3_breakpoints, thyroid_sigmoid_results, 0, 32767, sum);
+    sum = (int32_t) -6233 * l2[0]
+        + (int32_t) -6007 * l2[1]
+        + (int32_t) -2308 * l2[2]
+        + (int32_t) -5976 * l2[3]
+        + (int32_t) 12820 * l2[4]
+        + -155151745L;
+    sum = fann_clip(sum >> 17, INT16_MIN, INT16_MAX);
+    out[1] = thyroid_stepwise(thyroid_layer3_breakpoints, thyroid_sigmoid_results, 0, 32767, sum);
+    sum = (int32_t) 6717 * l2[0]
+        + (int32_t) 6083 * l2[1]
+        + (int32_t) 2199 * l2[2]
+        + (int32_t) 6262 * l2[3]
+        + (int32_t) -640 * l2[4]
+        + -231924826L;
+    sum = fann_clip(sum >> 17, INT16_MIN, INT16_MAX);
+    out[2] = thyroid_stepwise(thyroid_layer3_breakpoints, thyroid_sigmoid_results, 0, 32767, sum);
+}
+
+#else
+
+#error "thyroid_infer.h was not generated for this flavour, run gen-infer with its network"
+
+#endif
+
+#endif // __THYROID_INFER__
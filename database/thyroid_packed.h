@@ -0,0 +1,3665 @@
+#ifndef __THYROID_PACKED__
+#define __THYROID_PACKED__
+
+#include <stdint.h>
+
+#include "packed_tests.h"
+
+
+/* 3600 tests, 16 bytes each: 15 binary inputs and the class in 2 words, */
+/* 6 inputs quantized to 16 bits. */
+#define THYROID_PACKED_NUM_DATA 3600
+#define THYROID_PACKED_NUM_INPUT 21
+#define THYROID_PACKED_NUM_OUTPUT 3
+
+uint16_t num_data = 3600;
+uint8_t num_input = 21;
+uint8_t num_output = 3;
+
+#pragma DATA_SECTION(thyroid_packed_records, ".tests") // Place data in FRAM2
+const uint16_t thyroid_packed_records[28800] = {
+    0, 2, 49500, 4, 33634, 29016, 25894, 25705,
+    1, 2, 49500, 131, 10749, 18735, 21419, 19190,
+    258, 2, 43922, 73, 12136, 13365, 16304, 16524,
+    0, 2, 37648, 315, 15604, 15513, 23976, 14600,
+    0, 2, 11155, 380, 16991, 16434, 20140, 17561,
+    0, 2, 31373, 288, 16297, 17354, 16624, 21115,
+    1, 2, 35556, 380, 13592, 20730, 30690, 16080,
+    16, 2, 34859, 96, 13592, 16434, 18222, 18745,
+    512, 2, 23704, 197, 14910, 14592, 27493, 12379,
+    4112, 2, 16732, 13, 11443, 13672, 19501, 14896,
+    0, 2, 32070, 406, 16297, 13825, 26214, 12230,
+    386, 2, 45317, 615, 8669, 21804, 21738, 21961,
+    5, 2, 26493, 304, 13592, 17661, 13746, 24224,
+    0, 1, 38345, 1966, 14078, 19963, 22058, 19930,
+    0, 2, 24401, 419, 13523, 15973, 17902, 18449,
+    1, 2, 23704, 60, 13939, 11370, 12468, 16672,
+    0, 2, 19521, 92, 14078, 16434, 21419, 16821,
+    0, 2, 17430, 210, 14078, 21037, 24296, 19190,
+    0, 2, 59958, 446, 9362, 16587, 31329, 12675,
+    0, 1, 48105, 813, 12136, 18582, 26534, 16228,
+    0, 2, 40436, 5, 16991, 24259, 17583, 28518,
+    0, 2, 15338, 210, 9362, 11217, 17583, 13119,
+    0, 2, 26493, 170, 7975, 8455, 17902, 9713,
+    1, 2, 16035, 121, 16991, 14746, 22058, 14748,
+    16384, 2, 36951, 111, 8669, 15206, 20140, 16376,
+    0, 2, 51591, 642, 12830, 18275, 21419, 18745,
+    4096, 2, 40436, 7, 24619, 13979, 23657, 13267,
+    1, 2, 21613, 406, 15604, 11217, 18542, 12675,
+    512, 2, 22310, 248, 15604, 16434, 23337, 15784,
+    0, 2, 25796, 105, 13592, 13518, 24296, 12675,
+    16384, 2, 39739, 354, 9362, 17968, 18222, 20522,
+    1, 2, 26493, 183, 19765, 14439, 23976, 13563,
+    0, 0, 57866, 4456, 4508, 7534, 26534, 6604,
+    1, 2, 38345, 157, 10749, 17815, 24296, 16376,
+    0, 2, 13944, 248, 13939, 16615, 22697, 16239,
+    0, 2, 23007, 197, 13592, 16938, 21738, 17081,
+    0, 2, 46711, 157, 16297, 16587, 20140, 17709,
+    0, 2, 36253, 3, 13592, 16938, 21738, 17081,
+    0, 2, 44620, 262, 5895, 16741, 21099, 17265,
+    0, 2, 27190, 273, 13592, 11984, 15984, 15044,
+    4, 2, 49500, 248, 13939, 17047, 26534, 14748,
+    0, 2, 19521, 367, 12136, 14746, 22697, 14420,
+    321, 2, 26493, 472, 13939, 13672, 25894, 12082,
+    0, 2, 31373, 315, 15604, 14746, 24296, 13119,
+    1, 2, 20218, 248, 13939, 16615, 22697, 16239,
+    0, 2, 48105, 262, 14910, 19963, 21419, 20374,
+    0, 2, 57169, 157, 10749, 14899, 19501, 16228,
+    2, 2, 36951, 20, 13592, 19042, 19501, 20818,
+    0, 2, 38345, 4, 44037, 28862, 22058, 28814,
+    0, 2, 27190, 144, 13592, 20883, 21738, 21039,
+    1, 2, 20218, 328, 9362, 11370, 13427, 15932,
+    2, 2, 43922, 223, 13592, 17815, 23337, 17265,
+    0, 2, 47408, 301, 13592, 16587, 33247, 12082,
+    2, 2, 55077, 603, 12136, 17968, 24296, 16821,
+    4096, 2, 43922, 62, 16297, 13672, 14066, 18597,
+    0, 0, 23007, 10748, 1040, 445, 23976, 471,
+    0, 2, 20218, 157, 13592, 16894, 26853, 14600,
+    1, 2, 39739, 26, 14078, 15820, 21099, 16376,
+    17, 1, 42528, 1573, 10056, 15666, 18542, 17709,
+    512, 2, 44620, 42, 18378, 14285, 35804, 9861,
+    0, 2, 14641, 248, 13939, 16615, 22697, 16239,
+    8, 2, 32070, 249, 11443, 16280, 19501, 17857,
+    0, 2, 36253, 43, 2427, 12291, 8312, 22447,
+    0, 2, 17430, 273, 14910, 14132, 23017, 13711,
+    1, 2, 26493, 273, 13592, 24413, 29091, 19782,
+    2, 2, 33465, 122, 13939, 10910, 18861, 12230,
+    1, 2, 49500, 708, 6588, 11063, 17263, 13267,
+    513, 2, 43225, 380, 13592, 12137, 12468, 17709,
+    0, 2, 61352, 433, 14910, 15666, 21099, 16228,
+    512, 2, 23007, 31, 18378, 17508, 25575, 15636,
+    256, 2, 11852, 144, 13939, 22111, 21419, 22447,
+    546, 2, 20915, 58, 10056, 11063, 20460, 11638,
+    4096, 2, 46014, 170, 15604, 14439, 25894, 12675,
+    0, 2, 9761, 92, 12136, 12444, 22378, 12379,
+    4096, 2, 39042, 8, 28711, 35614, 26214, 31331,
+    1, 2, 27887, 236, 19071, 8762, 21419, 8973,
+    7, 2, 35556, 248, 13939, 14746, 20460, 15488,
+    1, 2, 51591, 183, 5895, 13979, 14705, 18449,
+    1, 2, 36951, 3, 13592, 12598, 18222, 14451,
+    512, 2, 23704, 1, 12830, 20423, 25255, 18449,
+    0, 2, 48105, 131, 13592, 18428, 18222, 21115,
+    0, 1, 41831, 1022, 11443, 10603, 20779, 11046,
+    2, 2, 48803, 223, 15604, 23185, 27493, 19634,
+    1, 2, 47408, 236, 15604, 16127, 23976, 15192,
+    0, 0, 697, 878, 6311, 4734, 23976, 4455,
+    0, 2, 24401, 170, 25312, 27788, 48592, 14748,
+    0, 2, 31373, 341, 13592, 15053, 24296, 14007,
+    0, 2, 14641, 315, 21152, 16434, 17263, 19486,
+    1, 2, 40436, 7, 13523, 17661, 20460, 18745,
+    0, 2, 35556, 288, 17684, 15820, 22058, 15784,
+    0, 2, 18824, 105, 26006, 29169, 52748, 14451,
+    17, 2, 21613, 26, 11443, 12598, 17902, 14600,
+    17, 2, 46711, 144, 12136, 13211, 17583, 15192,
+    512, 2, 23007, 157, 20458, 14132, 33886, 10157,
+    0, 2, 39739, 248, 13939, 16615, 22697, 16239,
+    0, 2, 11852, 157, 16297, 10910, 28132, 8973,
+    0, 2, 9063, 537, 20458, 17047, 23017, 16524,
+    512, 2, 45317, 45, 13939, 14132, 22697, 13711,
+    0, 2, 25796, 122, 13592, 15973, 24296, 14600,
+    256, 2, 16035, 183, 15604, 10756, 25894, 9565,
+    0, 2, 22310, 301, 13592, 11370, 17583, 13415,
+    0, 2, 23704, 26, 14078, 17354, 24296, 15784,
+    16384, 2, 37648, 341, 12830, 17201, 23657, 16524,
+    0, 2, 13246, 248, 13939, 18428, 24296, 17117,
+    0, 2, 13246, 406, 14910, 15053, 24296, 13711,
+    256, 0, 41831, 14287, 8669, 6306, 22378, 6308,
+    1, 2, 40436, 170, 13592, 12291, 16943, 14896,
+    0, 2, 16732, 197, 13592, 23492, 34526, 16672,
+    0, 0, 49500, 2752, 6311, 8762, 28132, 7196,
+    128, 2, 27887, 39, 15604, 16587, 17583, 19486,
+    0, 2, 23007, 102, 13592, 27021, 16943, 32368,
+    0, 2, 33465, 288, 15604, 13672, 22697, 13376,
+    2, 2, 16035, 8651, 6588, 16741, 23337, 15932,
+    1, 2, 52986, 170, 3121, 7841, 18542, 8825,
+    0, 2, 59260, 642, 10056, 10756, 21738, 10879,
+    512, 2, 44620, 170, 22538, 19502, 29731, 15488,
+    2048, 2, 25796, 115, 10749, 16127, 18222, 18449,
+    0, 2, 48105, 341, 13592, 14439, 26853, 12527,
+    1, 2, 36253, 236, 16297, 15513, 16943, 18597,
+    512, 1, 48803, 1296, 12136, 13211, 22697, 12971,
+    0, 2, 32768, 26, 12136, 15513, 26534, 13563,
+    1, 2, 29979, 304, 13592, 19656, 21099, 20078,
+    1, 2, 39042, 210, 10056, 13825, 22058, 13711,
+    256, 2, 49500, 144, 14078, 15513, 20140, 16524,
+    0, 2, 23007, 33, 10749, 15973, 24296, 14748,
+    0, 2, 16732, 273, 13592, 20423, 39001, 12971,
+    0, 2, 46014, 367, 12136, 21497, 20140, 22891,
+    1, 2, 15338, 183, 13523, 23492, 28132, 19486,
+    1, 2, 19521, 118, 18378, 23492, 31009, 18153,
+    128, 2, 50197, 170, 11443, 8608, 18861, 9713,
+    0, 1, 43225, 1075, 14078, 11830, 23657, 11194,
+    0, 2, 20915, 304, 13592, 16938, 21738, 17081,
+    0, 2, 48105, 0, 17684, 24106, 19181, 26297,
+    0, 2, 15338, 524, 18378, 19809, 35485, 13859,
+    0, 2, 54380, 419, 10056, 23952, 28132, 19782,
+    0, 2, 29979, 111, 11443, 11984, 21738, 12082,
+    0, 2, 18127, 66, 8669, 16127, 16304, 19930,
+    0, 2, 19521, 170, 19071, 21651, 28132, 17857,
+    1, 2, 23007, 446, 13592, 15666, 23337, 15044,
+    16385, 2, 51591, 273, 23232, 20270, 24296, 18745,
+    0, 2, 43225, 393, 13592, 15053, 21738, 15192,
+    0, 2, 48105, 81, 16991, 16587, 31009, 12675,
+    0, 2, 15338, 304, 13592, 15206, 21738, 15340,
+    256, 2, 15338, 249, 13592, 25180, 26534, 21855,
+    512, 2, 13944, 248, 25312, 24413, 38042, 15932,
+    0, 0, 43225, 16515, 8669, 5539, 25575, 5123,
+    0, 2, 37648, 380, 10056, 13058, 21099, 13563,
+    16384, 2, 29979, 236, 12830, 17661, 25255, 15932,
+    16385, 2, 35556, 197, 13592, 14592, 19181, 16080,
+    0, 2, 38345, 67, 7975, 11217, 14705, 14748,
+    0, 2, 31373, 249, 13523, 15820, 23337, 15044,
+    16, 2, 50894, 130, 12830, 18121, 25894, 16080,
+    1, 2, 25796, 13, 10056, 15820, 16304, 19486,
+    0, 2, 38345, 16, 13592, 21037, 20460, 22151,
+    1, 2, 42528, 113, 12830, 11523, 18222, 13119,
+    0, 2, 51591, 64, 7975, 13058, 11189, 20374,
+    256, 2, 697, 17826, 13592, 7687, 15664, 9861,
+    0, 2, 12549, 304, 14910, 16938, 21738, 17081,
+    16, 2, 53683, 92, 10749, 15206, 30370, 11934,
+    1, 2, 50894, 354, 11443, 17201, 26534, 15044,
+    0, 2, 13246, 13, 12830, 13979, 20140, 14748,
+    0, 2, 50894, 170, 13592, 12751, 23337, 12230,
+    65, 2, 17430, 73, 14078, 20577, 20140, 22003,
+    0, 2, 27887, 472, 15604, 17047, 22697, 16659,
+    1, 2, 52986, 511, 13523, 15666, 24296, 14451,
+    0, 2, 24401, 315, 21152, 19963, 39960, 12527,
+    1, 2, 54380, 485, 6588, 11984, 17263, 14303,
+    3, 2, 41134, 248, 13939, 16615, 22697, 16239,
+    1, 2, 18127, 183, 12830, 13211, 18222, 15192,
+    0, 2, 37648, 682, 16991, 13979, 22378, 13859,
+    3, 2, 41831, 288, 12136, 12291, 13746, 16969,
+    17, 2, 30676, 273, 13939, 13825, 28132, 11490,
+    1, 2, 41134, 304, 13592, 13979, 25894, 12379,
+    1, 2, 32768, 183, 13592, 13979, 16304, 17265,
+    1, 2, 41831, 288, 13592, 13979, 18542, 15784,
+    0, 2, 38345, 273, 11443, 18582, 26534, 16228,
+    1, 2, 59260, 273, 14910, 11063, 17263, 13267,
+    512, 2, 50894, 25, 12830, 16280, 22058, 16228,
+    512, 2, 40436, 248, 14078, 14592, 19820, 15636,
+    258, 2, 50197, 341, 10749, 13211, 21099, 13711,
+    0, 2, 37648, 157, 13592, 9222, 19501, 10157,
+    2048, 2, 13246, 26, 20458, 20270, 32288, 15192,
+    0, 2, 45317, 41, 13523, 18428, 27812, 15488,
+    0, 2, 57866, 393, 9362, 15360, 26214, 13563,
+    0, 2, 48803, 773, 12136, 16938, 21738, 11342,
+    2, 2, 52289, 472, 3121, 8301, 22697, 8151,
+    5, 2, 47408, 380, 13592, 12751, 15025, 16672,
+    0, 2, 36253, 8, 12830, 20270, 23657, 19190,
+    258, 2, 39739, 419, 14078, 11063, 24296, 10306,
+    0, 2, 14641, 223, 14910, 13825, 25575, 12527,
+    0, 2, 17430, 248, 13939, 16615, 22697, 16239,
+    2, 2, 42528, 9, 13523, 31624, 21738, 31924,
+    1, 2, 57169, 104, 8669, 16127, 15345, 20522,
+    0, 1, 39739, 3670, 11443, 12751, 23657, 12082,
+    256, 0, 23704, 4063, 17684, 6613, 23017, 6456,
+    1, 2, 42528, 144, 11443, 15666, 23657, 14896,
+    16385, 2, 41134, 118, 6588, 21190, 23657, 20078,
+    128, 2, 41134, 1573, 21152, 13825, 21738, 13958,
+    16, 2, 38345, 315, 13592, 9836, 13746, 13563,
+    1, 2, 18824, 131, 21152, 15973, 24296, 14896,
+    4096, 0, 18824, 4587, 15604, 6000, 23337, 5715,
+    256, 2, 41831, 144, 9362, 16434, 22697, 16062,
+    0, 2, 24401, 26, 18378, 17968, 22058, 17857,
+    0, 2, 20915, 183, 13592, 16894, 28132, 13859,
+    0, 2, 57169, 642, 7975, 7994, 14705, 10602,
+    0, 2, 39042, 39, 7282, 14899, 11509, 22743,
+    128, 2, 43922, 288, 15604, 16894, 13107, 23928,
+    768, 2, 26493, 262, 15604, 15206, 28132, 12675,
+    16, 2, 29979, 210, 11443, 17661, 26214, 15488,
+    0, 1, 59958, 1835, 11443, 13211, 23337, 12675,
+    1, 2, 43225, 341, 16991, 16280, 25255, 14748,
+    16384, 2, 23007, 183, 9362, 17201, 20140, 18301,
+    0, 2, 43225, 249, 13939, 17661, 23657, 16672,
+    4096, 2, 52289, 304, 13592, 16938, 21738, 17081,
+    0, 2, 39042, 236, 13592, 12291, 15345, 15636,
+    1, 2, 48803, 60, 9362, 12598, 26853, 11046,
+    0, 2, 53683, 39, 11443, 11217, 18542, 12675,
+    0, 2, 50197, 117, 12830, 22725, 22058, 22595,
+    1, 2, 27190, 7, 16991, 19656, 20140, 20966,
+    272, 1, 16732, 1165, 11443, 9068, 15025, 11934,
+    16, 2, 48105, 304, 13592, 16938, 21738, 17081,
+    512, 2, 26493, 33, 19765, 20423, 37083, 13563,
+    2, 2, 51591, 210, 10749, 15206, 21099, 15784,
+    0, 2, 25796, 117, 8669, 17661, 18861, 19782,
+    0, 2, 57169, 183, 13939, 14132, 18542, 16080,
+    0, 2, 32768, 367, 13939, 16741, 20460, 17561,
+    0, 1, 25796, 957, 11443, 14132, 21419, 14358,
+    1, 2, 43225, 262, 12136, 10756, 11509, 16524,
+    0, 2, 38345, 273, 16297, 20577, 29091, 16672,
+    0, 2, 25796, 248, 13939, 16615, 22697, 16239,
+    0, 2, 29282, 288, 13939, 14592, 18222, 16672,
+    1, 2, 22310, 236, 13592, 25026, 47633, 13563,
+    0, 2, 45317, 288, 10749, 11370, 18222, 12971,
+    0, 2, 28584, 262, 13939, 15206, 23976, 13415,
+    1025, 2, 22310, 590, 14078, 12291, 21419, 12527,
+    0, 2, 44620, 304, 13592, 22264, 18222, 25409,
+    1, 1, 35556, 1560, 17684, 11677, 19820, 12675,
+    0, 2, 55774, 249, 12830, 17661, 23657, 16821,
+    1, 2, 23704, 118, 10056, 14439, 18222, 16524,
+    2, 2, 37648, 248, 13939, 25640, 26214, 22595,
+    1, 2, 42528, 144, 13592, 12751, 21738, 12880,
+    0, 2, 50894, 131, 12136, 15666, 19820, 16969,
+    16, 2, 50197, 105, 12830, 18121, 23337, 17265,
+    2, 2, 18824, 39, 13939, 31624, 25575, 28370,
+    0, 2, 45317, 590, 13592, 17201, 31009, 13267,
+    0, 2, 45317, 446, 18378, 13365, 22697, 13119,
+    0, 2, 23704, 236, 11443, 17661, 26214, 15488,
+    16385, 2, 32070, 301, 10749, 11063, 20779, 11490,
+    544, 2, 23007, 8, 26699, 22264, 23337, 21411,
+    2, 2, 41134, 22, 16297, 24873, 23017, 24076,
+    544, 2, 23007, 8, 32178, 23645, 44756, 13563,
+    513, 2, 16035, 20, 18378, 17354, 17263, 20818,
+    1, 2, 29979, 8, 10749, 16894, 19181, 18597,
+    1, 2, 41134, 682, 13939, 13058, 21419, 13267,
+    1, 2, 48803, 262, 16991, 15973, 23017, 15192,
+    2304, 2, 12549, 419, 14910, 17661, 22697, 17265,
+    512, 2, 57866, 5, 28711, 22725, 19181, 25112,
+    0, 2, 60655, 249, 8669, 16434, 17263, 19486,
+    256, 1, 13944, 1442, 9362, 12137, 22697, 11934,
+    0, 2, 41831, 433, 13592, 15973, 23976, 15044,
+    0, 2, 39739, 170, 18378, 17354, 27173, 14896,
+    0, 2, 41134, 248, 13939, 16615, 22697, 16239,
+    1, 2, 23704, 170, 16991, 18889, 27173, 16228,
+    1, 2, 16732, 157, 16991, 18428, 26214, 16080,
+    1, 2, 41134, 380, 13592, 12137, 14705, 16080,
+    1, 2, 41134, 328, 8669, 17815, 19181, 19634,
+    0, 2, 39739, 262, 11443, 21651, 21099, 22299,
+    0, 2, 18127, 249, 16297, 17201, 27493, 14451,
+    0, 0, 46711, 3408, 1734, 476, 16624, 770,
+    16385, 2, 11852, 13, 15604, 14592, 18222, 16672,
+    1, 2, 33465, 367, 12136, 15360, 14066, 20818,
+    2, 2, 33465, 16, 15604, 27328, 26534, 23928,
+    0, 2, 24401, 197, 8669, 9068, 15025, 11934,
+    0, 2, 42528, 223, 13592, 19349, 25575, 17413,
+    0, 2, 19521, 393, 14910, 12751, 25894, 11342,
+    0, 2, 39739, 84, 13592, 14592, 11189, 22743,
+    0, 2, 23704, 114, 19071, 16894, 28132, 13859,
+    1, 2, 42528, 183, 26699, 14439, 17902, 16672,
+    576, 2, 52289, 236, 16991, 20423, 24296, 18745,
+    258, 2, 34859, 1573, 19765, 6306, 27173, 5419,
+    0, 2, 41134, 118, 16297, 16587, 26853, 14303,
+    0, 2, 36951, 328, 2427, 8148, 12787, 11934,
+    1, 2, 37648, 249, 13939, 19196, 22378, 19042,
+    0, 2, 57866, 1835, 46117, 42519, 18222, 48359,
+    256, 0, 53683, 3277, 5895, 7227, 17902, 8529,
+    528, 2, 39739, 131, 12136, 16741, 14066, 22743,
+    1, 2, 47408, 170, 13592, 22418, 34845, 15784,
+    0, 2, 44620, 3, 21845, 19349, 15664, 24520,
+    1, 2, 44620, 170, 13523, 15666, 31968, 11934,
+    0, 2, 34859, 446, 14910, 16127, 26853, 13859,
+    512, 2, 50894, 248, 30860, 25794, 28132, 21559,
+    768, 2, 48105, 170, 12136, 13979, 18542, 15932,
+    256, 2, 9761, 446, 13939, 16741, 32608, 12379,
+    1, 2, 43225, 170, 16297, 13518, 16304, 16672,
+    0, 2, 10458, 248, 13939, 11217, 20779, 11786,
+    0, 2, 29979, 459, 17684, 16894, 25894, 15044,
+    1, 2, 25099, 118, 15604, 11370, 16624, 13859,
+    1, 2, 39739, 7, 16297, 15360, 22058, 15488,
+    2, 2, 52289, 25, 10749, 19349, 22697, 18894,
+    64, 2, 22310, 1152, 13523, 13518, 17263, 16080,
+    2, 2, 25796, 931, 13939, 19502, 22378, 19190,
+    0, 2, 20218, 183, 13592, 13518, 19501, 14748,
+    0, 2, 44620, 248, 13939, 16615, 22697, 16239,
+    4, 2, 48803, 157, 13523, 15360, 22697, 15044,
+    2048, 2, 41831, 20, 14078, 14439, 23976, 13711,
+    386, 2, 45317, 315, 13592, 26254, 28132, 21855,
+    0, 2, 11852, 304, 13592, 20423, 22378, 20078,
+    576, 2, 32768, 94, 11443, 21651, 25575, 19338,
+    0, 1, 43225, 957, 11443, 21344, 31329, 16376,
+    0, 2, 30676, 123, 16297, 11830, 24296, 10898,
+    9, 2, 41134, 26, 27393, 9989, 23017, 9565,
+    0, 2, 36253, 210, 14078, 17508, 25894, 15488,
+    1, 2, 52289, 144, 9362, 14746, 10230, 24076,
+    17, 2, 48105, 183, 9362, 10449, 16624, 12823,
+    64, 0, 19521, 3146, 6311, 9222, 29411, 7492,
+    16384, 2, 25796, 170, 16297, 20730, 28132, 17117,
+    0, 2, 53683, 393, 3121, 15513, 24296, 14303,
+    1, 2, 16732, 223, 13523, 13365, 18222, 15340,
+    256, 2, 45317, 878, 13592, 8148, 14386, 11046,
+    257, 2, 47408, 58, 7282, 9682, 23017, 9417,
+    0, 2, 51591, 459, 14910, 17661, 23337, 16969,
+    2, 2, 50894, 590, 8669, 16127, 21738, 16267,
+    513, 2, 26493, 197, 10749, 9682, 27812, 8085,
+    0, 2, 35556, 4, 12830, 12444, 12468, 18153,
+    1, 2, 38345, 144, 11443, 12137, 23017, 11638,
+    1, 1, 40436, 1573, 10056, 13058, 22378, 12971,
+    0, 2, 43225, 223, 10749, 14592, 19181, 16080,
+    512, 2, 30676, 304, 13592, 16938, 21738, 17081,
+    2, 2, 2789, 3, 13592, 31164, 36124, 21263,
+    0, 2, 40436, 433, 6588, 13672, 19820, 14748,
+    0, 2, 38345, 3, 48891, 33773, 23017, 32516,
+    1, 2, 29979, 380, 22538, 12137, 19501, 13267,
+    1, 2, 30676, 210, 17684, 16894, 27173, 14451,
+    0, 2, 52986, 248, 17684, 16615, 22697, 16239,
+    0, 2, 32768, 304, 13592, 9529, 15664, 12230,
+    9, 2, 54380, 3, 16297, 14746, 14386, 19634,
+    2, 2, 57866, 5, 13939, 32238, 22697, 31627,
+    0, 2, 53683, 236, 15604, 17354, 25575, 15488,
+    2, 2, 45317, 8, 12830, 23799, 25255, 21559,
+    1, 2, 28584, 144, 17684, 17047, 21419, 17413,
+    512, 2, 26493, 1, 10056, 12444, 22697, 12230,
+    2, 2, 51591, 102, 14078, 24873, 23017, 24076,
+    272, 2, 36951, 113, 11443, 14592, 21738, 14748,
+    258, 2, 47408, 14, 13592, 21190, 19820, 22891,
+    1, 2, 54380, 197, 10056, 20883, 22058, 20818,
+    1, 2, 30676, 118, 17684, 13672, 19820, 14748,
+    3, 2, 29282, 7, 13939, 24106, 23976, 22743,
+    512, 2, 36253, 4, 37102, 24413, 14386, 32516,
+    0, 2, 53683, 101, 12830, 16894, 23976, 15932,
+    512, 0, 58563, 4194, 6311, 7994, 19501, 8825,
+    1, 2, 30676, 367, 13592, 13211, 22058, 13267,
+    2, 2, 17430, 51, 12136, 22111, 16304, 27037,
+    0, 2, 57169, 223, 13592, 18428, 22058, 18449,
+    1, 2, 41134, 446, 7975, 15820, 26214, 13859,
+    2, 2, 697, 3, 13939, 21804, 20779, 22595,
+    0, 2, 63443, 92, 8669, 17968, 17902, 20818,
+    1, 2, 54380, 354, 5895, 12751, 18222, 14748,
+    1, 2, 41831, 1152, 13592, 25026, 31968, 18894,
+    1, 2, 35556, 288, 12830, 13058, 24296, 12230,
+    0, 2, 31373, 1, 13523, 13825, 22058, 13859,
+    514, 2, 18824, 9, 13592, 25947, 45715, 14600,
+    512, 2, 20218, 341, 14910, 21037, 33567, 15192,
+    0, 2, 25099, 315, 18378, 23339, 36764, 15784,
+    3, 2, 18824, 13, 13592, 23645, 20140, 25260,
+    1, 2, 9063, 380, 21152, 16741, 24296, 15340,
+    512, 2, 53683, 249, 11443, 15973, 25575, 14303,
+    256, 0, 28584, 14942, 5201, 178, 24296, 213,
+    1, 2, 37648, 367, 5895, 18275, 19820, 19782,
+    4096, 2, 20915, 183, 12136, 14439, 21738, 14574,
+    1536, 2, 31373, 223, 7282, 13979, 20140, 14896,
+    0, 2, 18127, 433, 11443, 13672, 22697, 13376,
+    0, 2, 46711, 249, 13592, 21037, 21738, 21263,
+    0, 1, 41134, 3539, 7975, 20883, 25894, 18597,
+    0, 2, 43225, 98, 13592, 14592, 14066, 19634,
+    0, 1, 52289, 3539, 15604, 20270, 40280, 12675,
+    1, 2, 13246, 1, 32941, 2931, 22697, 2927,
+    0, 2, 15338, 170, 14910, 15360, 34206, 10898,
+    1, 2, 39042, 56, 13939, 14285, 19181, 15784,
+    0, 2, 39042, 236, 20458, 15820, 26853, 13859,
+    0, 2, 49500, 341, 13592, 3238, 8951, 6012,
+    0, 2, 10458, 63, 13592, 24259, 18861, 27037,
+    64, 2, 23704, 18, 12830, 10756, 28132, 8973,
+    256, 2, 55774, 708, 14078, 15206, 26214, 13415,
+    256, 2, 46711, 210, 13592, 14285, 21738, 14451,
+    768, 2, 28584, 304, 14078, 16938, 21738, 17081,
+    2, 2, 10458, 7, 17684, 16280, 22697, 15932,
+    1, 2, 56472, 157, 9362, 17201, 14705, 22595,
+    16385, 2, 31373, 144, 19765, 18735, 23657, 17709,
+    1, 2, 46014, 288, 19071, 14746, 12468, 21559,
+    1, 2, 43225, 406, 13592, 7994, 19820, 8825,
+    0, 2, 52289, 157, 16991, 19963, 28132, 16672,
+    1, 2, 32768, 459, 23925, 25026, 34206, 17857,
+    1, 2, 39042, 72, 7282, 14132, 16304, 17413,
+    1, 2, 40436, 144, 13592, 15513, 20779, 16228,
+    1, 2, 9063, 668, 19071, 13825, 18542, 15784,
+    0, 2, 27190, 144, 12136, 22571, 24296, 21115,
+    0, 2, 12549, 524, 19765, 18275, 23657, 17265,
+    7, 2, 39042, 17, 16297, 17354, 19501, 18894,
+    0, 1, 29979, 3670, 11443, 12598, 23337, 12082,
+    1026, 2, 30676, 393, 13592, 15206, 19181, 16821,
+    0, 1, 38345, 3539, 11443, 10910, 23337, 10602,
+    1, 0, 29979, 5374, 10056, 6920, 28132, 5715,
+    512, 2, 37648, 4, 13523, 16280, 20779, 16969,
+    1, 2, 38345, 131, 15604, 15360, 25575, 13711,
+    16385, 2, 16732, 367, 17684, 16587, 18861, 18449,
+    1, 1, 25099, 1573, 7975, 15666, 17902, 18153,
+    1, 2, 28584, 121, 10749, 13211, 17263, 15636,
+    0, 2, 35556, 590, 7975, 16127, 14386, 21559,
+    1, 2, 17430, 380, 11443, 19349, 26214, 16821,
+    1, 2, 52289, 131, 13592, 14132, 20460, 14896,
+    1, 2, 27190, 248, 13939, 9222, 19181, 10306,
+    1, 2, 56472, 459, 13592, 17354, 14705, 22891,
+    2, 2, 39042, 8, 13592, 25794, 20460, 27185,
+    1, 2, 42528, 123, 13592, 13979, 21419, 14303,
+    1, 2, 42528, 459, 13523, 9836, 14386, 13267,
+    0, 2, 30676, 144, 10749, 12444, 21738, 12527,
+    0, 2, 48105, 183, 14910, 15820, 15025, 20522,
+    3, 2, 33465, 30, 13592, 18889, 17902, 21855,
+    0, 2, 54380, 262, 13592, 17968, 26534, 15636,
+    128, 1, 25099, 3277, 11720, 10449, 24296, 9713,
+    0, 2, 36253, 511, 13592, 21344, 28132, 17561,
+    1024, 2, 21613, 210, 11443, 18735, 21738, 18894,
+    4352, 2, 20915, 354, 15604, 12904, 28132, 10602,
+    0, 1, 18824, 800, 14910, 20423, 30690, 15932,
+    0, 1, 52289, 1573, 10056, 18889, 21419, 19338,
+    0, 2, 32768, 39, 16297, 17508, 23657, 16672,
+    0, 2, 50197, 262, 19765, 17354, 28132, 14303,
+    0, 2, 44620, 183, 11443, 21190, 27812, 17857,
+    0, 2, 16035, 183, 26006, 27175, 41239, 16672,
+    2, 2, 43922, 157, 13939, 13211, 21419, 13563,
+    2, 2, 28584, 996, 15604, 19656, 27812, 16376,
+    129, 0, 17430, 25952, 6311, 322, 21419, 459,
+    3, 2, 23704, 273, 13592, 17201, 21738, 17561,
+    0, 2, 54380, 511, 13592, 13518, 15664, 17117,
+    1, 2, 50894, 288, 8669, 11830, 14705, 15636,
+    0, 2, 52289, 406, 16297, 18275, 21738, 18421,
+    1, 2, 43922, 459, 12136, 10603, 18542, 12082,
+    256, 2, 42528, 24, 10056, 15360, 21738, 15497,
+    0, 2, 25796, 48, 16991, 27175, 30370, 21263,
+    1, 2, 32768, 248, 13939, 16741, 19820, 18005,
+    2, 2, 39739, 708, 10749, 15666, 22697, 15316,
+    0, 2, 9761, 341, 16297, 14899, 22697, 14570,
+    16384, 2, 20218, 33, 13592, 15206, 15345, 19486,
+    0, 2, 31373, 170, 13592, 10756, 15664, 13711,
+    2, 2, 28584, 288, 11443, 15666, 20140, 16672,
+    2, 2, 29282, 121, 15604, 13825, 18542, 15636,
+    2, 2, 39739, 1311, 13592, 11984, 21099, 12379,
+    512, 2, 52986, 55, 8669, 9836, 25575, 8825,
+    1, 2, 33465, 66, 12136, 12751, 17263, 15192,
+    0, 2, 43225, 128, 13939, 16615, 14066, 17117,
+    2, 2, 48105, 13, 12136, 25640, 22697, 24964,
+    0, 2, 46014, 144, 10056, 12904, 19501, 14155,
+    0, 2, 43922, 10, 8669, 15666, 24296, 14600,
+    2, 2, 29282, 865, 9362, 20577, 26853, 17857,
+    0, 2, 42528, 92, 13592, 13825, 19181, 15340,
+    2, 2, 31373, 8, 13592, 24259, 22697, 23780,
+    258, 2, 16732, 92, 13939, 27635, 36124, 18894,
+    0, 2, 41134, 393, 13592, 14899, 15345, 19190,
+    128, 1, 46014, 904, 11443, 12137, 20140, 12971,
+    0, 2, 56472, 248, 7282, 10143, 11509, 15488,
+    512, 2, 41134, 111, 13592, 29630, 46354, 16376,
+    0, 2, 37648, 248, 13939, 16615, 22697, 16239,
+    0, 2, 33465, 262, 13592, 13211, 18861, 14748,
+    16385, 2, 36951, 183, 10056, 15973, 18542, 18005,
+    0, 2, 27190, 81, 7975, 9989, 2877, 26889,
+    1024, 1, 39739, 839, 15604, 12598, 24296, 11490,
+    4096, 2, 48105, 26, 18378, 11677, 22378, 11638,
+    0, 2, 26493, 223, 13523, 11523, 17902, 13415,
+    4608, 2, 19521, 248, 10749, 12751, 15984, 16080,
+    514, 2, 29282, 3, 13523, 27635, 24296, 25409,
+    0, 2, 31373, 328, 13939, 16280, 26534, 14155,
+    3, 2, 27190, 84, 13523, 8301, 12787, 12082,
+    1, 2, 46711, 629, 14078, 15973, 22697, 15636,
+    4608, 2, 52986, 3408, 20458, 8915, 19181, 9861,
+    1, 2, 48105, 393, 8669, 15666, 21099, 16228,
+    2, 2, 53683, 367, 13592, 9989, 23017, 9713,
+    16384, 2, 55077, 144, 12136, 13979, 21099, 14451,
+    258, 2, 23007, 52, 13939, 16280, 20140, 17413,
+    520, 2, 23007, 3539, 30167, 41445, 30050, 32516,
+    16384, 2, 32070, 249, 15604, 20270, 25255, 18301,
+    16384, 2, 20915, 13, 12136, 13825, 22697, 13526,
+    1, 2, 21613, 8, 19765, 17354, 21738, 17499,
+    1, 2, 39042, 131, 7282, 9375, 12468, 13711,
+    0, 1, 41831, 1049, 11443, 11217, 21419, 11490,
+    512, 2, 37648, 1, 37795, 33159, 16624, 40215,
+    4096, 2, 24401, 170, 14078, 11984, 19820, 12971,
+    512, 2, 28584, 459, 10056, 12291, 20460, 12971,
+    515, 2, 28584, 1165, 8669, 11063, 14705, 14748,
+    2, 2, 39042, 367, 13592, 16434, 21099, 16969,
+    1, 1, 12549, 2412, 13523, 15666, 23017, 15176,
+    1, 2, 32768, 105, 7975, 14439, 19820, 15488,
+    259, 2, 34162, 1966, 13523, 10449, 25575, 9417,
+    0, 2, 28584, 304, 16991, 8762, 20140, 9269,
+    4096, 2, 43922, 13, 13939, 16894, 20140, 18153,
+    1, 2, 49500, 301, 7975, 11370, 18222, 13119,
+    0, 2, 27887, 157, 18378, 16894, 24296, 15488,
+    0, 2, 20218, 695, 14078, 13672, 24296, 12675,
+    0, 2, 39739, 114, 8669, 13979, 23657, 13267,
+    0, 2, 27190, 20, 11443, 19809, 20779, 20522,
+    0, 2, 25796, 183, 13592, 25640, 49871, 13267,
+    0, 2, 39042, 5, 8669, 18121, 16624, 22151,
+    0, 2, 18824, 183, 13592, 15666, 21099, 16228,
+    1, 2, 35556, 249, 19071, 18582, 28132, 15340,
+    4098, 2, 47408, 1, 13939, 26561, 26534, 23039,
+    0, 2, 58563, 304, 13592, 19196, 26534, 16672,
+    0, 2, 41831, 10, 16991, 23645, 22058, 23632,
+    1, 2, 48803, 72, 7282, 13518, 18542, 15192,
+    0, 2, 59958, 39, 10056, 14899, 29411, 11934,
+    0, 2, 52986, 380, 13592, 15666, 20779, 16376,
+    16384, 2, 17430, 236, 16991, 22111, 27173, 18745,
+    0, 2, 20915, 183, 13592, 16741, 27493, 14155,
+    1, 2, 51591, 4, 7975, 14592, 17583, 17117,
+    1, 2, 33465, 115, 7975, 16434, 16624, 20078,
+    0, 2, 38345, 511, 13592, 12291, 18542, 14007,
+    2, 2, 28584, 3146, 5895, 9068, 19820, 9861,
+    0, 2, 32070, 80, 9362, 15973, 18542, 18005,
+    0, 2, 12549, 304, 13592, 12444, 15984, 15636,
+    512, 2, 18127, 262, 16991, 13365, 24296, 12230,
+    1, 2, 14641, 485, 14078, 12291, 17263, 14600,
+    1, 2, 37648, 249, 15604, 13365, 16943, 16228,
+    0, 2, 47408, 248, 14078, 16894, 19181, 18597,
+    0, 2, 41831, 38, 10056, 17815, 19820, 19190,
+    0, 2, 62049, 590, 347, 3851, 16304, 4827,
+    1, 2, 37648, 524, 7282, 11677, 14386, 15636,
+    8, 2, 6972, 248, 13939, 16615, 22697, 16239,
+    0, 2, 42528, 100, 13939, 15666, 18222, 18005,
+    0, 2, 50197, 249, 10056, 16894, 24296, 15340,
+    512, 1, 55774, 1075, 5895, 19196, 20140, 20522,
+    1026, 2, 28584, 301, 15604, 13825, 31649, 10454,
+    1027, 2, 22310, 210, 13592, 12598, 23657, 11934,
+    0, 2, 61352, 92, 10056, 17968, 20460, 18894,
+    0, 2, 53683, 183, 13523, 19502, 20779, 20226,
+    512, 2, 28584, 8, 21152, 23492, 21099, 24224,
+    0, 2, 18824, 419, 9362, 14132, 19820, 15192,
+    0, 2, 29979, 125, 13592, 17201, 22058, 16969,
+    0, 1, 54380, 891, 11720, 21651, 32288, 16080,
+    0, 2, 21613, 183, 13939, 16127, 27812, 13563,
+    2, 2, 15338, 90, 13592, 30857, 33886, 22151,
+    64, 2, 34859, 262, 13939, 16280, 20140, 17413,
+    2, 2, 44620, 341, 10749, 21344, 23337, 20522,
+    0, 1, 56472, 813, 10056, 14746, 19820, 15932,
+    64, 2, 39042, 3, 14078, 29169, 21738, 29350,
+    1, 2, 48105, 472, 6588, 8762, 19181, 9713,
+    0, 2, 41831, 249, 11443, 15513, 19820, 16821,
+    1, 2, 43922, 111, 10749, 18275, 16304, 22447,
+    1, 2, 41831, 315, 16297, 19502, 21419, 19930,
+    513, 2, 18127, 97, 13523, 16127, 10230, 26297,
+    1, 2, 18824, 183, 15604, 17968, 21099, 18597,
+    0, 2, 22310, 248, 13939, 16615, 22697, 16239,
+    0, 2, 36951, 90, 23232, 22111, 34206, 15784,
+    0, 2, 20915, 39, 18378, 16127, 24296, 14896,
+    1, 2, 51591, 248, 13939, 17968, 22058, 18005,
+    0, 2, 9761, 328, 12136, 11984, 19501, 13119,
+    0, 2, 41831, 433, 13592, 16434, 26534, 14303,
+    64, 2, 28584, 5, 12830, 17508, 15664, 22299,
+    0, 2, 16732, 106, 19071, 15820, 33247, 11638,
+    512, 2, 34162, 66, 5201, 18428, 28132, 15192,
+    2, 2, 36951, 8, 11443, 22264, 21419, 22595,
+    0, 2, 53683, 7, 13523, 17047, 18222, 19486,
+    0, 2, 54380, 393, 6588, 20883, 16624, 25409,
+    513, 2, 29282, 3, 19765, 19502, 16624, 23780,
+    1, 2, 50197, 66, 4508, 16434, 20779, 17117,
+    1, 2, 53683, 170, 13592, 12598, 13107, 17857,
+    0, 2, 23704, 393, 19765, 12904, 26214, 11342,
+    4112, 2, 46014, 170, 14910, 15513, 20460, 16524,
+    0, 2, 34162, 301, 13523, 19042, 27173, 16376,
+    0, 2, 56472, 131, 16297, 20883, 27812, 17561,
+    5, 2, 31373, 304, 13592, 21190, 22378, 20818,
+    0, 2, 18824, 248, 13939, 16615, 22697, 16239,
+    0, 2, 37648, 20, 13523, 14592, 12468, 19042,
+    257, 1, 0, 865, 11443, 9989, 23017, 9703,
+    0, 2, 15338, 315, 8669, 10603, 19820, 11490,
+    0, 2, 14641, 197, 13592, 14592, 31968, 11046,
+    3, 2, 57169, 8, 13523, 17354, 13746, 23780,
+    258, 2, 40436, 996, 13592, 15820, 25255, 14451,
+    1, 2, 29282, 393, 13592, 13825, 13107, 19634,
+    513, 2, 49500, 537, 12830, 12598, 22697, 12230,
+    0, 2, 51591, 668, 14910, 12137, 15984, 15192,
+    0, 2, 43922, 10, 11443, 10910, 25255, 9861,
+    2048, 2, 23704, 248, 13939, 13211, 26214, 11638,
+    0, 2, 14641, 66, 11443, 12291, 18542, 14007,
+    66, 2, 45317, 12, 14910, 29936, 22058, 29851,
+    1, 2, 14641, 273, 15604, 11984, 23337, 11490,
+    2, 2, 34162, 354, 10056, 25947, 27812, 21707,
+    1, 2, 57866, 197, 15604, 15053, 16943, 18153,
+    0, 2, 25796, 39, 16991, 13058, 21419, 13415,
+    0, 2, 17430, 249, 10056, 12904, 21099, 13415,
+    1, 2, 22310, 157, 14910, 17661, 19501, 19190,
+    0, 2, 13246, 72, 10749, 14132, 18222, 16228,
+    16385, 2, 26493, 210, 12136, 17047, 22378, 17413,
+    512, 2, 39042, 248, 13939, 16615, 22697, 16239,
+    2, 2, 34859, 14, 14078, 20270, 25575, 18153,
+    0, 2, 16732, 39, 21152, 19349, 22697, 18898,
+    0, 2, 34162, 367, 13523, 17354, 31329, 13267,
+    256, 2, 43225, 20, 13592, 26100, 26853, 22447,
+    0, 0, 36253, 23986, 9362, 1703, 32927, 1273,
+    1, 2, 48105, 301, 10749, 12751, 14066, 17265,
+    0, 2, 18127, 183, 12830, 22264, 27173, 19042,
+    1, 2, 37648, 26, 12136, 20116, 23657, 19042,
+    4128, 2, 12549, 59, 21845, 19502, 49551, 10157,
+    16, 2, 15338, 537, 12830, 9682, 18222, 11046,
+    0, 2, 58563, 393, 16991, 29323, 25575, 26297,
+    0, 2, 23704, 433, 19765, 19809, 24296, 18005,
+    1, 2, 14641, 144, 13523, 11984, 19181, 13267,
+    0, 2, 47408, 28, 5895, 13825, 18861, 15488,
+    256, 2, 34162, 197, 13592, 13672, 18861, 15340,
+    0, 2, 49500, 197, 8669, 12751, 19181, 14303,
+    0, 2, 41134, 183, 13939, 17815, 26853, 15340,
+    1, 2, 29282, 288, 15604, 12904, 20779, 13563,
+    513, 2, 18127, 102, 15604, 17354, 14386, 23187,
+    1, 2, 48803, 354, 12136, 14439, 23337, 13859,
+    0, 2, 13944, 118, 12136, 12444, 15025, 16376,
+    0, 2, 40436, 12, 8669, 11830, 23657, 11342,
+    2049, 2, 39739, 105, 14910, 14439, 26214, 12675,
+    258, 2, 49500, 304, 13592, 15206, 21738, 14748,
+    0, 2, 51591, 170, 15604, 16938, 21738, 17081,
+    64, 2, 34162, 9961, 3121, 2931, 26853, 2458,
+    0, 2, 41831, 248, 13939, 16615, 22697, 16239,
+    1, 2, 45317, 223, 4508, 10143, 20779, 10602,
+    0, 2, 18824, 197, 19071, 17508, 22378, 16524,
+    0, 2, 18127, 123, 19765, 13672, 20779, 14451,
+    16384, 2, 18824, 92, 13523, 6460, 22697, 6361,
+    0, 2, 42528, 249, 13939, 9989, 11509, 15340,
+    2, 2, 40436, 26, 19071, 21344, 22697, 20818,
+    0, 2, 24401, 524, 13592, 11830, 17263, 14155,
+    0, 2, 43225, 380, 13939, 14132, 25575, 12675,
+    4096, 2, 39739, 83, 10749, 15973, 20779, 16672,
+    2, 2, 34162, 71, 12136, 24106, 26214, 21263,
+    0, 2, 41134, 72, 13939, 27175, 24296, 25112,
+    0, 2, 60655, 157, 13523, 18428, 28132, 15488,
+    0, 2, 34162, 26, 13523, 18121, 24296, 16821,
+    1, 2, 43922, 118, 11443, 11370, 19820, 12230,
+    386, 2, 43922, 96, 13523, 22878, 27812, 19042,
+    258, 2, 51591, 4194, 10056, 14285, 22378, 14155,
+    16, 2, 19521, 668, 13939, 10603, 16624, 12971,
+    1, 2, 48803, 10, 13592, 16127, 16624, 19486,
+    1, 2, 36951, 301, 16297, 15820, 23017, 15340,
+    0, 2, 36253, 210, 12136, 11984, 28132, 10009,
+    1, 2, 9761, 393, 15604, 12444, 22378, 12379,
+    1, 1, 13944, 2884, 10056, 15973, 20140, 17117,
+    0, 1, 42528, 1035, 12136, 13825, 21419, 14049,
+    16384, 2, 50197, 73, 13592, 11984, 19820, 12971,
+    1, 2, 9761, 446, 30860, 14439, 22697, 14123,
+    256, 2, 46014, 170, 13592, 17508, 19501, 19042,
+    4, 1, 17430, 1231, 11720, 10296, 21419, 10602,
+    0, 2, 25099, 81, 13523, 14132, 17583, 16672,
+    0, 2, 25796, 66, 14910, 13058, 21738, 13267,
+    512, 2, 23704, 62, 9362, 6000, 14386, 8233,
+    256, 2, 23704, 301, 16297, 19502, 26534, 16969,
+    4096, 2, 42528, 210, 13592, 17508, 25255, 15784,
+    0, 2, 13944, 668, 13939, 12904, 19501, 14155,
+    0, 2, 48105, 183, 11443, 14439, 16304, 17709,
+    2, 2, 54380, 931, 17684, 23032, 30370, 18005,
+    17, 2, 41831, 79, 6588, 14285, 20779, 15044,
+    0, 2, 43225, 393, 5895, 20577, 21419, 20966,
+    2, 0, 31373, 1271, 3121, 5232, 14066, 7196,
+    0, 2, 8366, 655, 6588, 15360, 14066, 20670,
+    0, 2, 11155, 210, 7282, 7534, 2557, 21115,
+    1, 2, 46014, 105, 15604, 15513, 24296, 14451,
+    256, 2, 42528, 157, 8669, 16280, 20460, 17117,
+    1, 2, 45317, 170, 11443, 12751, 20140, 13563,
+    3, 2, 27887, 248, 13939, 16615, 22697, 16239,
+    2, 2, 39739, 157, 13592, 26407, 25575, 23484,
+    0, 2, 49500, 45, 9362, 14899, 16624, 18005,
+    4096, 2, 57866, 144, 14910, 17201, 21419, 17561,
+    0, 1, 43225, 4325, 12830, 9529, 21099, 10009,
+    256, 2, 53683, 131, 6588, 15206, 13107, 21559,
+    2, 2, 20915, 119, 13592, 19196, 18861, 21411,
+    514, 2, 27887, 248, 13939, 16615, 22697, 16239,
+    1, 2, 52289, 144, 20458, 14285, 16943, 17265,
+    4096, 2, 31373, 97, 14078, 19042, 25255, 17265,
+    0, 2, 20218, 62, 13592, 27942, 45395, 15784,
+    0, 2, 43225, 577, 15604, 17661, 28132, 14600,
+    0, 2, 8366, 511, 13592, 11217, 22378, 11046,
+    0, 1, 47408, 891, 14910, 11370, 23017, 11034,
+    0, 2, 50894, 459, 13592, 21651, 19501, 23632,
+    1, 2, 36253, 197, 13592, 14285, 23976, 13415,
+    1, 2, 40436, 354, 14078, 12751, 20460, 13415,
+    2, 2, 38345, 144, 13592, 17968, 23976, 16821,
+    0, 2, 48105, 131, 18378, 24259, 20460, 25557,
+    1, 2, 62746, 446, 13939, 16741, 22697, 16376,
+    16, 2, 42528, 433, 13523, 17354, 24296, 15932,
+    256, 2, 32070, 682, 13592, 14592, 14705, 19190,
+    1, 2, 37648, 170, 13939, 10603, 15025, 13859,
+    16385, 2, 36253, 223, 12830, 16434, 14386, 21855,
+    0, 2, 34859, 446, 14910, 11523, 24296, 10750,
+    0, 2, 24401, 170, 10749, 16741, 27173, 14451,
+    2049, 2, 17430, 210, 13592, 20423, 25255, 18597,
+    64, 2, 39739, 52, 13592, 11370, 16943, 13711,
+    1, 0, 27190, 9568, 6311, 6153, 18861, 6900,
+    0, 0, 20915, 2621, 16991, 8455, 25255, 7640,
+    512, 2, 50197, 315, 8669, 6153, 19820, 6752,
+    65, 2, 2092, 8, 13592, 15360, 18542, 17413,
+    1, 2, 39739, 183, 10056, 14592, 14066, 19782,
+    1, 2, 48803, 157, 13592, 23492, 21419, 23928,
+    0, 2, 39042, 760, 8669, 8301, 21738, 8418,
+    0, 2, 54380, 183, 10749, 18121, 27173, 15488,
+    0, 2, 22310, 66, 12830, 13672, 20460, 14600,
+    512, 2, 45317, 7, 7282, 10143, 15984, 12675,
+    4096, 2, 51591, 5, 13523, 21958, 24296, 20226,
+    0, 2, 42528, 144, 15604, 17815, 21419, 18153,
+    0, 2, 40436, 126, 13592, 14439, 21099, 14896,
+    0, 2, 18824, 170, 9362, 17968, 17263, 21263,
+    1, 2, 41134, 52, 12830, 15820, 24296, 14451,
+    0, 2, 53683, 236, 15604, 16280, 35165, 11342,
+    0, 2, 16732, 304, 13592, 12291, 17583, 14451,
+    1, 2, 34859, 26, 13523, 16894, 17902, 19486,
+    0, 2, 22310, 341, 8669, 13211, 19820, 14155,
+    1, 2, 49500, 315, 14910, 14285, 20779, 14896,
+    2, 2, 36951, 5, 14910, 19809, 20779, 20670,
+    2, 2, 20218, 262, 12830, 15973, 18222, 18301,
+    36, 2, 18127, 248, 27393, 28249, 51149, 14451,
+    320, 2, 41831, 3, 13592, 16894, 20779, 17709,
+    1, 2, 39042, 248, 13939, 16615, 22697, 16239,
+    0, 2, 50894, 157, 13592, 18428, 28132, 15044,
+    0, 2, 57169, 341, 8669, 14899, 18542, 16969,
+    5, 2, 23704, 4, 11443, 17047, 22378, 16672,
+    0, 2, 40436, 380, 9362, 14132, 26534, 12379,
+    4608, 2, 48105, 0, 23925, 29323, 19820, 31479,
+    1, 2, 40436, 157, 7975, 10296, 13746, 14303,
+    0, 2, 41134, 549, 10749, 15053, 26214, 13267,
+    0, 2, 49500, 210, 14910, 15973, 26853, 13859,
+    1, 2, 47408, 406, 13592, 16280, 16624, 19782,
+    1, 2, 45317, 157, 3814, 11523, 17902, 13415,
+    256, 2, 41831, 52, 13939, 16894, 24296, 15340,
+    2, 2, 45317, 144, 13939, 17508, 25575, 15636,
+    1, 2, 35556, 304, 14910, 10449, 15984, 13119,
+    16385, 2, 50197, 223, 24619, 17201, 30370, 13415,
+    0, 2, 52289, 446, 13592, 14439, 30370, 11342,
+    1, 2, 12549, 273, 19765, 20270, 16943, 24372,
+    257, 2, 51591, 236, 13523, 15206, 17583, 18005,
+    0, 2, 19521, 131, 7975, 12444, 12468, 18153,
+    67, 2, 29979, 2752, 13939, 11217, 19820, 12082,
+    0, 2, 25099, 236, 12830, 17201, 29091, 14007,
+    512, 2, 27887, 26, 26006, 38376, 30690, 29851,
+    0, 2, 54380, 66, 10749, 19196, 22697, 18745,
+    0, 2, 17430, 354, 19071, 14285, 17263, 17117,
+    0, 1, 27887, 957, 11443, 19042, 19820, 20522,
+    0, 2, 39042, 113, 11443, 14132, 21738, 14303,
+    2, 2, 39042, 26, 13939, 18121, 16304, 22299,
+    2, 2, 33465, 157, 13939, 12904, 20140, 13711,
+    0, 2, 41134, 5, 13939, 20883, 25255, 18745,
+    1, 2, 22310, 564, 15604, 18735, 21419, 19190,
+    0, 2, 28584, 157, 16991, 15820, 22378, 15636,
+    0, 2, 18824, 341, 13592, 17201, 22058, 17265,
+    0, 2, 16732, 236, 14078, 15206, 26853, 13119,
+    512, 2, 50197, 262, 10749, 17354, 20779, 18153,
+    128, 2, 50197, 0, 13939, 15206, 19501, 16672,
+    17, 2, 29979, 262, 8669, 20423, 21099, 21115,
+    0, 2, 44620, 7, 19765, 20730, 30050, 16376,
+    258, 2, 36951, 76, 17684, 14899, 23337, 14303,
+    0, 2, 41134, 273, 16297, 19042, 29411, 15340,
+    4096, 1, 32768, 2621, 19071, 10910, 21419, 11105,
+    1, 2, 46014, 157, 7975, 18428, 19820, 19930,
+    2, 2, 41134, 12, 12830, 21344, 22378, 21115,
+    0, 2, 18127, 328, 13592, 15973, 22697, 15636,
+    1, 2, 52986, 249, 11443, 19196, 20779, 20078,
+    16384, 2, 44620, 249, 13592, 17047, 19820, 18449,
+    1, 2, 55077, 7, 25312, 22878, 20779, 23928,
+    0, 1, 38345, 1035, 7975, 10756, 16624, 13119,
+    1, 2, 49500, 223, 13523, 11523, 21099, 12527,
+    0, 1, 29282, 1087, 12830, 14132, 28132, 11638,
+    1, 2, 37648, 106, 16991, 11984, 14386, 16228,
+    1, 2, 41831, 262, 7282, 21037, 19820, 22743,
+    1, 2, 40436, 66, 14078, 12751, 16943, 15488,
+    4096, 1, 25099, 1704, 16991, 14285, 33567, 10454,
+    0, 2, 41134, 79, 16297, 15053, 28132, 12379,
+    0, 0, 53683, 25034, 5201, 322, 23976, 363,
+    1, 2, 51591, 127, 3814, 11830, 14066, 15932,
+    0, 2, 52986, 131, 14078, 16894, 25894, 16672,
+    0, 2, 23007, 304, 13592, 16938, 21738, 17081,
+    1283, 2, 28584, 107, 14078, 18121, 15664, 22891,
+    0, 2, 58563, 110, 5201, 24259, 22058, 24224,
+    5, 2, 16035, 304, 12830, 9989, 23976, 9417,
+    0, 2, 13246, 118, 22538, 23492, 44436, 13415,
+    8, 2, 18824, 248, 13939, 16615, 22697, 16239,
+    1, 2, 36951, 393, 13592, 15973, 25575, 14303,
+    0, 2, 51591, 524, 13592, 12751, 21419, 13119,
+    17, 2, 20218, 80, 10056, 12137, 29091, 9861,
+    1, 2, 48105, 197, 8669, 20883, 22378, 20670,
+    2, 2, 43922, 121, 13939, 24413, 25255, 22151,
+    1, 2, 46014, 183, 10056, 14132, 15984, 17709,
+    1, 2, 33465, 157, 13523, 11830, 23017, 11490,
+    1024, 2, 23007, 577, 13592, 19042, 34206, 13563,
+    2, 2, 44620, 52, 13939, 26407, 26853, 22743,
+    1, 2, 39042, 127, 13592, 11677, 14705, 15488,
+    0, 1, 21613, 1035, 14910, 11217, 23337, 10750,
+    1, 2, 43922, 406, 13592, 14592, 19820, 15784,
+    16384, 2, 12549, 223, 12830, 13211, 19181, 14748,
+    0, 1, 41134, 2359, 10056, 9682, 23017, 9417,
+    0, 2, 48803, 7, 13592, 26868, 27173, 23039,
+    0, 2, 56472, 249, 13592, 18275, 26853, 15784,
+    0, 2, 12549, 655, 14910, 17201, 23657, 16524,
+    512, 2, 41134, 144, 21152, 9068, 21099, 9417,
+    1, 2, 55077, 262, 7975, 5539, 21419, 5715,
+    1, 2, 51591, 92, 10056, 16741, 19501, 18301,
+    1, 2, 57169, 315, 8669, 15053, 18542, 16969,
+    1, 2, 11155, 210, 13592, 15206, 20779, 15932,
+    1024, 2, 25796, 367, 13592, 17047, 21099, 17709,
+    256, 2, 40436, 98, 13592, 19349, 23976, 18153,
+    0, 2, 44620, 33, 14910, 11984, 19820, 12971,
+    1, 2, 40436, 130, 13592, 10296, 12468, 15044,
+    0, 2, 11155, 472, 14910, 16587, 23337, 15932,
+    16385, 2, 45317, 485, 13592, 15666, 17583, 18449,
+    513, 2, 49500, 524, 13592, 20730, 39001, 13267,
+    0, 2, 35556, 4, 14078, 27635, 23657, 26149,
+    1, 2, 48803, 63, 11443, 14439, 24296, 13415,
+    1, 2, 41134, 66, 16297, 13825, 24296, 12823,
+    0, 2, 53683, 7340, 33634, 5232, 15984, 6604,
+    0, 2, 21613, 248, 13939, 16615, 22697, 16239,
+    16385, 2, 26493, 341, 20458, 18735, 27173, 16080,
+    0, 2, 54380, 367, 12830, 16127, 20779, 16821,
+    0, 2, 26493, 590, 11443, 25794, 37723, 16969,
+    258, 2, 32768, 9, 11443, 15513, 21738, 15651,
+    1, 2, 28584, 26, 12830, 22725, 22378, 22447,
+    0, 2, 39042, 328, 13592, 18735, 28132, 15636,
+    1, 2, 48803, 144, 3121, 13825, 15025, 18005,
+    2, 2, 24401, 5, 13592, 25487, 22378, 25112,
+    387, 2, 48105, 4850, 8669, 13979, 23017, 13563,
+    512, 2, 33465, 786, 17684, 19196, 31009, 14748,
+    513, 2, 18824, 304, 13592, 15513, 23976, 14600,
+    0, 2, 43225, 88, 12136, 15973, 18222, 18301,
+    16384, 2, 43225, 157, 16297, 20116, 20460, 21115,
+    0, 1, 23007, 1442, 11443, 10143, 21738, 10306,
+    0, 2, 52986, 144, 14078, 12444, 19820, 13415,
+    512, 2, 56472, 122, 7282, 11370, 21738, 11496,
+    1, 2, 53683, 315, 8669, 12904, 19501, 14007,
+    0, 2, 54380, 315, 7975, 11063, 9271, 19190,
+    1, 2, 51591, 236, 13523, 12444, 19820, 13415,
+    0, 2, 30676, 223, 16991, 15820, 22058, 15932,
+    0, 2, 23007, 304, 13592, 12137, 25575, 10898,
+    1, 2, 9761, 433, 16991, 21651, 29091, 17561,
+    3, 2, 41831, 0, 16991, 17047, 20779, 17709,
+    0, 2, 12549, 419, 24619, 20883, 39960, 13119,
+    66, 2, 25796, 8, 12136, 20883, 22697, 20392,
+    4, 2, 43922, 183, 13592, 14746, 20460, 15636,
+    0, 2, 36951, 210, 19765, 17201, 25255, 15488,
+    512, 2, 6972, 248, 13939, 16615, 22697, 16239,
+    0, 2, 23007, 248, 13939, 16615, 22697, 16239,
+    0, 2, 49500, 248, 13939, 16615, 22697, 16239,
+    1, 2, 29979, 64, 12136, 16280, 17263, 19338,
+    0, 2, 48105, 459, 16991, 18428, 27812, 15488,
+    256, 2, 37648, 223, 13523, 16127, 22058, 16080,
+    1, 2, 48105, 118, 17684, 13672, 19501, 14896,
+    0, 2, 52289, 262, 25312, 21344, 27173, 18301,
+    64, 2, 45317, 472, 12830, 12137, 27173, 10454,
+    16385, 2, 40436, 131, 9362, 12291, 18542, 13859,
+    2, 2, 15338, 1, 13592, 19042, 20779, 19930,
+    1, 2, 17430, 117, 13523, 11830, 13427, 16524,
+    256, 2, 46014, 68, 9362, 19349, 21738, 19486,
+    2, 2, 21613, 304, 15604, 23645, 24296, 21855,
+    0, 2, 43225, 433, 5895, 12137, 26214, 10750,
+    1, 2, 36253, 4, 14910, 19809, 19181, 21855,
+    16384, 2, 27887, 262, 16991, 16280, 23976, 15192,
+    0, 2, 50894, 79, 16297, 20577, 28132, 16821,
+    1, 2, 34859, 210, 14078, 16587, 21419, 16969,
+    0, 2, 50197, 7, 12830, 11217, 19181, 12379,
+    0, 2, 19521, 66, 16991, 11830, 19181, 13119,
+    0, 2, 16732, 210, 37102, 22878, 39001, 14748,
+    1, 2, 46711, 7, 1040, 17201, 20460, 18301,
+    1, 2, 32768, 105, 6588, 6613, 12148, 10009,
+    1, 2, 37648, 393, 11443, 13979, 18222, 16080,
+    0, 2, 23007, 5, 13592, 23799, 20140, 25409,
+    0, 2, 56472, 144, 13523, 18889, 25894, 16821,
+    1, 2, 38345, 419, 11443, 12904, 18861, 14451,
+    1, 2, 32070, 419, 13592, 17815, 24296, 16524,
+    1, 2, 46014, 341, 2427, 11830, 9271, 20374,
+    17, 2, 52289, 304, 13592, 14592, 26853, 12527,
+    2, 2, 50894, 393, 10056, 19656, 26853, 16969,
+    0, 2, 10458, 13, 13592, 21497, 21738, 21653,
+    1, 2, 37648, 301, 16991, 13825, 25894, 12230,
+    0, 1, 48803, 1442, 8669, 11984, 20140, 12823,
+    0, 2, 16732, 144, 14910, 16741, 22378, 16672,
+    16386, 2, 35556, 315, 19071, 17661, 23337, 16969,
+    272, 2, 20915, 18, 6588, 15360, 12148, 22743,
+    1, 2, 49500, 7, 7282, 16127, 12148, 24076,
+    0, 2, 50894, 85, 5895, 13672, 13746, 18745,
+    0, 2, 32768, 248, 13939, 13518, 20140, 14451,
+    17, 2, 41134, 170, 13592, 16434, 18861, 18301,
+    0, 2, 37648, 41, 13592, 26714, 20140, 28370,
+    1, 2, 53683, 135, 13592, 13365, 23657, 12823,
+    0, 2, 53683, 22, 13592, 11063, 23657, 10454,
+    0, 2, 38345, 249, 13939, 19349, 24296, 17857,
+    1, 2, 25796, 262, 17684, 11217, 18222, 12823,
+    256, 2, 16035, 511, 13592, 13365, 23657, 12675,
+    0, 2, 40436, 537, 21152, 16434, 24296, 15044,
+    1, 2, 36253, 472, 16991, 18428, 23017, 17857,
+    1, 2, 44620, 210, 9362, 11523, 17263, 13859,
+    3, 2, 43225, 9, 13592, 14899, 21419, 15340,
+    1, 1, 55077, 800, 8669, 12291, 19181, 13711,
+    1, 2, 39042, 223, 14910, 12751, 13107, 18301,
+    2, 2, 39042, 301, 347, 8148, 15984, 10306,
+    1, 2, 35556, 248, 13939, 7534, 24296, 6900,
+    513, 2, 25099, 12, 12830, 16127, 15664, 20374,
+    3, 2, 19521, 43, 14910, 21344, 20779, 22299,
+    1, 2, 50197, 248, 18378, 12904, 25255, 11638,
+    1, 2, 12549, 131, 16297, 15820, 18861, 17709,
+    256, 2, 42528, 3, 13592, 22418, 22378, 22151,
+    256, 2, 52289, 55, 6588, 17201, 26534, 15044,
+    0, 2, 38345, 248, 13939, 16615, 22697, 16239,
+    0, 2, 11852, 118, 20458, 21497, 33247, 15636,
+    16384, 2, 25099, 236, 13523, 17661, 27493, 14896,
+    0, 2, 15338, 54, 13592, 29783, 47313, 16228,
+    528, 2, 24401, 380, 13523, 14285, 20140, 15340,
+    0, 2, 44620, 1835, 13592, 8301, 17583, 9861,
+    2, 2, 23007, 12, 41956, 27481, 23017, 26593,
+    0, 2, 25099, 223, 12830, 14132, 24296, 12971,
+    2048, 2, 16732, 262, 14910, 18428, 39641, 11638,
+    256, 2, 28584, 223, 13592, 14132, 18542, 15932,
+    0, 2, 13944, 328, 9362, 16280, 14386, 21559,
+    0, 2, 24401, 144, 13592, 16587, 26534, 14451,
+    5, 2, 46711, 304, 13592, 15360, 22058, 15340,
+    0, 2, 39739, 328, 9362, 9222, 21738, 9340,
+    1, 2, 27887, 76, 13939, 15206, 17902, 17561,
+    0, 2, 46711, 131, 13939, 15360, 23337, 14748,
+    16384, 2, 20915, 157, 13592, 18275, 17902, 21115,
+    2, 2, 50894, 12845, 23925, 1550, 19820, 1718,
+    0, 2, 37648, 210, 11443, 11217, 11828, 16821,
+    2, 2, 28584, 3, 17684, 30704, 23337, 29258,
+    0, 2, 39739, 433, 12136, 15820, 21419, 16080,
+    0, 2, 25099, 183, 10749, 11984, 26214, 10602,
+    0, 2, 48105, 94, 7975, 8915, 18861, 10009,
+    1, 2, 6275, 262, 13592, 14592, 22697, 14303,
+    0, 2, 50197, 288, 10749, 19349, 30050, 15340,
+    1, 2, 50894, 157, 5895, 14746, 22697, 14451,
+    1, 2, 45317, 43, 14910, 20116, 21419, 20522,
+    1, 2, 43922, 13, 6588, 21804, 22697, 21286,
+    0, 2, 23704, 249, 13592, 19502, 23976, 18301,
+    1025, 2, 25099, 249, 15604, 16741, 18861, 18745,
+    1, 2, 43225, 315, 7282, 18582, 18222, 21115,
+    1, 2, 57169, 50, 14078, 13365, 19181, 14748,
+    0, 2, 29282, 273, 3814, 12904, 18861, 14451,
+    16, 2, 49500, 642, 5895, 14746, 15984, 18449,
+    1, 2, 48105, 249, 13592, 16741, 21419, 17117,
+    16, 2, 43922, 115, 13592, 18735, 18861, 21115,
+    0, 2, 32768, 144, 16991, 16587, 32608, 12230,
+    1, 2, 46014, 393, 10749, 11830, 11509, 18153,
+    0, 2, 51591, 695, 13592, 14592, 15025, 18894,
+    0, 2, 11852, 170, 13592, 8915, 15664, 11342,
+    1, 2, 27190, 85, 11443, 15053, 20779, 15784,
+    16, 2, 52289, 170, 13592, 12291, 21738, 12527,
+    1, 2, 44620, 26, 12830, 20116, 22378, 19930,
+    2, 2, 50197, 1114, 14078, 15513, 27173, 13267,
+    1, 2, 25099, 80, 7282, 10756, 16304, 13415,
+    0, 2, 25796, 328, 10056, 11984, 18542, 13563,
+    0, 2, 35689, 197, 13592, 19809, 23657, 18745,
+    16385, 2, 18127, 419, 16297, 15206, 19181, 16821,
+    0, 2, 28584, 459, 7282, 8762, 19820, 9565,
+    1, 2, 33465, 83, 7282, 8762, 11509, 13563,
+    1, 2, 42528, 262, 10056, 14132, 12468, 20670,
+    0, 1, 51591, 865, 9362, 17201, 21099, 17709,
+    0, 2, 40436, 100, 13592, 18121, 26534, 15784,
+    256, 2, 52986, 170, 7975, 18428, 22378, 18301,
+    16641, 2, 30676, 459, 13592, 15973, 22378, 15784,
+    16385, 2, 19521, 183, 22538, 20883, 23017, 20226,
+    0, 2, 49500, 472, 9362, 13211, 15345, 16969,
+    0, 2, 16035, 107, 16991, 14439, 20140, 15488,
+    0, 1, 18824, 1442, 11443, 15820, 22058, 15932,
+    1, 2, 44620, 549, 3814, 8455, 14386, 11342,
+    0, 2, 34859, 68, 13592, 20577, 26534, 17857,
+    1, 2, 13944, 118, 5201, 11370, 21738, 11496,
+    1, 2, 36253, 183, 14910, 13518, 15345, 17413,
+    1, 2, 32768, 72, 13592, 11984, 9271, 20670,
+    67, 2, 36253, 10, 13939, 19042, 19820, 20522,
+    2, 2, 34162, 20, 14910, 22725, 20140, 24224,
+    1, 2, 25099, 248, 13939, 14592, 17583, 17265,
+    1, 2, 57169, 301, 13592, 10603, 10869, 16821,
+    2, 2, 26493, 8, 16297, 22264, 25255, 20078,
+    32, 2, 50197, 288, 16991, 16434, 31968, 12230,
+    64, 2, 50197, 393, 12830, 15820, 22697, 15466,
+    0, 2, 18127, 170, 26006, 21958, 36444, 14896,
+    520, 2, 55774, 157, 15604, 13211, 27493, 11194,
+    2, 2, 25796, 62, 9362, 19042, 21738, 19190,
+    512, 2, 13944, 248, 13939, 16615, 22697, 16239,
+    0, 1, 45317, 1022, 11443, 11370, 15345, 14600,
+    0, 2, 35556, 249, 11443, 15973, 23337, 15340,
+    1, 2, 55774, 288, 13592, 20730, 17902, 24076,
+    0, 2, 46014, 406, 10056, 16127, 21099, 16672,
+    1, 2, 18824, 33, 13523, 14746, 16624, 18005,
+    1, 2, 23007, 157, 14078, 17201, 24296, 16080,
+    16384, 2, 27887, 39, 12830, 17508, 25575, 15636,
+    0, 2, 45317, 26, 10749, 20577, 21419, 20966,
+    2, 2, 54380, 668, 13523, 15973, 24296, 15044,
+    1, 2, 41831, 8, 15604, 22878, 20779, 23780,
+    1, 2, 20218, 304, 13592, 11830, 18542, 13415,
+    129, 2, 35556, 157, 11443, 13672, 15345, 17561,
+    0, 2, 41134, 17, 8669, 21958, 20140, 23336,
+    256, 0, 46014, 5767, 6311, 4312, 24296, 3939,
+    64, 2, 34859, 131, 14910, 10143, 24296, 9417,
+    2, 2, 45317, 3, 11443, 22571, 18861, 25112,
+    2, 2, 50197, 459, 10749, 21497, 24296, 19486,
+    16385, 2, 21613, 20, 19765, 19809, 27493, 16821,
+    257, 2, 34162, 459, 14078, 26714, 23017, 25853,
+    1, 2, 48803, 130, 7282, 19349, 16624, 23632,
+    16385, 2, 15338, 170, 10749, 11677, 12148, 17413,
+    1, 2, 16732, 262, 15604, 13672, 16624, 16524,
+    0, 2, 52289, 273, 14910, 15973, 19820, 17265,
+    2, 2, 24401, 273, 16297, 27021, 34526, 19042,
+    1, 2, 13944, 170, 13592, 13825, 14386, 18449,
+    2, 2, 37648, 7, 13523, 22418, 25894, 19782,
+    0, 2, 27887, 223, 12136, 20270, 21099, 21115,
+    0, 2, 25099, 3, 13523, 18889, 18222, 21559,
+    512, 2, 38345, 5, 26006, 24413, 24296, 22595,
+    0, 2, 43922, 110, 13592, 13979, 22058, 14007,
+    1, 2, 42528, 157, 13939, 13365, 28132, 11046,
+    2, 2, 43225, 3, 13939, 25026, 22058, 24816,
+    0, 2, 53683, 304, 13592, 13211, 22058, 13267,
+    1, 2, 46711, 498, 13592, 20116, 23657, 19042,
+    1, 2, 32768, 248, 10749, 16615, 22697, 16239,
+    512, 2, 50197, 328, 13523, 20116, 28132, 16672,
+    1024, 2, 25796, 197, 19765, 13211, 23017, 12823,
+    1, 2, 52986, 13, 12830, 14899, 22378, 14748,
+    0, 2, 31373, 524, 12830, 10143, 22697, 9943,
+    0, 2, 21613, 84, 11443, 15206, 15345, 19486,
+    2, 2, 29282, 419, 14078, 21037, 27493, 17857,
+    3, 2, 27887, 304, 13592, 16938, 21738, 17081,
+    0, 2, 32768, 126, 13939, 19349, 34206, 13859,
+    256, 2, 28584, 183, 15604, 14132, 22378, 14007,
+    0, 2, 30676, 144, 13523, 9989, 20779, 10454,
+    1, 2, 48803, 446, 14078, 12904, 19501, 14155,
+    0, 2, 55774, 406, 12136, 15666, 20460, 16524,
+    0, 2, 25796, 223, 18378, 19502, 22697, 19046,
+    0, 2, 23704, 262, 21845, 21958, 29411, 17709,
+    2, 2, 48803, 4, 13939, 26407, 24296, 24520,
+    1, 2, 41134, 262, 14078, 14899, 21419, 15192,
+    17, 2, 31373, 262, 5895, 15206, 21099, 15784,
+    64, 2, 29282, 68, 0, 6613, 7672, 12379,
+    1, 2, 11852, 248, 13939, 14132, 20779, 14748,
+    0, 1, 50894, 839, 5895, 15206, 22058, 15340,
+    0, 2, 32070, 223, 13592, 11523, 21738, 11638,
+    0, 2, 58563, 26, 8669, 16587, 21099, 17117,
+    1, 2, 42528, 144, 15604, 19502, 30690, 15192,
+    1, 1, 29979, 1442, 5201, 12751, 12148, 18894,
+    0, 2, 19521, 248, 13939, 16615, 22697, 16239,
+    0, 2, 37648, 1, 12136, 27175, 17263, 32072,
+    16, 2, 40436, 248, 13939, 16615, 22697, 16239,
+    0, 2, 41831, 94, 10056, 22725, 21738, 22885,
+    0, 2, 46711, 13, 13592, 22111, 22058, 22151,
+    1, 2, 30676, 144, 10749, 18428, 23657, 17413,
+    1, 2, 41831, 273, 7975, 16280, 15984, 20374,
+    2, 2, 45317, 9, 13939, 17661, 21099, 18301,
+    4608, 2, 32070, 0, 20458, 21804, 30370, 16969,
+    0, 2, 39739, 144, 13592, 8762, 17263, 10306,
+    16385, 2, 19521, 125, 13523, 20423, 23337, 19486,
+    768, 2, 25796, 144, 12136, 11984, 18861, 13415,
+    1, 2, 55077, 210, 8669, 16938, 21738, 17081,
+    0, 2, 39739, 564, 20458, 15666, 22697, 15340,
+    1, 2, 5577, 223, 21845, 18735, 18222, 21411,
+    0, 2, 36253, 248, 16297, 14746, 27173, 12675,
+    0, 2, 57866, 223, 12136, 12137, 20460, 12823,
+    64, 2, 21613, 236, 14910, 15053, 27173, 12971,
+    512, 2, 13246, 262, 21152, 20270, 28132, 16672,
+    1282, 2, 50894, 144, 12830, 15820, 28132, 13119,
+    0, 2, 23704, 248, 13939, 16615, 22697, 16239,
+    0, 2, 50197, 249, 14910, 20116, 28132, 16524,
+    0, 2, 32768, 131, 22538, 23645, 31968, 17857,
+    0, 2, 45317, 249, 3814, 12751, 18861, 14451,
+    1, 2, 48105, 26, 13523, 17815, 18542, 20078,
+    1, 2, 47408, 248, 13939, 17661, 26534, 15488,
+    1, 2, 43225, 262, 13592, 12904, 14386, 17265,
+    0, 2, 46014, 144, 7975, 13365, 17263, 15932,
+    128, 2, 33465, 35, 12136, 14592, 25575, 13119,
+    0, 2, 27190, 83, 13592, 10910, 22697, 10750,
+    0, 1, 24401, 1126, 25312, 19656, 43797, 11342,
+    4096, 2, 34859, 183, 15604, 18275, 26214, 16080,
+    1, 2, 29282, 304, 9362, 9682, 15984, 12230,
+    2, 2, 37648, 1, 14910, 25947, 26214, 22891,
+    0, 2, 51591, 273, 8669, 12444, 11189, 19338,
+    1, 2, 41831, 157, 13523, 18121, 19501, 19782,
+    0, 2, 27190, 315, 14078, 16741, 31009, 12971,
+    512, 2, 14641, 210, 13592, 16434, 23976, 15340,
+    0, 2, 27190, 248, 13939, 20116, 29411, 16228,
+    1, 2, 18824, 433, 12136, 16280, 20140, 17265,
+    512, 2, 41831, 8, 36408, 31778, 18861, 35329,
+    0, 2, 32768, 304, 13592, 31317, 44116, 18153,
+    0, 2, 48803, 498, 11443, 13672, 23976, 12971,
+    1, 2, 43922, 236, 14078, 13365, 19501, 14600,
+    1024, 2, 43225, 367, 13523, 13825, 24296, 12823,
+    0, 2, 37648, 26, 11443, 14132, 16304, 17561,
+    8, 2, 18824, 485, 19071, 14899, 22697, 14570,
+    1, 2, 21613, 144, 13592, 13365, 16304, 16524,
+    0, 2, 22310, 126, 13592, 14132, 17263, 16821,
+    0, 2, 48105, 354, 6588, 9836, 21738, 10009,
+    1, 2, 39042, 301, 13939, 16587, 26214, 14600,
+    512, 2, 24401, 10, 30860, 29936, 27812, 25112,
+    1, 2, 48105, 60, 10056, 17661, 15025, 22891,
+    1025, 2, 29979, 393, 9362, 15360, 19181, 17117,
+    2, 2, 36951, 524, 13523, 16434, 22697, 16080,
+    0, 2, 30676, 393, 14078, 18121, 23657, 17117,
+    16, 2, 41831, 26, 26006, 38222, 27173, 32516,
+    0, 2, 50894, 236, 11443, 15973, 17902, 18449,
+    2048, 2, 41831, 130, 10056, 9222, 8951, 16376,
+    0, 2, 58563, 170, 5895, 16587, 24296, 15488,
+    16385, 2, 46711, 197, 13523, 15053, 19181, 16672,
+    0, 2, 50197, 498, 13592, 15513, 22697, 15340,
+    4096, 2, 50197, 111, 14078, 13825, 21738, 13958,
+    2, 2, 47408, 642, 13939, 17354, 26214, 15192,
+    0, 2, 50894, 170, 15604, 16894, 21738, 17117,
+    1, 2, 50894, 80, 5895, 17201, 15025, 22299,
+    0, 0, 57866, 2228, 6311, 4925, 17583, 5864,
+    1, 2, 52289, 170, 16297, 20423, 25255, 18449,
+    2, 2, 11155, 128, 10749, 20730, 17902, 23928,
+    5, 2, 38345, 315, 13592, 15053, 16304, 18597,
+    1, 2, 42528, 183, 13523, 15053, 27173, 12675,
+    0, 1, 41134, 3539, 12136, 9529, 22697, 9417,
+    0, 2, 53683, 419, 7282, 18889, 19501, 20670,
+    0, 2, 23704, 20, 35021, 25180, 23017, 24520,
+    1, 2, 52986, 48, 11443, 21037, 15664, 26593,
+    16384, 2, 30676, 55, 12830, 16280, 15664, 20078,
+    1, 2, 20218, 380, 14078, 17354, 12468, 25260,
+    1, 2, 41831, 315, 13592, 12904, 16624, 15784,
+    0, 2, 9063, 210, 13592, 17047, 23976, 16080,
+    0, 2, 32070, 577, 10749, 14899, 23337, 14303,
+    0, 2, 40436, 52, 10749, 16894, 22697, 16524,
+    2, 2, 18824, 223, 13939, 20730, 29731, 16672,
+    512, 2, 37648, 262, 11443, 17201, 24296, 15192,
+    2, 2, 48803, 109, 20458, 23185, 27493, 19634,
+    0, 2, 15338, 33, 17684, 20883, 19820, 22299,
+    2, 2, 19521, 87, 14078, 16280, 27493, 13859,
+    512, 2, 32070, 157, 14078, 19502, 22697, 19042,
+    1, 2, 31373, 79, 13939, 14592, 21099, 15044,
+    1, 2, 27190, 236, 13523, 13058, 22697, 12778,
+    0, 2, 23704, 273, 14910, 15820, 20140, 16969,
+    16386, 2, 13944, 157, 10749, 14746, 18861, 16524,
+    2, 2, 34859, 197, 13592, 14132, 15664, 17857,
+    512, 2, 36951, 9, 21152, 23492, 16943, 28222,
+    0, 2, 19521, 210, 13939, 21037, 36124, 14303,
+    0, 2, 21613, 315, 13939, 8608, 7033, 17265,
+    0, 1, 43922, 1075, 9362, 19042, 26534, 16524,
+    0, 2, 32768, 170, 10056, 18582, 25575, 16672,
+    0, 2, 50894, 144, 11443, 15206, 22378, 15044,
+    0, 2, 15338, 380, 15604, 29016, 38042, 18894,
+    2, 2, 43225, 13, 13939, 17508, 22378, 17413,
+    2, 2, 37648, 315, 15604, 21497, 21419, 22003,
+    0, 2, 49500, 315, 12136, 12137, 17902, 14303,
+    4096, 2, 50197, 3, 30167, 35614, 20460, 37402,
+    1, 1, 41134, 1573, 11443, 9836, 18861, 11046,
+    1, 2, 55774, 170, 8669, 15973, 18222, 18301,
+    0, 2, 38345, 183, 16297, 19349, 21099, 19930,
+    1, 2, 30676, 33, 9362, 12751, 15025, 16524,
+    0, 1, 46014, 6816, 7975, 9529, 20460, 10157,
+    1, 2, 27190, 119, 21152, 15206, 15025, 19782,
+    0, 1, 55774, 813, 11443, 14592, 17902, 16969,
+    2, 2, 12549, 24, 13592, 33926, 33886, 24372,
+    1, 2, 28584, 315, 13592, 14746, 18222, 16969,
+    0, 2, 12549, 341, 13592, 13672, 17583, 16080,
+    1, 2, 37648, 288, 10749, 12444, 20140, 13267,
+    0, 2, 18127, 45, 4508, 9682, 28132, 7936,
+    66, 2, 36253, 4, 13939, 7534, 25894, 20374,
+    0, 2, 48105, 537, 13523, 18735, 22058, 18597,
+    256, 2, 42528, 288, 13592, 14746, 23976, 13711,
+    2048, 2, 22310, 248, 13939, 16615, 22697, 16239,
+    0, 2, 42528, 84, 9362, 16434, 15984, 20670,
+    1, 2, 55774, 183, 13523, 14439, 29411, 11638,
+    16, 2, 43225, 304, 13592, 12598, 15025, 16376,
+    0, 0, 55077, 22544, 6311, 4005, 17902, 4827,
+    16385, 2, 30676, 98, 15604, 17815, 21099, 18301,
+    1, 1, 48803, 1049, 11720, 9682, 12148, 14451,
+    257, 2, 27887, 52, 13939, 13518, 21738, 13711,
+    0, 2, 22310, 248, 13939, 16615, 22697, 16239,
+    1, 2, 18824, 89, 13592, 17661, 21738, 17807,
+    3, 2, 53683, 1075, 13939, 16615, 22697, 16239,
+    0, 2, 47408, 248, 13939, 16615, 22697, 16239,
+    0, 2, 13246, 183, 13592, 18121, 32288, 13563,
+    0, 2, 58563, 786, 13523, 15360, 22697, 15019,
+    1, 2, 41134, 183, 7282, 13672, 17902, 15932,
+    128, 2, 51591, 33, 23232, 22725, 27173, 19486,
+    0, 2, 42528, 197, 10749, 10143, 17263, 11934,
+    0, 2, 31373, 485, 19071, 13672, 30050, 10750,
+    1, 2, 38345, 68, 16297, 23799, 28132, 19486,
+    0, 2, 32768, 85, 13592, 14592, 16943, 17561,
+    0, 2, 41831, 393, 16297, 13058, 10869, 20670,
+    0, 2, 15338, 144, 13592, 14592, 19501, 15932,
+    0, 2, 51591, 301, 10749, 16587, 15664, 21115,
+    1, 2, 27190, 170, 15604, 12904, 21738, 12971,
+    0, 2, 46711, 655, 8669, 16894, 17902, 19634,
+    0, 2, 6972, 393, 18378, 14746, 23017, 14303,
+    0, 2, 52986, 157, 13592, 15053, 19820, 16228,
+    512, 2, 40436, 13, 16991, 14899, 22378, 14896,
+    2, 2, 37648, 419, 11443, 18889, 30690, 14600,
+    0, 2, 8366, 524, 13592, 15206, 16624, 18597,
+    0, 2, 17430, 248, 12830, 13672, 23017, 13267,
+    1025, 2, 43225, 419, 11443, 12904, 15025, 16821,
+    1, 2, 36951, 92, 13523, 15053, 25894, 13267,
+    4, 2, 42528, 304, 13592, 10143, 18861, 11342,
+    1, 2, 41831, 248, 13939, 16615, 22697, 16239,
+    0, 1, 43922, 1311, 5201, 14746, 22058, 14748,
+    11, 2, 20218, 130, 12830, 17815, 17583, 20818,
+    0, 2, 19521, 131, 13592, 15053, 20460, 15932,
+    0, 2, 40436, 304, 13592, 27635, 42198, 16524,
+    4608, 2, 33465, 249, 13592, 18275, 15984, 22743,
+    0, 2, 17430, 304, 13592, 16938, 21738, 17081,
+    256, 2, 13246, 71, 13592, 11063, 13746, 15340,
+    0, 2, 39739, 105, 13939, 14592, 23657, 13859,
+    2, 2, 33465, 485, 13523, 13518, 18222, 15488,
+    16384, 2, 18127, 236, 14910, 13518, 18222, 15488,
+    0, 2, 52986, 170, 10056, 18735, 24296, 17117,
+    0, 2, 48803, 157, 22538, 23032, 29091, 18745,
+    0, 2, 9761, 248, 10056, 20270, 22697, 19794,
+    0, 2, 46014, 288, 13523, 14746, 21738, 14896,
+    0, 2, 18824, 170, 13592, 11063, 12787, 15932,
+    16384, 2, 27887, 170, 13592, 18582, 18542, 20966,
+    1, 2, 40436, 315, 12830, 19963, 22697, 19486,
+    16385, 2, 16035, 354, 16297, 20883, 22378, 20670,
+    512, 2, 50894, 472, 13523, 12444, 15984, 15636,
+    0, 2, 46014, 301, 13592, 11984, 18542, 13563,
+    0, 2, 18824, 304, 13592, 16938, 21738, 17081,
+    2, 2, 25099, 80, 10749, 17354, 20140, 18449,
+    0, 2, 52289, 301, 10749, 18735, 21419, 19190,
+    2, 2, 22310, 5, 13939, 16741, 17583, 19486,
+    0, 2, 49500, 301, 17684, 16587, 24296, 15192,
+    0, 2, 48803, 304, 13592, 16938, 21738, 17081,
+    768, 1, 52289, 5112, 11720, 12291, 28132, 10009,
+    258, 2, 33465, 8913, 1734, 9989, 19181, 11046,
+    16385, 1, 41134, 813, 4508, 7994, 9590, 13859,
+    0, 2, 41831, 157, 5895, 14439, 20779, 15044,
+    0, 1, 52986, 2359, 1734, 6306, 8951, 11046,
+    0, 2, 33465, 79, 8669, 11370, 11828, 17117,
+    0, 2, 12549, 393, 14078, 11830, 19501, 13119,
+    512, 2, 19521, 35, 14078, 13672, 24296, 12675,
+    4112, 2, 38345, 26, 16991, 20730, 27812, 17265,
+    2, 2, 14641, 39, 13592, 23952, 24296, 22299,
+    1, 2, 20218, 127, 11443, 7381, 8951, 13119,
+    2051, 2, 43225, 0, 8669, 14285, 20460, 15044,
+    17, 2, 39042, 131, 10749, 10756, 22058, 10750,
+    1, 2, 31373, 157, 19071, 27328, 31329, 20966,
+    16385, 2, 48105, 249, 12136, 17047, 23657, 16228,
+    64, 2, 33465, 485, 13523, 7687, 13746, 10750,
+    1, 2, 55774, 144, 13592, 14439, 21738, 14574,
+    0, 2, 50894, 655, 15604, 12137, 23657, 11490,
+    1, 2, 32768, 249, 6588, 8762, 14705, 11638,
+    4096, 2, 15338, 197, 13592, 22571, 42198, 13563,
+    0, 2, 55077, 328, 14910, 16894, 28132, 14007,
+    0, 1, 55774, 1704, 7282, 16434, 17902, 19042,
+    2, 2, 39739, 109, 14078, 19042, 23337, 18301,
+    0, 2, 8366, 248, 13939, 13979, 20140, 14896,
+    1, 2, 25796, 393, 11443, 12444, 22697, 12230,
+    0, 2, 47408, 315, 14078, 13825, 24296, 12675,
+    898, 2, 31373, 695, 10749, 13825, 20140, 14748,
+    256, 2, 28584, 629, 13592, 8301, 16624, 10157,
+    16384, 2, 23704, 10, 14910, 19502, 20140, 20818,
+    256, 2, 35556, 83, 13592, 16587, 22697, 16376,
+    256, 2, 16035, 328, 21152, 17815, 30370, 14007,
+    1, 2, 40436, 13, 13523, 15206, 17263, 18153,
+    0, 2, 38345, 39, 10749, 19656, 21419, 20078,
+    17, 2, 50197, 511, 5895, 9068, 8312, 16672,
+    1, 2, 8366, 248, 14078, 12137, 19181, 13415,
+    16384, 2, 16035, 223, 16297, 18889, 20460, 19782,
+    0, 2, 52986, 288, 13592, 11523, 8631, 20670,
+    0, 1, 44620, 1442, 11443, 10756, 15984, 13563,
+    0, 2, 12549, 304, 13592, 16938, 21738, 17081,
+    16, 2, 40436, 236, 16991, 15206, 26214, 13415,
+    1, 2, 41134, 0, 48891, 27788, 23976, 25853,
+    1, 2, 25099, 341, 14910, 11830, 25255, 10750,
+    0, 2, 18824, 273, 13592, 12598, 14386, 16821,
+    0, 1, 41134, 1060, 14078, 17661, 24296, 16228,
+    16385, 2, 19521, 183, 26006, 19042, 27493, 16228,
+    512, 2, 50894, 564, 7975, 3698, 23976, 3494,
+    259, 2, 36951, 459, 11443, 16894, 21738, 17037,
+    16, 2, 36951, 52, 13939, 8762, 18861, 9861,
+    0, 2, 48105, 118, 12136, 13979, 17263, 16672,
+    256, 2, 36253, 33, 14078, 21804, 23976, 20522,
+    256, 2, 43225, 301, 15604, 16587, 24296, 15192,
+    16385, 2, 16035, 101, 19071, 16434, 20140, 17561,
+    1, 2, 19521, 354, 13592, 13211, 14705, 17561,
+    514, 2, 54380, 249, 13523, 28556, 24296, 26297,
+    512, 2, 35556, 20, 18378, 19963, 24296, 18449,
+    0, 2, 53683, 131, 13523, 17968, 21738, 18153,
+    0, 2, 53683, 315, 13592, 16127, 25894, 14303,
+    0, 2, 49500, 248, 13939, 24259, 19820, 26297,
+    1, 2, 41134, 144, 14910, 15973, 21419, 16376,
+    1, 2, 32070, 131, 13592, 10910, 9590, 18153,
+    768, 2, 26493, 26, 14910, 15820, 15025, 20522,
+    2, 2, 52289, 603, 13592, 9529, 20140, 10157,
+    1, 2, 15338, 248, 13939, 16615, 22697, 16239,
+    0, 2, 19521, 248, 13939, 16615, 22697, 16239,
+    1, 2, 50894, 210, 14078, 17968, 22378, 17709,
+    16, 2, 46014, 92, 13592, 14746, 21099, 15192,
+    1, 2, 47408, 367, 14910, 12291, 16624, 15044,
+    0, 2, 36951, 4, 13592, 16938, 21738, 17081,
+    257, 2, 36253, 92, 13939, 6613, 18861, 7344,
+    3, 2, 32070, 72, 12136, 20116, 22058, 20078,
+    0, 2, 40436, 248, 14910, 16615, 22697, 16239,
+    1, 2, 39739, 406, 12830, 19963, 22697, 19486,
+    4096, 2, 25099, 223, 12136, 10603, 13107, 15044,
+    512, 2, 26493, 79, 13523, 17047, 23017, 16524,
+    16, 2, 57866, 54, 7282, 22264, 25894, 19782,
+    258, 2, 17430, 5, 10749, 14439, 23017, 13711,
+    2, 2, 46014, 629, 7975, 19196, 20460, 20226,
+    0, 2, 21613, 20, 13592, 15206, 21738, 15340,
+    4100, 2, 43225, 10, 12830, 28095, 21738, 28272,
+    2, 2, 46711, 197, 5895, 11217, 11189, 17561,
+    1, 2, 46014, 721, 14910, 15973, 18542, 18005,
+    16, 2, 41831, 131, 9362, 17661, 23657, 16821,
+    2, 0, 35556, 5767, 16991, 9682, 30050, 7640,
+    0, 2, 48105, 248, 13939, 16615, 22697, 16239,
+    0, 2, 21613, 248, 13939, 16615, 22697, 16239,
+    0, 1, 43922, 3146, 7282, 14899, 17263, 17709,
+    0, 2, 19521, 446, 14078, 24719, 34526, 17561,
+    1, 1, 34859, 4456, 11443, 18428, 25255, 16672,
+    0, 2, 18127, 472, 13592, 16434, 24296, 15340,
+    4096, 2, 36951, 341, 13592, 12291, 25255, 11194,
+    1, 1, 48803, 826, 9362, 9682, 11509, 14896,
+    0, 2, 23007, 26, 16991, 15513, 29411, 12379,
+    1, 2, 26493, 5, 8669, 12751, 23657, 12082,
+    0, 2, 45317, 367, 15604, 17815, 19820, 19190,
+    0, 2, 23007, 433, 10749, 12291, 13427, 17117,
+    0, 2, 49500, 210, 13592, 21190, 22058, 21115,
+    16385, 2, 39739, 354, 15604, 13518, 22697, 13267,
+    0, 1, 11852, 5374, 11720, 17661, 27173, 15192,
+    1, 2, 45317, 262, 12830, 13518, 21738, 13711,
+    5, 2, 29282, 72, 19765, 19196, 18861, 21559,
+    1, 2, 52289, 127, 13592, 9222, 19181, 10306,
+    0, 2, 29282, 262, 12136, 18121, 21099, 18745,
+    3, 2, 40436, 3, 18378, 17508, 14705, 22891,
+    5, 2, 47408, 183, 347, 7841, 13746, 10898,
+    4096, 2, 25796, 248, 13939, 16615, 22697, 16239,
+    0, 2, 39739, 26, 12830, 13825, 17902, 16080,
+    512, 2, 26493, 248, 45424, 37609, 19501, 41104,
+    256, 1, 17430, 852, 15604, 15053, 27493, 12823,
+    0, 2, 45317, 328, 10749, 10756, 16624, 13267,
+    0, 2, 51591, 39, 14078, 17508, 21419, 17857,
+    1, 2, 44620, 170, 10056, 16434, 16624, 19930,
+    512, 2, 39739, 144, 15604, 8762, 19501, 9713,
+    0, 1, 13944, 1245, 14078, 21037, 38682, 13563,
+    1, 2, 41831, 121, 13592, 19196, 23657, 18153,
+    1, 2, 12549, 301, 15604, 12137, 19181, 13267,
+    256, 2, 57866, 524, 16297, 18428, 21738, 18575,
+    0, 2, 47408, 304, 13592, 13365, 20140, 14303,
+    3, 2, 34859, 170, 16991, 17508, 17583, 20522,
+    0, 2, 48105, 105, 12136, 12137, 15664, 15488,
+    0, 2, 26493, 197, 12830, 15206, 18861, 17117,
+    899, 2, 11852, 3277, 7282, 20423, 21738, 20818,
+    0, 2, 27190, 273, 3814, 11677, 20140, 12527,
+    2, 2, 32768, 249, 4438, 17201, 16624, 20966,
+    0, 2, 44620, 183, 16991, 27175, 31009, 20966,
+    2, 2, 30676, 1180, 19071, 35921, 28132, 29702,
+    0, 2, 27887, 304, 13592, 16938, 21738, 17081,
+    0, 2, 32768, 97, 19765, 14899, 24296, 13711,
+    1, 2, 35556, 354, 13523, 12291, 11189, 19190,
+    0, 2, 22310, 288, 11443, 13979, 23017, 13563,
+    16384, 2, 27887, 590, 13592, 14439, 18222, 16524,
+    0, 2, 9063, 249, 20458, 19196, 26534, 16821,
+    512, 1, 32768, 865, 10056, 16587, 18542, 18745,
+    0, 2, 29282, 117, 13523, 13979, 22697, 13674,
+    0, 2, 15338, 25, 8669, 14899, 18222, 17117,
+    1, 2, 46014, 26, 12830, 16280, 23976, 15340,
+    0, 2, 56472, 100, 15604, 13825, 23337, 13267,
+    2, 2, 26493, 33, 12830, 13979, 20779, 14600,
+    0, 2, 26493, 26, 1734, 10756, 15984, 13563,
+    1, 2, 49500, 301, 13523, 15820, 23337, 15192,
+    0, 1, 32070, 1442, 14078, 14132, 25255, 12823,
+    0, 1, 48803, 2359, 12830, 14439, 20779, 15044,
+    0, 1, 32768, 9568, 15604, 12904, 26853, 11194,
+    1, 2, 39739, 118, 15604, 15206, 23017, 14748,
+    128, 2, 49500, 210, 14078, 17047, 27493, 14451,
+    512, 2, 45317, 106, 13592, 18889, 21738, 19042,
+    0, 2, 41134, 315, 14078, 13825, 21738, 14007,
+    1025, 1, 27887, 1100, 11443, 13979, 17902, 16228,
+    258, 2, 55774, 79, 3814, 18428, 20140, 19634,
+    0, 0, 41134, 1060, 12136, 8608, 21738, 8677,
+    8, 2, 55077, 695, 13523, 12751, 23657, 11934,
+    5, 2, 39042, 304, 13592, 15666, 21099, 16080,
+    17, 2, 52289, 9, 14078, 13979, 23017, 13563,
+    0, 2, 31373, 459, 13523, 15820, 19820, 17117,
+    514, 2, 14641, 12, 14910, 28556, 23657, 27037,
+    2048, 2, 25796, 157, 13939, 17201, 22058, 16524,
+    0, 2, 26493, 304, 13592, 16938, 21738, 17081,
+    1, 2, 28584, 183, 11443, 18582, 6713, 37106,
+    3, 2, 7669, 13, 20458, 26561, 19501, 28814,
+    546, 2, 21613, 3, 25312, 20883, 33886, 15044,
+    1, 2, 50197, 223, 12136, 12137, 20779, 12675,
+    0, 0, 47408, 3408, 13523, 13211, 39001, 8381,
+    544, 2, 28584, 3, 27393, 30243, 40919, 18597,
+    17408, 2, 23007, 760, 7282, 6767, 22697, 6752,
+    0, 2, 43225, 734, 14910, 14746, 23657, 14007,
+    0, 2, 29979, 13, 19765, 24873, 26853, 21411,
+    8, 2, 36951, 236, 15604, 11370, 19820, 12379,
+    0, 2, 34162, 7, 11443, 27942, 16624, 33848,
+    0, 2, 28584, 433, 11443, 8148, 19820, 8825,
+    0, 2, 29979, 223, 8669, 13825, 18861, 15488,
+    0, 2, 17430, 170, 13592, 13365, 19820, 14451,
+    1, 2, 25099, 92, 17684, 14592, 21419, 14896,
+    4096, 2, 16035, 136, 16991, 17354, 19501, 19042,
+    0, 1, 23704, 3670, 16991, 13609, 23017, 13193,
+    2, 2, 47408, 433, 10056, 19502, 18542, 22003,
+    0, 2, 12549, 248, 13939, 13365, 19501, 14600,
+    0, 2, 55077, 144, 8669, 17661, 26853, 15192,
+    64, 2, 11852, 144, 13592, 10449, 10550, 16821,
+    1, 2, 50197, 354, 10749, 14439, 15984, 18153,
+    768, 2, 28584, 304, 12830, 16938, 21738, 17081,
+    1, 2, 33465, 248, 13939, 12904, 29411, 10454,
+    0, 2, 39739, 105, 14910, 14285, 18542, 16080,
+    1, 2, 32070, 39, 14078, 14746, 18222, 16969,
+    0, 2, 30676, 3, 9362, 21651, 22697, 21138,
+    1, 2, 30676, 273, 13592, 17508, 22697, 17117,
+    0, 2, 33465, 304, 13592, 17661, 19181, 19486,
+    513, 2, 32070, 64, 11443, 15053, 15025, 19486,
+    1, 2, 19521, 60, 15604, 14285, 11828, 21559,
+    256, 2, 48105, 682, 7282, 16741, 15984, 20818,
+    0, 2, 50894, 48, 13592, 24873, 43477, 14600,
+    3, 2, 30676, 144, 13592, 15820, 21738, 15932,
+    1, 2, 41134, 288, 13592, 11370, 11189, 17709,
+    0, 2, 48105, 5, 13592, 23952, 24296, 22299,
+    0, 2, 48105, 79, 16991, 14592, 24296, 13267,
+    257, 2, 31373, 236, 13592, 17354, 21099, 17857,
+    1, 2, 47408, 144, 10749, 14746, 20460, 15636,
+    0, 2, 47408, 273, 13592, 25026, 34206, 17857,
+    512, 2, 39042, 341, 4508, 17201, 22697, 16809,
+    4098, 0, 10458, 3801, 12830, 8455, 23976, 7936,
+    4096, 2, 36253, 248, 19071, 16615, 22697, 16239,
+    0, 2, 19521, 248, 13939, 16615, 22697, 16239,
+    0, 2, 59958, 1311, 1040, 6153, 11189, 9713,
+    66, 2, 39739, 66, 15604, 17201, 23017, 16672,
+    36, 2, 17430, 157, 27393, 25333, 41239, 15340,
+    32, 2, 27190, 20, 20458, 31778, 38362, 20670,
+    0, 2, 55077, 5, 13523, 21190, 24296, 19486,
+    1, 2, 43225, 354, 14910, 12291, 22697, 12032,
+    1, 2, 39739, 304, 13592, 11370, 19501, 12527,
+    0, 2, 49500, 0, 14078, 14592, 19820, 15784,
+    256, 2, 42528, 88, 13592, 16127, 22697, 15784,
+    0, 2, 14641, 248, 13939, 16615, 22697, 16239,
+    1, 2, 55077, 119, 4508, 14746, 21099, 15192,
+    66, 2, 52289, 46, 9362, 20883, 20460, 22003,
+    0, 2, 18824, 131, 16991, 20116, 27173, 17265,
+    258, 2, 28584, 9, 14910, 20730, 18222, 23632,
+    0, 2, 12549, 210, 10749, 13979, 24296, 12823,
+    1, 2, 30676, 236, 12830, 15666, 19820, 16969,
+    256, 1, 52986, 1573, 11720, 11370, 24296, 10454,
+    0, 2, 52986, 26, 10749, 12444, 18861, 14007,
+    2048, 2, 22310, 10, 13939, 18889, 23017, 18301,
+    17, 2, 43922, 119, 7282, 25640, 21738, 25705,
+    0, 2, 33465, 144, 8669, 16127, 17583, 18894,
+    0, 2, 39042, 472, 10749, 14746, 21099, 15192,
+    2, 2, 43225, 3, 10749, 18582, 19501, 20226,
+    512, 2, 32070, 5, 13523, 15513, 18861, 17413,
+    2, 2, 43225, 865, 14910, 15360, 18542, 17413,
+    1, 2, 50197, 262, 12830, 14746, 17583, 17265,
+    0, 2, 15338, 157, 10749, 15666, 18861, 17413,
+    16385, 2, 18127, 183, 15604, 19809, 21099, 20374,
+    0, 2, 64141, 304, 13592, 20577, 24296, 19042,
+    0, 2, 26493, 249, 13592, 13672, 23976, 12823,
+    0, 2, 40436, 367, 11443, 14439, 20140, 15488,
+    16384, 2, 41831, 288, 12136, 18428, 24296, 17117,
+    256, 2, 44620, 682, 13592, 15360, 37723, 10157,
+    256, 2, 58563, 957, 16297, 9682, 25894, 8677,
+    0, 2, 36951, 249, 13523, 13058, 21419, 13267,
+    0, 2, 30676, 75, 12136, 19196, 27493, 16228,
+    1, 2, 32768, 288, 14078, 7994, 18222, 9269,
+    128, 2, 50894, 16, 15604, 15820, 20460, 16672,
+    16, 2, 41134, 223, 11443, 16280, 17902, 18894,
+    0, 2, 23007, 590, 13592, 10910, 34526, 7640,
+    0, 2, 31373, 170, 13592, 18582, 23337, 17709,
+    1, 2, 58563, 210, 13592, 17047, 10550, 27333,
+    0, 2, 21613, 773, 7975, 7687, 16304, 9565,
+    1, 2, 13944, 144, 13592, 17201, 13746, 23632,
+    0, 2, 41134, 197, 13592, 23645, 24296, 21559,
+    1, 2, 50197, 183, 13939, 12904, 20460, 13711,
+    0, 2, 13246, 315, 21152, 20270, 22697, 19794,
+    257, 2, 40436, 721, 4508, 11370, 14705, 15044,
+    1, 2, 6972, 273, 19071, 13672, 22058, 13711,
+    1, 2, 51591, 170, 12136, 11523, 11828, 17561,
+    2, 2, 38345, 304, 13592, 25180, 40280, 15636,
+    0, 2, 46711, 131, 46811, 16280, 21738, 16376,
+    0, 2, 39042, 17, 13592, 29783, 19501, 32368,
+    1, 0, 34859, 13893, 2427, 1089, 26534, 933,
+    1, 2, 52289, 8, 26699, 28095, 21099, 28962,
+    1, 2, 14641, 367, 13523, 11063, 21738, 11188,
+    0, 2, 47408, 0, 11443, 17354, 22697, 16958,
+    0, 2, 52986, 9, 5895, 8915, 22697, 8677,
+    0, 1, 13944, 1114, 10749, 16741, 20140, 17857,
+    16, 2, 50894, 708, 9362, 16280, 17583, 19042,
+    0, 1, 50894, 826, 11443, 21958, 30050, 17265,
+    2, 2, 41831, 341, 13939, 16894, 17263, 20078,
+    256, 2, 42528, 472, 12136, 20883, 26534, 18153,
+    0, 2, 13944, 248, 13939, 15973, 25255, 14451,
+    5, 2, 36253, 304, 14078, 11063, 18542, 12527,
+    0, 2, 27190, 304, 13592, 10449, 23337, 10009,
+    2, 2, 48105, 20, 13939, 24413, 26853, 21263,
+    0, 2, 25099, 236, 13592, 17661, 19181, 19338,
+    0, 2, 25796, 1035, 32178, 18428, 0, 65535,
+    256, 2, 48803, 262, 20458, 14439, 27493, 12230,
+    272, 1, 33465, 4194, 14078, 12137, 14386, 16228,
+    0, 2, 39739, 39, 21152, 22725, 35804, 15636,
+    16, 1, 26493, 931, 11443, 15820, 21099, 16524,
+    0, 2, 33465, 4, 14078, 27635, 23657, 26149,
+    513, 2, 26493, 0, 19071, 22264, 25894, 19782,
+    1, 2, 42528, 273, 14078, 12904, 20779, 13563,
+    0, 2, 46711, 0, 12136, 21344, 24296, 19634,
+    1, 2, 50197, 52, 15604, 13979, 19820, 15192,
+    1, 2, 40436, 20, 19071, 12444, 22697, 12379,
+    4096, 2, 35556, 97, 26699, 22264, 39960, 14007,
+    1, 2, 29282, 248, 13939, 9529, 20779, 10009,
+    0, 2, 52986, 35, 13939, 16615, 22697, 16239,
+    257, 2, 50894, 577, 16297, 17201, 27493, 14600,
+    515, 2, 38345, 5, 13592, 20116, 12148, 29851,
+    259, 2, 41831, 157, 15604, 14285, 14066, 19338,
+    0, 2, 23007, 109, 13592, 18428, 27812, 15488,
+    259, 2, 39042, 2884, 16297, 16741, 21738, 16883,
+    512, 2, 53683, 75, 13592, 20730, 15345, 26593,
+    768, 2, 29979, 577, 12830, 12137, 19820, 12971,
+    0, 2, 38345, 9, 15604, 18582, 17263, 22003,
+    32, 2, 20218, 66, 14910, 18582, 32927, 13711,
+    2, 2, 38345, 183, 13592, 16587, 20779, 17265,
+    0, 2, 22310, 39, 14078, 16741, 22697, 16362,
+    0, 2, 16732, 249, 11443, 25180, 29731, 19930,
+    0, 2, 19521, 223, 13592, 18735, 25575, 16672,
+    16385, 2, 25099, 144, 16297, 15820, 22058, 15784,
+    0, 1, 28584, 1704, 12830, 8915, 17263, 10602,
+    0, 2, 47408, 104, 11443, 17661, 22697, 17265,
+    0, 2, 16035, 564, 13592, 21190, 46354, 11638,
+    32, 2, 42528, 81, 13592, 23185, 46993, 12675,
+    2, 2, 36951, 917, 13939, 14132, 22378, 14155,
+    0, 2, 20218, 100, 23232, 19349, 39960, 12082,
+    1, 2, 13246, 615, 20458, 16280, 24296, 14896,
+    1, 2, 20218, 419, 13939, 14439, 13107, 20522,
+    0, 2, 34859, 236, 12830, 14439, 23017, 14007,
+    272, 2, 48105, 273, 11443, 19656, 23017, 18894,
+    513, 2, 37648, 72, 14078, 11063, 23337, 10602,
+    1, 1, 45317, 931, 15604, 13365, 22378, 13267,
+    0, 2, 38345, 114, 12830, 17354, 22697, 16958,
+    1, 2, 34859, 76, 10749, 17201, 22697, 16809,
+    3, 2, 4880, 1218, 16297, 18889, 21738, 19042,
+    1, 2, 60655, 301, 14910, 15053, 23017, 14600,
+    0, 2, 26493, 288, 21845, 16127, 25255, 14451,
+    0, 2, 45317, 498, 12830, 17815, 23017, 17265,
+    2048, 2, 29979, 248, 13939, 16615, 22697, 16239,
+    0, 2, 41831, 682, 13592, 9529, 25255, 8677,
+    2, 2, 34859, 304, 13592, 17815, 21099, 18449,
+    2, 2, 32070, 39, 13592, 16894, 20140, 18153,
+    0, 2, 18127, 4, 14910, 13058, 19820, 14155,
+    1, 2, 23007, 223, 16297, 13979, 28132, 11638,
+    256, 2, 34162, 433, 12830, 16938, 28132, 15192,
+    4, 2, 38345, 304, 13592, 16280, 19501, 17709,
+    256, 0, 49500, 25165, 6311, 4344, 23657, 4149,
+    0, 2, 12549, 183, 12830, 16587, 25575, 14748,
+    1024, 2, 43922, 170, 13592, 18735, 21099, 19338,
+    16, 2, 43922, 304, 13592, 14899, 20140, 15932,
+    0, 2, 20915, 197, 13592, 11063, 15025, 14451,
+    0, 2, 56472, 248, 13939, 16615, 22697, 16239,
+    2, 2, 25099, 13, 12830, 23492, 21738, 23655,
+    1, 2, 25796, 52, 13523, 13518, 15984, 16969,
+    0, 2, 44620, 4, 13592, 22264, 23976, 20966,
+    768, 2, 41134, 3, 9362, 13365, 16943, 16080,
+    1, 2, 48105, 472, 14910, 13979, 16943, 16821,
+    1, 2, 41134, 119, 6588, 15206, 20140, 16228,
+    0, 2, 36951, 708, 10056, 15206, 21738, 15340,
+    0, 2, 28584, 8, 15604, 19502, 23976, 18301,
+    1, 2, 39739, 248, 10749, 16615, 22697, 16239,
+    16, 2, 50894, 393, 7975, 14285, 20779, 14896,
+    2, 2, 47408, 603, 13592, 27175, 37723, 17857,
+    515, 2, 51591, 48, 11443, 15053, 15664, 19042,
+    16385, 2, 31373, 236, 13592, 18428, 22697, 18005,
+    0, 2, 38345, 248, 14078, 16894, 21099, 17413,
+    0, 2, 31373, 183, 8669, 15513, 24296, 14303,
+    16385, 2, 52289, 341, 14910, 24413, 24296, 22743,
+    17409, 2, 30676, 328, 13592, 16127, 22378, 15932,
+    6, 2, 35556, 304, 13592, 15666, 17583, 18449,
+    1, 2, 40436, 301, 13523, 10910, 13107, 15488,
+    0, 2, 20915, 248, 13939, 16741, 22058, 16821,
+    0, 2, 51591, 79, 12136, 14746, 23976, 13859,
+    513, 2, 22310, 273, 26699, 17201, 24296, 15932,
+    256, 1, 48803, 3015, 12136, 12904, 21738, 13119,
+    1, 1, 45317, 983, 11443, 19042, 22058, 19042,
+    1, 2, 36253, 39, 7975, 15666, 20140, 16672,
+    2, 2, 29282, 304, 13592, 16938, 21738, 17081,
+    1, 2, 38345, 304, 13592, 16894, 20779, 17709,
+    0, 2, 23007, 248, 13939, 26868, 23017, 26001,
+    0, 2, 32070, 419, 28711, 18889, 26214, 16672,
+    1, 2, 33465, 223, 20458, 18735, 30690, 14600,
+    0, 2, 43922, 537, 13592, 11830, 20779, 12379,
+    0, 2, 25099, 183, 13523, 14746, 23657, 14007,
+    0, 0, 34162, 3670, 1040, 4619, 13427, 6604,
+    0, 2, 15338, 249, 10749, 13058, 19501, 14451,
+    0, 2, 28584, 0, 13592, 26868, 13746, 36810,
+    1, 2, 20915, 380, 13592, 16894, 15345, 21707,
+    16384, 2, 31373, 183, 10749, 12751, 14705, 16080,
+    5, 2, 16035, 304, 13592, 11370, 21419, 11638,
+    256, 2, 38345, 197, 13939, 15360, 25255, 14007,
+    16, 2, 25796, 288, 13939, 13825, 27812, 11638,
+    0, 2, 47408, 157, 15604, 15513, 22697, 15167,
+    1, 2, 11852, 301, 14078, 11677, 26214, 10306,
+    0, 2, 53683, 7, 8669, 15053, 22697, 14719,
+    2, 2, 13246, 3, 13592, 27481, 36764, 18449,
+    0, 2, 42528, 183, 13592, 17661, 23017, 17117,
+    256, 2, 43225, 97, 13939, 10910, 15664, 14007,
+    0, 2, 48803, 393, 13592, 13825, 15664, 17561,
+    0, 2, 48105, 5, 13592, 6613, 9590, 11342,
+    0, 2, 25796, 564, 11443, 11217, 22697, 10988,
+    4096, 2, 52289, 94, 13592, 19656, 20140, 20818,
+    0, 2, 16035, 236, 16297, 13672, 18222, 15636,
+    256, 0, 43922, 4981, 7975, 8762, 23976, 8233,
+    258, 2, 20218, 31, 12136, 28402, 21738, 28580,
+    1, 2, 29979, 393, 13523, 17201, 26214, 15044,
+    0, 2, 37648, 236, 13939, 12444, 21419, 12675,
+    256, 1, 41134, 1075, 11443, 9529, 21738, 9713,
+    0, 2, 46711, 170, 16297, 12137, 20140, 12971,
+    0, 2, 57866, 304, 13592, 16938, 21738, 17081,
+    0, 2, 51591, 157, 10056, 19196, 19501, 20966,
+    2, 2, 26493, 904, 10749, 18735, 23657, 17857,
+    16385, 2, 23704, 13, 19071, 20730, 27173, 17709,
+    0, 2, 39739, 7, 17684, 19809, 23976, 18597,
+    0, 0, 34859, 13893, 3814, 322, 19501, 459,
+    256, 1, 22310, 2097, 11443, 11063, 23017, 10738,
+    0, 2, 29979, 54, 5201, 15666, 17263, 18449,
+    8, 2, 13246, 3, 17684, 15820, 20140, 16821,
+    0, 2, 33465, 100, 12830, 14746, 29091, 11934,
+    1, 2, 25796, 71, 11443, 16894, 21099, 17413,
+    0, 2, 31373, 13, 4508, 10143, 15664, 12823,
+    3, 2, 43225, 13, 13939, 11830, 17902, 13711,
+    0, 2, 43922, 433, 10056, 15206, 21419, 15636,
+    0, 2, 55774, 328, 12136, 11217, 23657, 10750,
+    0, 0, 46711, 8651, 6311, 3851, 25255, 3494,
+    0, 2, 41831, 80, 10749, 15360, 20779, 16080,
+    0, 2, 25796, 66, 32178, 25947, 49551, 13563,
+    2, 2, 36253, 354, 13592, 17508, 21419, 17857,
+    16385, 2, 36951, 354, 13592, 20883, 25575, 18745,
+    0, 2, 34859, 304, 13592, 16938, 21738, 17081,
+    0, 2, 55077, 123, 7282, 19963, 17583, 23336,
+    17408, 2, 15338, 183, 19071, 12904, 27493, 12527,
+    16385, 2, 25099, 79, 14078, 22264, 29091, 18005,
+    0, 2, 56472, 197, 13592, 12751, 16624, 15636,
+    1, 2, 17430, 210, 15604, 17201, 18222, 19782,
+    0, 2, 50197, 236, 10749, 16434, 22378, 16228,
+    0, 1, 26493, 3146, 12830, 9529, 23017, 9259,
+    1, 2, 27887, 304, 13592, 16938, 21738, 17081,
+    2, 2, 50894, 37, 8669, 20730, 17583, 24224,
+    1, 2, 36951, 94, 13592, 17968, 22058, 17857,
+    1, 2, 32768, 236, 15604, 13211, 17583, 15488,
+    0, 2, 25099, 131, 15604, 13211, 21099, 13711,
+    0, 0, 54380, 3801, 10749, 6767, 22058, 6752,
+    4, 2, 33465, 13, 18378, 21190, 28132, 17413,
+    3, 2, 43922, 4, 13592, 9529, 17263, 11490,
+    0, 2, 47408, 197, 6588, 25487, 21738, 25656,
+    0, 2, 36951, 236, 13592, 17201, 22378, 16969,
+    1281, 2, 13246, 52, 15604, 19809, 17583, 23187,
+    0, 2, 43225, 695, 13523, 21344, 27812, 17857,
+    2, 2, 45317, 39, 10749, 17968, 20140, 19190,
+    0, 2, 17430, 248, 13939, 16615, 22697, 16239,
+    1, 2, 32070, 248, 13939, 16615, 22697, 16239,
+    0, 2, 39042, 39, 14910, 14592, 15664, 18449,
+    2, 2, 49500, 197, 13592, 11677, 21738, 11786,
+    0, 2, 53683, 66, 12830, 11984, 17583, 14155,
+    0, 2, 43922, 131, 14910, 14746, 25255, 13267,
+    0, 2, 17430, 26, 35021, 28249, 28132, 23336,
+    0, 2, 48803, 210, 13523, 11984, 15345, 15340,
+    8, 0, 52289, 4325, 16297, 9375, 28132, 7788,
+    648, 2, 45317, 12, 23232, 23032, 65535, 9417,
+    2, 2, 33465, 79, 15604, 16894, 23657, 16080,
+    1, 2, 21613, 380, 13523, 13058, 17902, 15192,
+    2, 2, 22310, 1, 16297, 20883, 21738, 21115,
+    0, 2, 11155, 144, 13939, 23185, 33886, 16672,
+    0, 2, 14641, 39, 20458, 24259, 46674, 13415,
+    0, 2, 29979, 446, 10749, 15973, 27812, 13415,
+    0, 2, 45317, 288, 13523, 13365, 19820, 14451,
+    1, 2, 57169, 315, 7975, 14746, 19181, 16228,
+    2, 2, 29282, 304, 13592, 8762, 30050, 7048,
+    4096, 2, 25796, 93, 29473, 19349, 42838, 11342,
+    2, 2, 19521, 1966, 13939, 16894, 27173, 14451,
+    16640, 2, 43225, 26, 7282, 28249, 21419, 28814,
+    0, 2, 23704, 197, 13523, 13825, 23337, 13415,
+    0, 2, 39042, 249, 13939, 12598, 16304, 15636,
+    66, 2, 16732, 144, 17684, 32085, 46993, 17561,
+    0, 2, 44620, 615, 10749, 10603, 18222, 12230,
+    0, 2, 34859, 131, 12830, 13518, 23976, 12823,
+    1, 2, 42528, 93, 14910, 13518, 21099, 13859,
+    0, 2, 48105, 90, 12830, 19349, 23657, 18301,
+    0, 2, 41831, 472, 13939, 19349, 27493, 16524,
+    1, 2, 44620, 446, 12830, 13825, 22058, 13859,
+    1, 2, 43922, 341, 11443, 12598, 22697, 12331,
+    1, 2, 37648, 419, 13592, 16587, 23657, 15784,
+    1, 2, 20915, 249, 13592, 16127, 21099, 16672,
+    17, 1, 44620, 3015, 11443, 11523, 20460, 12230,
+    0, 2, 16035, 236, 14078, 13518, 20779, 14155,
+    2, 2, 35556, 315, 13592, 18121, 19181, 20078,
+    514, 2, 48803, 66, 13939, 18889, 23657, 18005,
+    0, 2, 54380, 197, 14910, 15206, 19820, 16376,
+    0, 2, 57169, 328, 10056, 13518, 16943, 16376,
+    522, 2, 38345, 786, 13592, 16434, 23976, 15488,
+    0, 2, 18127, 3, 36408, 41291, 22058, 41252,
+    16385, 2, 31373, 118, 7975, 14439, 20140, 15488,
+    0, 2, 64838, 446, 5895, 15820, 27493, 13415,
+    0, 2, 36951, 183, 13592, 15206, 26214, 13415,
+    1, 2, 11155, 105, 13592, 11370, 20140, 12230,
+    1, 2, 12549, 472, 11443, 11217, 15984, 14155,
+    0, 2, 53683, 328, 10056, 19196, 21738, 19345,
+    2, 2, 48803, 26, 10749, 18275, 16943, 22151,
+    258, 2, 33465, 273, 13592, 17047, 18222, 19634,
+    1, 2, 23704, 341, 16991, 24259, 31329, 18597,
+    0, 2, 36253, 406, 16297, 12904, 21099, 13415,
+    0, 2, 55077, 273, 9362, 16587, 22058, 16672,
+    2, 2, 39739, 64, 13939, 25947, 27812, 21855,
+    2, 2, 49500, 210, 14910, 19196, 26853, 16524,
+    1, 2, 45317, 328, 347, 5232, 7672, 10157,
+    0, 2, 29282, 248, 13939, 16615, 22697, 16239,
+    1, 2, 27887, 262, 19071, 16434, 27493, 14007,
+    1, 2, 39739, 66, 23232, 13518, 22058, 13563,
+    0, 2, 65535, 210, 13592, 14592, 20140, 15636,
+    0, 2, 13246, 197, 16297, 20577, 34206, 14600,
+    1, 1, 16732, 1152, 14910, 16280, 22058, 16376,
+    0, 2, 12549, 472, 11443, 15206, 21738, 15343,
+    1, 2, 41134, 58, 11443, 17201, 18861, 19338,
+    1, 2, 44620, 354, 15604, 14899, 26534, 12971,
+    1, 2, 54380, 144, 4508, 17354, 18222, 19930,
+    0, 2, 36951, 248, 13939, 16615, 22697, 16239,
+    0, 2, 53683, 210, 5895, 15206, 13746, 20966,
+    0, 2, 37648, 106, 1734, 8915, 8312, 16376,
+    0, 2, 14641, 183, 26006, 26714, 46993, 14600,
+    6146, 2, 22310, 157, 14910, 17508, 21099, 18301,
+    0, 2, 11852, 304, 13592, 9682, 15984, 12230,
+    0, 2, 29282, 328, 17684, 14132, 24296, 12971,
+    2, 2, 43922, 288, 13592, 16587, 22058, 16524,
+    1, 2, 48803, 419, 12136, 12751, 16943, 15340,
+    386, 2, 53683, 157, 7975, 12137, 23337, 11638,
+    0, 2, 34859, 38, 13939, 14592, 23976, 13711,
+    1, 2, 48803, 288, 7975, 19042, 19501, 20818,
+    1, 2, 45317, 262, 14078, 16127, 21738, 16228,
+    1, 2, 50894, 144, 11443, 11830, 21419, 12082,
+    3, 2, 37648, 9, 13592, 13672, 9590, 22891,
+    130, 2, 47408, 170, 11443, 17354, 21419, 17709,
+    0, 2, 29282, 109, 22538, 21651, 28132, 17709,
+    2, 2, 19521, 917, 13939, 14592, 18222, 16524,
+    16385, 2, 43922, 170, 16297, 16587, 27812, 14007,
+    4100, 2, 38345, 682, 13939, 20577, 31968, 15488,
+    2, 2, 19521, 66, 17684, 23645, 32927, 17413,
+    0, 2, 50197, 590, 21152, 16280, 25894, 14451,
+    513, 2, 28584, 5, 21152, 17815, 16624, 21707,
+    0, 2, 25796, 8, 22538, 14132, 20140, 15044,
+    0, 2, 52289, 89, 13523, 15973, 22058, 15932,
+    2, 2, 34162, 4, 13592, 24873, 19820, 26593,
+    1, 2, 38345, 100, 15604, 13365, 21099, 13859,
+    0, 2, 37648, 37, 14078, 17354, 27493, 14748,
+    0, 2, 25099, 157, 13523, 15360, 25894, 13711,
+    513, 2, 24401, 4, 27393, 26868, 27493, 22743,
+    1, 2, 51591, 249, 9362, 11677, 16304, 14600,
+    0, 2, 27887, 157, 13592, 16434, 23017, 15932,
+    0, 2, 12549, 328, 18378, 20577, 27493, 17413,
+    0, 2, 52289, 5, 5895, 14899, 23337, 14451,
+    16, 2, 54380, 380, 5201, 10910, 14066, 14896,
+    2, 2, 53683, 826, 8669, 17968, 26534, 15784,
+    2, 2, 32070, 33, 16297, 22571, 26214, 19782,
+    2, 2, 29979, 4, 13592, 28556, 23017, 27778,
+    0, 2, 33465, 249, 12136, 11984, 20140, 12675,
+    1, 2, 9761, 304, 13592, 17661, 31968, 13415,
+    258, 2, 11852, 97, 15604, 21497, 27812, 18005,
+    256, 2, 57169, 354, 8669, 14899, 17583, 17561,
+    0, 2, 15338, 304, 14910, 18889, 28132, 15784,
+    0, 2, 43922, 48, 17684, 16127, 25255, 14600,
+    1, 2, 49500, 273, 13592, 13365, 19501, 14748,
+    512, 2, 23007, 0, 13523, 7841, 44116, 4531,
+    2, 2, 41134, 24, 14078, 19809, 26214, 17413,
+    1, 2, 31373, 105, 14078, 16127, 20140, 17265,
+    2, 2, 47408, 10, 13592, 17047, 5435, 37106,
+    0, 2, 18824, 236, 11443, 17968, 20140, 19190,
+    1, 2, 51591, 183, 14078, 17201, 22058, 17265,
+    520, 2, 13246, 4, 13523, 13672, 23976, 12823,
+    4609, 2, 29979, 304, 13592, 16938, 21738, 17081,
+    0, 2, 19521, 248, 9362, 11217, 9271, 19190,
+    0, 0, 55774, 64749, 3121, 1396, 35485, 977,
+    0, 2, 46014, 301, 9362, 18582, 18542, 20966,
+    512, 2, 22310, 26, 10056, 23645, 20140, 25112,
+    0, 2, 25099, 549, 14910, 21344, 21738, 21500,
+    513, 2, 28584, 9, 13523, 14746, 18542, 16672,
+    0, 2, 39042, 0, 24619, 21651, 17902, 24964,
+    17, 2, 49500, 236, 11443, 17047, 23976, 16080,
+    17, 2, 50894, 157, 13592, 11830, 21419, 12082,
+    2, 2, 29282, 1, 13939, 25794, 22378, 25409,
+    2, 2, 12549, 865, 12136, 18275, 28132, 15044,
+    1, 2, 25099, 197, 20458, 17047, 20779, 17709,
+    0, 2, 6972, 248, 13939, 13211, 19501, 14451,
+    0, 2, 23704, 655, 13592, 13825, 22697, 13415,
+    0, 1, 40436, 891, 12830, 13365, 22378, 13267,
+    0, 2, 51591, 341, 13592, 7687, 8312, 14155,
+    1, 2, 36253, 249, 17684, 17661, 26214, 15488,
+    1, 2, 47408, 248, 13939, 16280, 23976, 15340,
+    256, 1, 42528, 983, 11443, 11984, 23976, 11342,
+    1, 2, 37648, 183, 12136, 15360, 19501, 16672,
+    0, 2, 47408, 236, 16297, 19809, 29731, 15784,
+    16384, 2, 30676, 123, 13523, 15206, 18542, 17265,
+    0, 2, 41831, 5, 5201, 10910, 15025, 14303,
+    0, 2, 27190, 367, 10749, 11063, 15345, 14303,
+    0, 2, 32768, 9, 38489, 44360, 22378, 43769,
+    1, 2, 33465, 642, 4508, 12137, 16304, 15044,
+    0, 2, 52986, 236, 7282, 19656, 24296, 18301,
+    0, 2, 40436, 248, 13939, 10603, 20460, 11194,
+    0, 2, 56472, 197, 13592, 17354, 20460, 18301,
+    16385, 2, 36951, 119, 12136, 18735, 14705, 24668,
+    2, 2, 42528, 52, 16991, 19349, 24296, 18005,
+    0, 2, 18127, 197, 14910, 27481, 34845, 19338,
+    0, 2, 31373, 8, 13592, 17508, 18542, 19782,
+    2, 2, 55077, 288, 13592, 16587, 19181, 18449,
+    4128, 2, 17430, 54, 13592, 26714, 38682, 17265,
+    0, 1, 34162, 996, 11443, 19196, 25575, 17117,
+    0, 2, 43225, 248, 13939, 16615, 22697, 16239,
+    0, 2, 20218, 7, 13592, 28249, 14066, 38439,
+    517, 2, 16732, 33, 23232, 15053, 22697, 14719,
+    2, 2, 28584, 7, 13523, 19349, 23657, 18301,
+    0, 2, 35556, 249, 13592, 15513, 16624, 18894,
+    4096, 2, 26493, 248, 13939, 16615, 22697, 16239,
+    0, 2, 39042, 223, 12830, 12904, 26853, 11194,
+    1, 2, 45317, 328, 10056, 11370, 21738, 11496,
+    512, 2, 21613, 13, 12830, 18889, 15345, 23780,
+    0, 2, 61352, 33, 7975, 10296, 24296, 9417,
+    257, 2, 46014, 223, 13939, 12137, 19501, 13267,
+    512, 0, 23704, 30146, 10056, 5079, 33886, 3642,
+    256, 2, 20218, 341, 11443, 12137, 23976, 11342,
+    1, 2, 48105, 183, 14078, 13518, 22697, 13267,
+    0, 2, 49500, 655, 13939, 15053, 19181, 16672,
+    1, 2, 36951, 273, 13523, 13672, 23017, 13267,
+    1, 2, 21613, 130, 16991, 15053, 22378, 14896,
+    0, 2, 14641, 223, 11443, 12598, 20460, 13267,
+    1, 2, 40436, 92, 19071, 12904, 23017, 12527,
+    1, 2, 38345, 248, 14910, 10910, 18542, 12379,
+    1, 2, 38345, 3, 13523, 20883, 17263, 24816,
+    0, 2, 32070, 249, 16297, 15206, 32927, 11194,
+    2, 2, 45317, 26, 16991, 21344, 31009, 16376,
+    0, 2, 18824, 249, 10056, 15206, 16624, 18597,
+    0, 2, 50894, 43, 15604, 14746, 22378, 14600,
+    256, 2, 23704, 485, 19071, 28709, 35804, 19782,
+    1, 2, 35556, 498, 10056, 16587, 14386, 22151,
+    0, 2, 25099, 117, 13592, 17661, 20140, 18894,
+    4, 2, 42528, 170, 13592, 10449, 14066, 14303,
+    16384, 2, 27887, 183, 13592, 15053, 23337, 14451,
+    1, 2, 39739, 85, 20458, 13672, 21419, 13267,
+    2, 2, 34162, 13, 13592, 24566, 19501, 26593,
+    7, 2, 36951, 304, 13592, 13058, 18861, 14451,
+    256, 2, 55774, 301, 16297, 23339, 27173, 19930,
+    64, 2, 21613, 537, 13939, 17508, 39321, 11194,
+    0, 2, 36951, 406, 26006, 23645, 39641, 14896,
+    1, 2, 34162, 380, 13592, 16938, 21738, 17081,
+    0, 2, 15338, 33, 9362, 16894, 21738, 17037,
+    0, 2, 13944, 210, 14078, 14285, 18222, 16228,
+    528, 2, 57169, 197, 13592, 23952, 22378, 23632,
+    0, 2, 32070, 262, 13939, 17047, 19501, 18745,
+    16385, 2, 13246, 131, 16297, 24873, 22058, 24816,
+    4096, 2, 50197, 0, 24619, 17815, 19820, 19338,
+    0, 2, 52986, 301, 11443, 13672, 21738, 13859,
+    1, 2, 36951, 315, 14910, 17354, 23976, 16228,
+    1, 1, 45317, 904, 11443, 14132, 24296, 12971,
+    0, 0, 18824, 7078, 14078, 7227, 26214, 6456,
+    1, 2, 39739, 125, 13592, 17968, 25575, 15932,
+    1025, 2, 24401, 301, 13592, 14132, 20140, 15044,
+    2, 2, 41831, 1442, 16297, 8608, 19181, 9565,
+    258, 2, 25099, 3146, 10749, 14132, 18542, 15932,
+    0, 2, 55077, 127, 11443, 12291, 22058, 12379,
+    258, 2, 36253, 511, 13939, 17047, 28132, 14007,
+    544, 2, 23007, 4, 28711, 20116, 43797, 11638,
+    1, 2, 40436, 197, 14078, 11370, 14066, 15488,
+    17408, 2, 27887, 144, 13592, 15360, 22697, 15044,
+    0, 2, 20218, 90, 13592, 13979, 26214, 12379,
+    0, 2, 6275, 328, 13592, 12291, 20779, 12823,
+    4098, 2, 40436, 37, 13592, 17047, 21099, 17561,
+    16385, 2, 15338, 87, 15604, 17047, 19181, 18745,
+    0, 2, 38345, 262, 6588, 7841, 15984, 10009,
+    259, 2, 45317, 655, 13523, 15820, 24296, 14600,
+    2, 2, 43922, 2228, 13592, 16280, 23337, 15636,
+    0, 2, 43225, 642, 12830, 13365, 22378, 13267,
+    0, 2, 15338, 3, 23232, 13518, 26214, 11934,
+    0, 2, 49500, 59, 16991, 18889, 25575, 16969,
+    1, 2, 48803, 301, 4508, 16127, 13107, 22743,
+    256, 2, 36951, 144, 13592, 21958, 25575, 19782,
+    16385, 2, 20915, 157, 18378, 14746, 19181, 16376,
+    0, 2, 15338, 144, 13592, 12904, 22058, 12971,
+    2048, 2, 37648, 56, 13592, 15973, 22378, 15784,
+    0, 2, 43225, 9, 7282, 21804, 18861, 24372,
+    0, 2, 52986, 380, 17684, 17661, 29091, 14303,
+    256, 1, 36951, 852, 12830, 13058, 23657, 12379,
+    65, 2, 33465, 393, 14910, 13518, 18542, 15192,
+    259, 2, 43225, 1060, 13939, 12137, 13107, 17265,
+    0, 2, 32768, 210, 10749, 21037, 23337, 20078,
+    1, 2, 23007, 10, 28086, 17201, 21738, 17413,
+    0, 2, 34859, 380, 10056, 18582, 19181, 20522,
+    512, 2, 59958, 26, 23232, 24719, 17263, 29258,
+    0, 2, 19521, 0, 13592, 26868, 41239, 16524,
+    0, 2, 29979, 773, 16297, 8915, 22697, 8749,
+    16384, 0, 56472, 9568, 6588, 3391, 22697, 3346,
+    2, 2, 20218, 183, 13592, 21497, 22058, 21411,
+    16, 2, 27190, 170, 13592, 22878, 39001, 14748,
+    256, 2, 36253, 1, 13939, 26561, 23657, 24964,
+    16385, 2, 32768, 157, 16297, 18275, 24296, 16969,
+    1024, 2, 19521, 564, 25312, 18582, 37723, 12230,
+    1, 2, 27887, 236, 10056, 18428, 21738, 18575,
+    3, 2, 43225, 328, 12136, 13979, 19181, 15488,
+    0, 2, 13246, 367, 13592, 28402, 48911, 15044,
+    0, 2, 30676, 511, 13592, 11830, 15025, 15488,
+    16385, 2, 23007, 288, 15604, 14746, 16304, 18153,
+    1, 2, 49500, 695, 6588, 14439, 11828, 21855,
+    1, 2, 36951, 433, 13939, 22111, 25255, 20078,
+    6, 2, 41134, 248, 11443, 11063, 23976, 10306,
+    512, 2, 51591, 96, 14910, 15820, 14705, 20818,
+    0, 2, 49500, 197, 16297, 16741, 23657, 15932,
+    1, 2, 52289, 354, 12136, 14746, 16624, 18005,
+    1, 2, 35556, 262, 12136, 12751, 18542, 14600,
+    1, 2, 36951, 157, 12830, 13211, 18222, 15044,
+    2, 2, 25099, 71, 16991, 25640, 35804, 17561,
+    0, 2, 25099, 249, 13592, 16127, 20779, 16821,
+    1, 2, 18824, 3, 40569, 27635, 17263, 32664,
+    4096, 2, 20915, 248, 24619, 26561, 36764, 17857,
+    0, 2, 39042, 304, 13592, 24106, 24296, 22151,
+    640, 2, 29282, 459, 11443, 14746, 27493, 12527,
+    0, 0, 58563, 25821, 6311, 1703, 10869, 3050,
+    1, 2, 40436, 367, 12136, 15053, 25255, 13563,
+    512, 2, 33465, 3, 25312, 26868, 21738, 27042,
+    1, 2, 43225, 39, 5201, 10910, 18222, 12527,
+    0, 1, 59260, 1704, 11720, 12904, 20460, 13563,
+    0, 2, 45317, 262, 13523, 26714, 28132, 21855,
+    0, 2, 25796, 341, 13523, 12751, 18542, 14451,
+    0, 2, 41134, 144, 13939, 13365, 25255, 12082,
+    512, 1, 50197, 957, 14078, 20883, 27812, 17561,
+    0, 2, 25099, 183, 11443, 10449, 14066, 14303,
+    4096, 0, 39739, 7733, 12830, 5386, 27173, 4679,
+    16386, 2, 40436, 273, 14078, 15973, 20779, 16672,
+    0, 2, 20915, 393, 14078, 12751, 22697, 12379,
+    0, 2, 54380, 354, 13592, 12291, 17902, 14303,
+    129, 2, 41134, 85, 13592, 17047, 21419, 17413,
+    2049, 2, 22310, 73, 16297, 14439, 21738, 14574,
+    512, 2, 37648, 4, 30167, 29476, 17263, 34737,
+    0, 2, 42528, 273, 13592, 13365, 18861, 14896,
+    1, 2, 42528, 304, 7282, 14285, 21099, 14748,
+    1, 2, 39739, 170, 15604, 11370, 22697, 11138,
+    0, 2, 26493, 304, 13592, 13211, 28132, 10898,
+    1, 2, 49500, 144, 12136, 18889, 16943, 22743,
+    0, 2, 47408, 45, 5895, 22571, 19820, 24372,
+    512, 2, 44620, 262, 18378, 18121, 22058, 18153,
+    1, 0, 33465, 12583, 2427, 0, 29411, 0,
+    17, 2, 47408, 183, 12830, 20423, 18222, 23187,
+    0, 2, 20915, 304, 13592, 11984, 18222, 13711,
+    3, 2, 34859, 0, 19071, 19809, 21419, 20226,
+    0, 2, 52986, 288, 13592, 10603, 15025, 13859,
+    1, 2, 36951, 304, 13592, 16938, 21738, 17081,
+    2, 2, 40436, 4, 13523, 24719, 20460, 26001,
+    1, 2, 41831, 288, 11443, 11677, 15984, 14600,
+    256, 2, 39739, 170, 12830, 9682, 21738, 9713,
+    513, 2, 48105, 419, 6588, 12598, 9590, 20966,
+    2, 2, 11155, 1966, 12136, 19809, 19501, 21559,
+    16385, 2, 18824, 406, 18378, 14899, 20779, 15636,
+    0, 2, 55077, 288, 3814, 11830, 13427, 16672,
+    0, 2, 47408, 248, 10056, 16615, 22697, 16239,
+    3, 2, 41831, 33, 16991, 15053, 23017, 14600,
+    0, 2, 39042, 524, 13592, 16741, 33567, 12082,
+    0, 2, 19521, 210, 18378, 12904, 18222, 14748,
+    0, 2, 32070, 79, 13523, 21344, 23017, 20670,
+    0, 2, 31373, 380, 7975, 15053, 25255, 13563,
+    1, 2, 28584, 131, 16297, 19196, 26534, 16672,
+    513, 2, 28584, 8, 13523, 11677, 16943, 14155,
+    2, 2, 51591, 33, 14078, 25947, 23337, 24964,
+    0, 2, 42528, 144, 12830, 16894, 27493, 14303,
+    1, 2, 38345, 248, 13939, 16615, 22697, 16239,
+    0, 2, 18127, 210, 16297, 18121, 30370, 14155,
+    0, 2, 20915, 249, 18378, 14746, 23017, 14303,
+    1, 2, 29282, 549, 13592, 13825, 11509, 21263,
+    1025, 2, 24401, 93, 11443, 13825, 19181, 15340,
+    513, 2, 19521, 3, 39182, 25947, 18542, 29258,
+    0, 2, 46014, 26, 10749, 13365, 22058, 13415,
+    0, 2, 24401, 127, 13592, 15053, 15664, 19042,
+    0, 2, 20915, 1022, 13523, 23952, 39321, 15192,
+    0, 1, 11852, 1573, 11720, 21344, 34845, 15044,
+    16385, 2, 26493, 786, 13592, 20270, 21738, 20522,
+    16385, 2, 39042, 210, 13523, 12904, 10550, 20818,
+    1, 2, 52986, 262, 13592, 14439, 16304, 17857,
+    0, 2, 40436, 97, 14910, 14132, 17902, 16376,
+    256, 1, 43225, 852, 4508, 12751, 14066, 17413,
+    0, 2, 50894, 629, 11443, 19502, 23657, 18597,
+    513, 2, 9761, 248, 13939, 16615, 22697, 16239,
+    0, 2, 38345, 26, 14910, 16127, 19181, 17709,
+    0, 2, 26493, 223, 13592, 15513, 29731, 12527,
+    1, 2, 44620, 98, 7282, 11523, 13746, 15932,
+    80, 2, 36951, 249, 15604, 24259, 24296, 22595,
+    1, 2, 21613, 406, 14078, 13058, 13427, 18153,
+    0, 2, 27887, 144, 13592, 15206, 25255, 13711,
+    0, 2, 41134, 367, 13592, 10449, 15345, 13415,
+    16, 2, 46014, 223, 4508, 11677, 15664, 14748,
+    0, 2, 56472, 66, 3814, 20883, 18542, 23484,
+    1, 2, 41134, 4063, 15604, 35767, 23657, 33848,
+    1, 2, 31373, 33, 13523, 16741, 23337, 16080,
+    0, 2, 50197, 249, 13592, 17815, 19820, 19190,
+    0, 2, 20218, 564, 13523, 12137, 22697, 11884,
+    0, 2, 19521, 89, 13523, 21344, 24296, 19634,
+    2, 2, 34162, 87, 13939, 19042, 22058, 19042,
+    0, 2, 33465, 170, 10749, 18889, 18861, 21115,
+    1, 2, 41134, 157, 3814, 15360, 23337, 14748,
+    1024, 1, 37648, 944, 11443, 15820, 17583, 18597,
+    16385, 2, 22310, 170, 14910, 17968, 21738, 18301,
+    20480, 2, 12549, 52, 16297, 15360, 20140, 16524,
+    0, 1, 50894, 1218, 16297, 17508, 25255, 15636,
+    16385, 2, 44620, 210, 12136, 11523, 20460, 12230,
+    256, 0, 22310, 1349, 13523, 9989, 27812, 8381,
+    256, 0, 45317, 2621, 6311, 6000, 22378, 6012,
+    1, 2, 41134, 39, 12136, 17047, 23017, 16524,
+    1, 2, 41134, 760, 12136, 14592, 18861, 16228,
+    0, 2, 20915, 144, 13523, 14592, 17902, 16969,
+    2, 2, 25099, 236, 14078, 27788, 36124, 18894,
+    0, 2, 52986, 105, 9362, 18582, 29411, 14896,
+    16, 2, 41134, 106, 10749, 14746, 21738, 14882,
+    0, 2, 50197, 3146, 13592, 36995, 60100, 16376,
+    32, 2, 21613, 33, 16991, 15666, 24296, 14451,
+    0, 2, 32070, 354, 13592, 12137, 23337, 11786,
+    0, 2, 20915, 157, 14910, 15360, 20460, 16228,
+    0, 2, 46014, 273, 12136, 14592, 21738, 14728,
+    257, 2, 38345, 354, 13592, 18735, 24296, 17265,
+    512, 2, 21613, 367, 8669, 12751, 19501, 13859,
+    546, 2, 21613, 39, 20458, 15053, 27493, 12823,
+    1, 2, 16035, 170, 11443, 15820, 23017, 15340,
+    1, 2, 26493, 131, 16297, 14592, 25575, 13119,
+    528, 2, 51591, 92, 13592, 21958, 21738, 22151,
+    256, 2, 40436, 367, 13939, 20116, 24296, 18597,
+    3, 2, 42528, 21, 14078, 11370, 19820, 12379,
+    1, 2, 36253, 433, 10056, 5539, 18222, 6456,
+    0, 2, 28584, 249, 13592, 18735, 15984, 23336,
+    16384, 2, 26493, 104, 12830, 15973, 22697, 15636,
+    544, 2, 23007, 4, 16991, 17815, 40600, 10898,
+    0, 2, 37648, 7, 46811, 25487, 17902, 29406,
+    4128, 2, 13944, 315, 23925, 25794, 38682, 16672,
+    16657, 1, 30676, 1311, 1734, 9836, 23017, 9555,
+    32, 2, 23007, 5, 19765, 21651, 41559, 13119,
+    1, 2, 24401, 170, 12830, 9068, 15664, 11638,
+    1, 1, 38345, 1573, 9362, 9836, 13746, 13563,
+    256, 2, 48105, 223, 6588, 16741, 23657, 15932,
+    16, 2, 49500, 248, 13939, 16615, 22697, 16239,
+    1, 2, 39042, 98, 5895, 12137, 10869, 19338,
+    1, 2, 43922, 119, 13592, 19963, 24296, 18153,
+    0, 1, 19521, 917, 11720, 16741, 25575, 14896,
+    0, 2, 24401, 249, 6588, 11370, 18542, 12971,
+    2, 2, 23704, 380, 13592, 14899, 22378, 14748,
+    771, 2, 19521, 25, 11443, 22111, 21738, 22269,
+    1, 2, 29979, 367, 15604, 19349, 30690, 14896,
+    1, 2, 25099, 273, 13592, 12751, 15664, 16228,
+    0, 2, 45317, 197, 13592, 11523, 13427, 16080,
+    0, 2, 34162, 406, 12830, 11370, 16624, 14007,
+    257, 2, 19521, 301, 12830, 14899, 20779, 15488,
+    0, 2, 48803, 549, 13592, 16741, 19501, 18301,
+    0, 2, 19521, 144, 26006, 24259, 46674, 13415,
+    1, 2, 50894, 433, 12136, 14592, 17583, 17117,
+    0, 2, 19521, 26, 18378, 15360, 22697, 15019,
+    0, 2, 36951, 33, 19765, 15053, 23017, 14451,
+    513, 2, 25099, 85, 8669, 20423, 29091, 16672,
+    2, 2, 27887, 1966, 11443, 17815, 22697, 17413,
+    1, 0, 46711, 7209, 3814, 1857, 19501, 2162,
+    1, 2, 10458, 248, 16991, 10449, 16624, 12675,
+    257, 2, 25796, 511, 14910, 8915, 15345, 11490,
+    256, 2, 34162, 629, 3814, 14592, 16624, 17709,
+    1, 2, 32070, 170, 13939, 14592, 27493, 12379,
+    0, 2, 49500, 79, 13523, 15820, 24296, 14600,
+    0, 2, 46014, 537, 12830, 15513, 22058, 15488,
+    16385, 2, 23007, 109, 16297, 17047, 23657, 16228,
+    256, 2, 52289, 249, 9362, 9836, 11828, 14896,
+    0, 2, 18127, 68, 15604, 15206, 21099, 15784,
+    17, 2, 50197, 419, 10056, 10143, 16624, 12379,
+    1, 2, 50894, 197, 12136, 14285, 20140, 15340,
+    2, 2, 37648, 8, 13592, 22725, 14386, 30295,
+    0, 2, 18824, 67, 13592, 30704, 53387, 15044,
+    0, 2, 55774, 12, 3814, 22878, 15025, 29702,
+    0, 2, 19521, 144, 17684, 14746, 20779, 15340,
+    128, 0, 16732, 4456, 6311, 1703, 23976, 1570,
+    1, 2, 21613, 197, 19071, 19963, 19501, 21707,
+    1, 0, 34162, 19792, 6588, 4465, 28132, 3791,
+    2, 2, 39042, 13, 14910, 22571, 23337, 21707,
+    0, 2, 45317, 419, 10749, 18889, 23657, 17857,
+    0, 2, 45317, 273, 19071, 22264, 38682, 14303,
+    512, 1, 41831, 839, 16297, 21190, 31329, 16228,
+    0, 2, 46014, 249, 16991, 15206, 20779, 15932,
+    16385, 2, 29282, 511, 10056, 8455, 9590, 14303,
+    0, 2, 57866, 262, 13592, 20423, 15025, 26445,
+    0, 2, 47408, 29, 16297, 19349, 27493, 16376,
+    512, 2, 23704, 68, 17684, 13518, 22058, 13563,
+    8, 2, 43922, 10, 10056, 19656, 25575, 17561,
+    1, 2, 10458, 236, 13592, 12598, 23017, 12230,
+    0, 2, 44620, 511, 10749, 15360, 27173, 13119,
+    1, 2, 36253, 3, 16991, 20116, 19181, 22151,
+    17, 2, 55774, 144, 8669, 16741, 16624, 20374,
+    1, 2, 44620, 236, 15604, 17815, 24296, 16524,
+    1, 2, 27887, 367, 13592, 15206, 21099, 15784,
+    16, 2, 19521, 26, 5895, 7841, 15345, 10306,
+    0, 1, 52289, 1442, 7975, 12751, 18222, 14600,
+    0, 2, 20915, 262, 13592, 25640, 44116, 14748,
+    512, 2, 49500, 144, 14910, 17354, 23976, 16228,
+    2, 2, 41831, 5, 13592, 17201, 17583, 20078,
+    0, 2, 35556, 721, 13523, 14132, 25575, 12675,
+    0, 2, 12549, 485, 20458, 9989, 18222, 11490,
+    1, 2, 35556, 131, 12136, 15206, 22058, 15340,
+    0, 2, 20915, 7, 21152, 22878, 27812, 19190,
+    0, 2, 51591, 105, 16991, 21190, 31968, 15932,
+    5, 2, 26493, 248, 13939, 9222, 18861, 10306,
+    257, 2, 52289, 85, 10056, 16587, 21738, 16821,
+    1, 2, 46711, 66, 15604, 11984, 20460, 12675,
+    17409, 2, 45317, 786, 13523, 13518, 25255, 12230,
+    16, 2, 32768, 273, 13592, 19349, 31968, 14600,
+    0, 0, 52986, 18481, 0, 15, 24296, 89,
+    1, 2, 28584, 354, 11443, 25180, 21738, 25348,
+    0, 2, 39739, 248, 13939, 16615, 22697, 16239,
+    17409, 2, 41831, 8, 17684, 16434, 21738, 16575,
+    0, 1, 16035, 1311, 16991, 16434, 28132, 13563,
+    0, 2, 22310, 126, 19071, 17661, 28132, 14600,
+    17, 2, 22310, 813, 13592, 7381, 12148, 11194,
+    0, 1, 21613, 2097, 10749, 9068, 19181, 10157,
+    0, 2, 34162, 210, 16297, 16587, 23017, 16080,
+    1, 2, 58563, 33, 7282, 19809, 18222, 22447,
+    0, 2, 40436, 183, 7282, 18121, 26534, 15784,
+    3, 2, 20218, 17, 13592, 15360, 16304, 18894,
+    16384, 2, 22310, 236, 13523, 20883, 23657, 19930,
+    129, 0, 33465, 2621, 6311, 322, 23017, 385,
+    16385, 2, 15338, 304, 13592, 8608, 15664, 11046,
+    0, 2, 25099, 223, 16991, 20883, 26853, 18005,
+    8, 2, 49500, 0, 17684, 12137, 19501, 13415,
+    1, 2, 42528, 273, 11443, 14285, 22697, 13973,
+    1, 2, 53683, 301, 14078, 16741, 26534, 14600,
+    1, 2, 46711, 13, 12136, 11830, 15664, 15044,
+    16, 2, 11155, 157, 13592, 23032, 32927, 16821,
+    0, 0, 43225, 9175, 6311, 9222, 29091, 7492,
+    0, 2, 48105, 131, 11443, 19042, 20460, 20078,
+    2, 0, 40436, 3932, 7282, 6460, 20140, 6900,
+    1, 2, 27887, 16, 9362, 27788, 10869, 43621,
+    0, 2, 44620, 4, 13939, 16894, 18222, 19338,
+    1024, 2, 23704, 511, 13939, 12291, 18222, 14007,
+    0, 2, 17430, 157, 13592, 19502, 20140, 20818,
+    2, 2, 53683, 944, 9362, 19656, 25894, 17561,
+    0, 2, 58563, 131, 6588, 13672, 8951, 23928,
+    1, 2, 25099, 248, 29473, 28249, 21738, 28370,
+    0, 2, 54380, 524, 13592, 15206, 16624, 18597,
+    16, 2, 9063, 102, 14910, 11523, 19181, 12823,
+    0, 2, 47408, 459, 13592, 19502, 25255, 17709,
+    0, 2, 21613, 210, 8669, 17815, 19820, 19338,
+    8, 2, 22310, 301, 10749, 1550, 20460, 1718,
+    0, 2, 57866, 433, 14910, 16280, 25255, 14600,
+    1, 2, 46711, 183, 12830, 14592, 17263, 17117,
+    0, 2, 46014, 170, 9362, 16894, 18222, 19190,
+    0, 2, 20218, 26, 17684, 11830, 17902, 13711,
+    128, 2, 50197, 30, 13592, 14132, 28132, 11638,
+    0, 2, 55774, 37, 8669, 13518, 23657, 12823,
+    0, 2, 21613, 304, 13592, 12137, 20140, 12971,
+    0, 2, 49500, 131, 11443, 13825, 15984, 17265,
+    0, 2, 38345, 273, 14910, 13518, 17902, 15636,
+    1, 2, 51591, 262, 11443, 18428, 15025, 23928,
+    16384, 2, 23704, 157, 12830, 14132, 26214, 12527,
+    1, 2, 16035, 262, 13592, 12904, 19181, 14303,
+    5, 2, 39042, 131, 13592, 11677, 16943, 14155,
+    4096, 1, 22310, 878, 11443, 13365, 23657, 12675,
+    1, 2, 41831, 236, 1734, 3084, 7353, 6308,
+    0, 2, 13246, 170, 11443, 15513, 21738, 15636,
+    40, 2, 23007, 3, 25312, 27481, 46993, 15044,
+    0, 2, 48803, 101, 14078, 18428, 20140, 19634,
+    128, 2, 43922, 236, 14078, 14439, 24296, 13415,
+    1, 2, 41831, 3, 10056, 18735, 15664, 23780,
+    0, 2, 54380, 1585, 23232, 13979, 20460, 14748,
+    16385, 2, 36253, 301, 13523, 9222, 21419, 9417,
+    1, 2, 33465, 3, 13939, 19656, 17583, 23039,
+    1, 1, 41831, 2621, 11443, 15513, 21419, 15751,
+    2, 2, 52986, 1296, 13939, 18121, 23657, 17117,
+    0, 2, 44620, 210, 12830, 14746, 23976, 14007,
+    512, 1, 52986, 1573, 11443, 18428, 23976, 17413,
+    0, 2, 25099, 304, 13592, 16127, 13746, 22151,
+    0, 2, 42528, 354, 16991, 19656, 28132, 15932,
+    0, 2, 32768, 197, 12830, 13211, 20460, 13859,
+    2, 2, 51591, 13, 12830, 22878, 16943, 27481,
+    0, 2, 18127, 20, 19071, 30090, 37723, 19930,
+    260, 1, 19521, 2621, 11443, 11677, 28132, 9713,
+    4096, 2, 33465, 79, 13939, 12904, 23017, 12675,
+    258, 2, 53683, 1, 14078, 32392, 18861, 35921,
+    0, 2, 36951, 367, 16297, 15513, 14705, 20522,
+    3, 2, 42528, 248, 17684, 21344, 22697, 20839,
+    0, 2, 20915, 446, 13939, 11677, 21419, 11934,
+    0, 2, 55774, 668, 11443, 14592, 21738, 14728,
+    16385, 2, 23007, 183, 13592, 17354, 19181, 19190,
+    2050, 2, 17430, 304, 20458, 28556, 29731, 22743,
+    3, 2, 23704, 58, 12136, 13979, 18542, 15932,
+    0, 2, 45317, 210, 11443, 16280, 17263, 19338,
+    0, 0, 44620, 7209, 4508, 1857, 25575, 1718,
+    0, 2, 27887, 131, 10056, 14899, 18542, 16821,
+    0, 2, 36951, 4, 9362, 22878, 24296, 21115,
+    0, 2, 41831, 157, 12136, 13058, 22697, 12778,
+    16385, 2, 58563, 144, 13592, 12444, 16624, 15192,
+    0, 2, 11852, 615, 19071, 20270, 29411, 16376,
+    2, 2, 40436, 144, 13939, 21190, 28132, 17413,
+    0, 2, 39739, 248, 13939, 16615, 22697, 16239,
+    16384, 2, 27887, 406, 16991, 22418, 25894, 19930,
+    1, 2, 38345, 125, 5895, 17354, 5435, 37846,
+    1, 2, 49500, 1009, 13592, 7227, 12148, 10898,
+    0, 2, 56472, 249, 19765, 17354, 29411, 14007,
+    0, 2, 59260, 197, 14078, 9375, 13427, 13119,
+    0, 2, 26493, 121, 13592, 17201, 25575, 15340,
+    1, 2, 27887, 33, 21152, 20116, 23017, 19486,
+    256, 2, 40436, 118, 24619, 16741, 28132, 13859,
+    386, 2, 41831, 970, 7975, 12751, 21738, 12971,
+    4, 2, 37648, 157, 16297, 14132, 24296, 12971,
+    0, 2, 50197, 446, 10749, 14899, 19181, 16376,
+    0, 2, 43225, 83, 13523, 16127, 19820, 17265,
+    0, 2, 48803, 39, 15604, 17968, 16624, 21707,
+    0, 2, 45317, 249, 14910, 20270, 25255, 18301,
+    0, 2, 48105, 262, 14910, 20730, 30690, 16080,
+    1, 2, 57169, 102, 5201, 15206, 16624, 18597,
+    64, 2, 25099, 3539, 11443, 12904, 22697, 12630,
+    0, 2, 46711, 79, 10749, 12751, 21099, 13267,
+    64, 2, 41134, 223, 17684, 16894, 19820, 18301,
+    0, 2, 59958, 406, 13592, 11830, 19181, 13119,
+    0, 2, 26493, 354, 13592, 16280, 23017, 15784,
+    128, 2, 51591, 197, 7975, 13518, 22058, 13563,
+    256, 2, 50894, 170, 7975, 13211, 21099, 13711,
+    1, 2, 39042, 262, 13523, 22878, 21419, 23336,
+    1, 2, 33465, 10, 1040, 8608, 16304, 10602,
+    0, 2, 22310, 304, 13592, 16938, 21738, 17081,
+    2, 2, 55774, 223, 10749, 16741, 20140, 17857,
+    1, 2, 48803, 115, 14910, 22264, 30050, 17561,
+    386, 2, 48105, 13, 14078, 18889, 17583, 22151,
+    3, 2, 41831, 498, 8669, 13825, 17902, 16080,
+    1, 2, 50197, 262, 7975, 16127, 21099, 16672,
+    0, 2, 22310, 249, 12830, 12291, 23976, 11638,
+    16641, 2, 16732, 197, 18378, 17968, 32927, 13119,
+    1, 2, 52289, 419, 5201, 15053, 22697, 14896,
+    0, 2, 64141, 734, 13592, 12291, 18861, 13711,
+    66, 2, 38345, 144, 14910, 15360, 19820, 16524,
+    1, 2, 14641, 210, 18378, 16587, 20140, 17709,
+    1, 2, 23704, 223, 14910, 17047, 20779, 17857,
+    0, 2, 62746, 406, 7975, 12444, 20140, 13267,
+    1025, 2, 46711, 131, 13592, 13211, 17902, 15340,
+    2, 2, 49500, 380, 7975, 26254, 22697, 25616,
+    0, 2, 20218, 170, 11443, 13825, 21738, 14155,
+    1, 0, 21613, 14287, 1040, 15, 23657, 89,
+    16385, 2, 26493, 7, 15604, 14132, 19501, 15340,
+    1025, 2, 32070, 46, 17684, 9222, 20460, 9861,
+    66, 2, 30676, 58, 19071, 23032, 20140, 24520,
+    1, 2, 17430, 131, 13592, 11830, 15025, 15488,
+    0, 2, 48105, 406, 13592, 18582, 26214, 16376,
+    1, 2, 53683, 101, 12136, 16280, 20460, 17117,
+    16384, 2, 16035, 170, 12136, 14132, 17263, 16821,
+    0, 2, 29979, 708, 13592, 11063, 17263, 13119,
+    1, 2, 19521, 341, 10749, 20270, 18542, 22891,
+    1, 2, 23007, 183, 13592, 11217, 15345, 14451,
+    16384, 2, 39739, 170, 20458, 20423, 23017, 19634,
+    0, 2, 26493, 66, 14910, 18121, 23337, 17561,
+    0, 2, 49500, 0, 28086, 20883, 13746, 28666,
+    0, 2, 59260, 262, 13592, 19042, 25575, 17117,
+    512, 2, 50197, 26, 16991, 20423, 19501, 22299,
+    0, 2, 39739, 315, 7975, 17815, 21738, 17961,
+    0, 2, 16732, 603, 16297, 8915, 17263, 10750,
+    16384, 2, 25099, 33, 13523, 17047, 19820, 18597,
+    1, 2, 32070, 101, 13592, 11830, 21738, 11958,
+    1, 2, 34859, 642, 13592, 14899, 16943, 17709,
+    4096, 2, 50197, 5, 26006, 44360, 20140, 47175,
+    0, 2, 38345, 157, 10749, 17047, 14066, 23039,
+    16385, 2, 25796, 328, 15604, 13365, 20140, 14303,
+    2, 2, 43922, 13, 13939, 18428, 14705, 24224,
+    256, 2, 57169, 288, 5895, 10143, 14705, 13415,
+    2, 2, 38345, 3, 12830, 14592, 11828, 22003,
+    64, 2, 16732, 642, 13939, 10910, 20460, 11490,
+    1, 2, 20218, 130, 13592, 16587, 15345, 21263,
+    1, 2, 9063, 315, 13592, 13211, 14705, 17561,
+    0, 2, 48105, 301, 12136, 18275, 18222, 20966,
+    2, 2, 28584, 52, 13939, 39143, 27493, 33256,
+    0, 2, 25099, 144, 13592, 12291, 15025, 16080,
+    0, 2, 57169, 249, 17684, 17815, 30050, 14007,
+    0, 2, 31373, 109, 13592, 11830, 19181, 13119,
+    3, 2, 39739, 4, 14078, 19502, 18861, 21707,
+    0, 2, 27887, 1231, 5201, 11830, 34206, 8381,
+    0, 2, 47408, 273, 12830, 13365, 18861, 15044,
+    0, 2, 29979, 37, 13592, 27021, 16304, 33256,
+    1, 2, 9761, 197, 13592, 14746, 24296, 13563,
+    258, 2, 20915, 655, 13939, 21190, 25894, 18894,
+    36, 2, 18127, 304, 13592, 16434, 26214, 14451,
+    0, 2, 57169, 380, 9362, 14132, 16943, 17117,
+    0, 2, 38345, 315, 11443, 12751, 20140, 13711,
+    768, 2, 26493, 197, 19071, 14746, 21419, 15044,
+    1, 2, 32768, 144, 13592, 22418, 32288, 16821,
+    1, 2, 51591, 197, 3121, 7687, 31009, 5864,
+    4096, 2, 20915, 125, 17684, 22878, 35804, 15932,
+    0, 2, 41134, 4, 1734, 12904, 13107, 18301,
+    0, 2, 55774, 498, 14078, 12904, 24296, 11934,
+    0, 2, 50197, 304, 13592, 16938, 21738, 17081,
+    2, 2, 43225, 0, 23232, 31778, 26534, 27481,
+    0, 2, 32768, 406, 16991, 13365, 23976, 12675,
+    0, 2, 39042, 248, 13939, 16615, 22697, 16239,
+    4096, 2, 57169, 58, 13939, 21804, 25575, 19634,
+    0, 2, 23704, 248, 13939, 10756, 20140, 11638,
+    3, 2, 32070, 354, 13523, 16434, 23657, 15636,
+    1, 2, 36951, 248, 10749, 8762, 11828, 13267,
+    0, 2, 12549, 248, 13939, 16615, 22697, 16239,
+    1, 2, 41134, 68, 17684, 17815, 24296, 16524,
+    32, 2, 22310, 81, 13592, 19809, 50830, 10157,
+    16384, 2, 49500, 537, 8669, 15053, 15984, 18894,
+    4096, 2, 9761, 5, 20458, 19349, 22058, 19338,
+    0, 2, 17430, 144, 13592, 14285, 19501, 15636,
+    16384, 2, 22310, 223, 16991, 17201, 26853, 14896,
+    0, 2, 20218, 393, 13939, 14285, 17263, 17117,
+    3, 2, 39739, 248, 13939, 10910, 17263, 12971,
+    4096, 2, 41831, 304, 5895, 9222, 11828, 14007,
+    0, 2, 23007, 33, 15604, 15360, 24296, 14155,
+    512, 2, 39042, 248, 13939, 16615, 22697, 16239,
+    64, 2, 23007, 1035, 13592, 13058, 17583, 15340,
+    0, 1, 50894, 1191, 13523, 10603, 19820, 11490,
+    1, 2, 51591, 341, 13592, 13979, 15664, 17857,
+    256, 2, 53683, 577, 13592, 17968, 15345, 23039,
+    648, 2, 46014, 4, 16297, 20577, 18222, 23484,
+    0, 2, 54380, 170, 11443, 15206, 19820, 16376,
+    0, 2, 20218, 236, 14078, 17354, 24296, 15932,
+    0, 2, 51591, 144, 13592, 13979, 19181, 15488,
+    17, 2, 51591, 446, 13592, 13518, 17902, 15636,
+    1, 2, 17430, 341, 13523, 16587, 16624, 20078,
+    1, 2, 43922, 262, 13592, 17354, 23337, 16672,
+    0, 2, 57866, 33, 13523, 20116, 16304, 24816,
+    258, 2, 25796, 564, 10056, 21344, 22058, 21263,
+    16384, 2, 55077, 786, 10749, 14746, 21419, 15044,
+    0, 2, 40436, 92, 10749, 19349, 25255, 17561,
+    1, 2, 55774, 393, 4508, 10143, 21738, 10264,
+    0, 2, 50197, 734, 12830, 17201, 22378, 17117,
+    1, 2, 36951, 380, 10056, 19963, 21738, 20226,
+    4, 2, 41831, 248, 13939, 8915, 15984, 11638,
+    256, 1, 40436, 1442, 10749, 17968, 21419, 18230,
+    0, 2, 34859, 537, 13939, 12598, 20460, 13267,
+    17, 2, 30676, 304, 13592, 19656, 24296, 18301,
+    16, 2, 16732, 183, 10749, 11523, 19181, 12823,
+    0, 2, 36253, 210, 13592, 17968, 21738, 18153,
+    1, 2, 36253, 682, 13523, 13058, 24296, 12230,
+    1, 2, 52986, 210, 16297, 11063, 22378, 11046,
+    0, 2, 1394, 304, 26699, 16938, 21738, 17081,
+    1, 2, 48803, 367, 13523, 18735, 26853, 16228,
+    1, 2, 31373, 419, 7975, 18275, 21099, 19042,
+    1, 2, 16732, 380, 13939, 13058, 18861, 14451,
+    0, 0, 12549, 65535, 3121, 322, 29091, 237,
+    16384, 2, 53683, 117, 12136, 15360, 22378, 15192,
+    0, 2, 51591, 288, 10749, 10449, 22697, 10306,
+    3, 2, 41134, 46, 10749, 14592, 15025, 19042,
+    0, 2, 55774, 524, 13592, 14439, 20460, 15340,
+    0, 2, 41831, 629, 13592, 13825, 18222, 15784,
+    4098, 2, 17430, 10, 11443, 26254, 30370, 20670,
+    0, 2, 45317, 114, 12136, 16434, 19501, 18005,
+    512, 2, 10458, 197, 12830, 15820, 24296, 15044,
+    1, 2, 51591, 249, 15604, 15360, 21419, 15636,
+    32, 2, 19521, 13, 21152, 21344, 47633, 11490,
+    1, 2, 30676, 183, 14910, 21190, 22378, 20966,
+    0, 2, 28584, 393, 5201, 12291, 22697, 12082,
+    0, 2, 11852, 273, 13592, 21497, 21738, 21653,
+    0, 2, 48803, 131, 11443, 11677, 21419, 11934,
+    256, 2, 46711, 301, 10056, 16741, 22697, 16524,
+    0, 2, 53683, 170, 15604, 17968, 28132, 14896,
+    1, 2, 20915, 183, 15604, 22571, 36444, 15340,
+    0, 2, 31373, 157, 9362, 21037, 19820, 22743,
+    0, 2, 50197, 157, 15604, 10910, 22697, 10688,
+    1024, 2, 31373, 328, 10056, 10143, 19820, 11046,
+    16416, 2, 28584, 498, 15604, 19042, 22058, 19042,
+    4128, 2, 24401, 5, 13939, 22418, 43797, 12971,
+    0, 2, 32070, 144, 15604, 16894, 26214, 14896,
+    4096, 2, 36951, 92, 13523, 14132, 22697, 13859,
+    272, 2, 48803, 210, 12136, 20423, 28132, 16969,
+    0, 2, 50197, 3, 13592, 21497, 23017, 20818,
+    0, 0, 24401, 2884, 1040, 169, 23337, 237,
+    16640, 2, 37648, 76, 13939, 17661, 23976, 16524,
+    16, 2, 64141, 393, 5895, 13672, 16943, 16228,
+    4, 2, 18824, 223, 19765, 17815, 36124, 12082,
+    0, 2, 37648, 26, 24619, 45741, 46993, 25112,
+    387, 2, 52986, 122, 12830, 18121, 34526, 12823,
+    2, 2, 19521, 1835, 10056, 14132, 19820, 15340,
+    0, 2, 25796, 210, 21845, 20116, 22378, 19930,
+    2, 2, 25796, 72, 14910, 21804, 23337, 20966,
+    1, 2, 23007, 128, 12830, 19963, 23017, 19338,
+    0, 2, 58563, 76, 12830, 21037, 21738, 21115,
+    2, 2, 46014, 111, 13523, 21037, 34526, 14896,
+    1, 2, 35556, 144, 18378, 23952, 29091, 19486,
+    0, 2, 48105, 45, 16991, 24566, 26534, 21559,
+    2, 2, 52986, 459, 13939, 17047, 23017, 16672,
+    0, 1, 25099, 2884, 9362, 10449, 22058, 10454,
+    1, 2, 32768, 537, 13592, 14439, 22378, 14303,
+    0, 2, 19521, 642, 13592, 21958, 33247, 16080,
+    0, 2, 57169, 79, 7975, 14132, 17583, 16524,
+    16, 1, 43225, 2884, 11443, 13058, 26214, 11490,
+    16384, 1, 39042, 1442, 14078, 11063, 23337, 10602,
+    0, 2, 29979, 144, 13592, 16741, 23337, 16080,
+    1, 2, 17430, 249, 19765, 13979, 27812, 11786,
+    0, 2, 35556, 4, 13939, 24566, 21419, 25112,
+    2, 2, 25796, 131, 13592, 17508, 20460, 18449,
+    0, 2, 30676, 301, 16991, 24873, 23976, 23484,
+    512, 2, 22310, 0, 21845, 27942, 20140, 30147,
+    1, 2, 55077, 20, 14910, 18582, 16943, 22151,
+    256, 2, 38345, 157, 13592, 17354, 23976, 16376,
+    2, 2, 16035, 12, 13939, 18889, 18542, 21263,
+    258, 2, 27887, 367, 13939, 22418, 23017, 21559,
+    17, 2, 41831, 144, 14910, 12291, 17583, 14600,
+    2, 2, 43922, 131, 10056, 18889, 18542, 21411,
+    0, 1, 24401, 983, 28086, 20883, 43797, 12082,
+    0, 2, 18824, 249, 13592, 10910, 31649, 8233,
+    1, 2, 42528, 48, 7975, 13518, 21419, 13859,
+    256, 2, 47408, 10, 16297, 19809, 21419, 20226,
+    16385, 2, 26493, 197, 13939, 13825, 15025, 18153,
+    0, 2, 41831, 51, 13592, 20883, 15984, 26149,
+    0, 2, 50197, 223, 4508, 12137, 21419, 12379,
+    2, 2, 51591, 2752, 10749, 18582, 25894, 16524,
+    1, 2, 50197, 511, 12830, 13518, 16624, 16524,
+    1, 2, 44620, 249, 13592, 12751, 18542, 14451,
+    4097, 2, 46711, 115, 19765, 9989, 21738, 10110,
+    1, 2, 32070, 197, 9362, 13365, 22058, 13267,
+    0, 2, 21613, 118, 15604, 19349, 32288, 14451,
+    4096, 2, 13246, 157, 13592, 15666, 22378, 15488,
+    16, 2, 51591, 54, 11443, 20116, 17902, 23336,
+    1, 2, 32070, 433, 12136, 13518, 20460, 14303,
+    2, 2, 41831, 446, 10749, 17661, 24296, 16080,
+    0, 2, 16035, 419, 19071, 13518, 22697, 13227,
+    528, 2, 51591, 144, 11443, 15360, 15664, 19486,
+    1, 2, 27887, 301, 13592, 14439, 21738, 14600,
+    1, 2, 48803, 83, 8669, 24719, 23017, 23928,
+    65, 2, 33465, 1, 13939, 18889, 17583, 22151,
+    1, 2, 18824, 223, 14078, 21344, 25255, 19338,
+    0, 2, 55077, 223, 5201, 15053, 16943, 18153,
+    3, 2, 34162, 7, 12136, 16280, 15664, 20522,
+    0, 2, 24401, 304, 13592, 16938, 21738, 17081,
+    0, 2, 50894, 668, 13592, 13825, 15664, 17561,
+    2, 2, 48803, 66, 14910, 29936, 30370, 23336,
+    2, 2, 20218, 433, 13592, 26561, 41239, 16228,
+    4, 2, 26493, 747, 13592, 24566, 30370, 19338,
+    0, 2, 48105, 131, 12830, 14899, 20460, 15784,
+    0, 2, 25796, 157, 13523, 15053, 23337, 14451,
+    1, 2, 49500, 144, 9362, 14899, 16624, 17857,
+    1, 2, 41134, 52, 13523, 16894, 23976, 15932,
+    0, 1, 20218, 1114, 14078, 13518, 28132, 11342,
+    65, 2, 33465, 1, 13939, 20577, 16624, 24816,
+    256, 2, 11155, 118, 9362, 16587, 23657, 15784,
+    0, 2, 43225, 183, 12830, 17661, 22697, 17257,
+    1, 2, 25796, 328, 13939, 11984, 18542, 13563,
+    1, 1, 36951, 1887, 7282, 7381, 12787, 10750,
+    258, 2, 52986, 472, 12136, 20116, 23657, 19042,
+    384, 2, 32768, 13, 13939, 17815, 20140, 19042,
+    0, 2, 46711, 121, 13939, 14592, 16304, 18153,
+    16384, 2, 24401, 197, 13592, 19656, 23337, 18894,
+    2, 2, 43922, 9, 12830, 16741, 21099, 17265,
+    0, 2, 50197, 7, 16991, 30550, 23017, 29554,
+    0, 2, 30676, 14, 13592, 22111, 28132, 18449,
+    0, 2, 47408, 157, 15604, 16434, 26853, 14155,
+    2, 2, 28584, 210, 13592, 18428, 20140, 19634,
+    3, 2, 27190, 304, 13592, 20730, 21419, 21115,
+    4097, 2, 47408, 248, 13939, 16615, 22697, 16239,
+    0, 2, 41831, 46, 9362, 16127, 23657, 15192,
+    16385, 2, 27190, 341, 16297, 15666, 22697, 15340,
+    1, 2, 45317, 183, 13592, 9682, 20779, 10157,
+    4097, 2, 29979, 1, 13939, 20270, 17263, 24224,
+    4096, 2, 24401, 28, 13592, 15513, 21419, 15932,
+    0, 2, 31373, 144, 23232, 18889, 30050, 14896,
+    1, 1, 33465, 1311, 11443, 16587, 18222, 19042,
+    0, 2, 29282, 472, 13592, 13058, 22697, 12823,
+    0, 2, 35556, 459, 13592, 10910, 17583, 12823,
+    1, 2, 32070, 79, 19765, 16894, 27173, 14451,
+    1, 2, 14641, 26, 19765, 15973, 23337, 15340,
+    2, 2, 28584, 16, 13939, 22418, 24296, 20818,
+    1, 2, 46711, 157, 7975, 12444, 15984, 15488,
+    1, 2, 23007, 115, 20458, 10143, 12468, 14748,
+    0, 2, 44620, 288, 12830, 15053, 22697, 14748,
+    1, 2, 35556, 131, 12830, 13058, 16624, 15932,
+    1, 2, 39739, 118, 10056, 13058, 17902, 15192,
+    1, 2, 29282, 89, 13523, 7841, 20779, 8233,
+    64, 2, 20915, 615, 17684, 10756, 22058, 10750,
+    0, 2, 32070, 89, 12136, 15513, 19501, 16969,
+    1, 2, 45317, 341, 13592, 12598, 13427, 17561,
+    0, 1, 55077, 800, 11443, 17354, 21099, 17857,
+    0, 2, 49500, 446, 14078, 13058, 21738, 13267,
+    0, 2, 50894, 380, 13592, 15360, 22697, 15044,
+    16385, 2, 53683, 380, 12830, 13365, 22058, 13415,
+    0, 2, 48105, 288, 10056, 16127, 25255, 14600,
+    642, 2, 46711, 341, 13523, 22878, 36124, 15636,
+    0, 2, 59958, 393, 10749, 10449, 24296, 9565,
+    0, 1, 16732, 1442, 4508, 18275, 27173, 15636,
+    0, 2, 31373, 20, 20458, 24259, 20779, 25409,
+    0, 2, 27887, 4, 14078, 28249, 19501, 30739,
+    0, 2, 44620, 564, 13939, 13058, 14066, 17709,
+    0, 2, 27190, 7, 10056, 20270, 24296, 18449,
+    0, 2, 34162, 144, 14910, 11984, 21099, 12379,
+    514, 2, 49500, 5, 21845, 36228, 17583, 42288,
+    2, 2, 54380, 1442, 13592, 19042, 20779, 19930,
+    0, 2, 29282, 315, 11443, 20730, 23657, 19782,
+    1, 2, 50197, 73, 13592, 16280, 23337, 15636,
+    512, 0, 31373, 4587, 7975, 2010, 18542, 2458,
+    1025, 2, 41831, 393, 7975, 10143, 22697, 10009,
+    0, 2, 24401, 249, 13939, 18428, 28132, 15488,
+    1, 2, 19521, 131, 7282, 13672, 16943, 16524,
+    5, 2, 43225, 248, 13939, 7534, 18222, 8677,
+    64, 2, 29979, 983, 13592, 12751, 36444, 8677,
+    8, 2, 33465, 4, 16297, 27175, 31009, 20966,
+    2, 2, 40436, 1, 13523, 16894, 18542, 19042,
+    1, 2, 33465, 210, 13592, 18889, 22058, 18745,
+    1, 2, 62746, 132, 13592, 15513, 19501, 16969,
+    2, 2, 30676, 14, 13592, 19349, 18222, 22151,
+    256, 2, 42528, 288, 14078, 14285, 18542, 16228,
+    17, 2, 52289, 34, 347, 4772, 10550, 7936,
+    0, 2, 15338, 328, 23232, 24873, 39641, 15636,
+    1, 2, 44620, 85, 13592, 15820, 21099, 16376,
+    18, 2, 43922, 31, 9362, 9529, 18222, 11046,
+    4096, 2, 20218, 183, 14910, 18275, 26214, 16080,
+    0, 2, 50197, 183, 13592, 11370, 22697, 11194,
+    512, 2, 10458, 7, 42650, 38683, 24296, 35773,
+    0, 2, 46711, 328, 23925, 16615, 22697, 16239,
+    129, 2, 48803, 367, 13592, 15820, 19181, 17413,
+    256, 0, 39739, 2359, 14078, 9989, 25575, 8973,
+    0, 2, 34162, 249, 12136, 17968, 23337, 17265,
+    2, 2, 34859, 183, 13939, 22725, 24296, 20670,
+    1, 2, 49500, 39, 3814, 17968, 24296, 16376,
+    1, 2, 50197, 13, 10056, 11370, 16304, 14007,
+    2, 2, 42528, 64, 13592, 16587, 19820, 18005,
+    36, 2, 18127, 288, 28086, 23645, 55305, 11194,
+    0, 2, 55774, 8, 21845, 20730, 25575, 18597,
+    4097, 2, 36951, 419, 14910, 15973, 23017, 15488,
+    16384, 2, 22310, 130, 15604, 19502, 23337, 18745,
+    0, 2, 29979, 92, 12830, 16127, 24296, 14896,
+    0, 2, 22310, 248, 13939, 16615, 22697, 16239,
+    0, 2, 28584, 5, 19071, 21344, 24296, 19634,
+    0, 2, 15338, 485, 15604, 22571, 31009, 17413,
+    1, 2, 25796, 328, 13592, 14132, 22697, 13859,
+    1, 2, 58563, 33, 15604, 19196, 24296, 17561,
+    0, 1, 18127, 1704, 11720, 12904, 18222, 14896,
+    0, 2, 42528, 248, 9362, 16615, 22697, 16239,
+    0, 2, 48105, 472, 12830, 17047, 22697, 16659,
+    32, 2, 20218, 354, 13939, 18735, 36764, 12527,
+    3, 2, 39739, 4, 13939, 20577, 20140, 22003,
+    0, 2, 36951, 14, 13592, 22878, 16624, 27778,
+    0, 2, 50197, 125, 16991, 17815, 24296, 16524,
+    512, 0, 41134, 12976, 5201, 1396, 31649, 1125,
+    2, 2, 20915, 3, 14078, 32085, 28132, 26445,
+    0, 2, 51591, 304, 13592, 15973, 23337, 15340,
+    1, 2, 34162, 131, 13523, 15053, 21099, 15636,
+    0, 2, 34859, 3, 22538, 30243, 23017, 29258,
+    258, 2, 697, 537, 13592, 23339, 24296, 21707,
+    0, 2, 25796, 367, 16297, 14285, 22378, 14303,
+    0, 2, 41831, 615, 7282, 13211, 15025, 17117,
+    3, 2, 41831, 865, 14910, 15666, 19181, 17265,
+    1, 2, 17430, 236, 13592, 15053, 19820, 16228,
+    0, 2, 14641, 170, 13939, 16434, 21099, 16969,
+    256, 2, 51591, 301, 8669, 13058, 18222, 14896,
+    1, 2, 17430, 354, 16991, 19502, 25575, 17561,
+    0, 2, 46014, 367, 14910, 15666, 20140, 16672,
+    4114, 2, 40436, 26, 29473, 21037, 44756, 11934,
+    0, 2, 47408, 406, 13592, 14439, 23657, 13711,
+    2, 2, 25099, 33, 16991, 16587, 22058, 16524,
+    0, 2, 50197, 183, 10749, 17815, 20460, 18894,
+    16384, 2, 55774, 236, 12136, 22264, 29091, 18153,
+    0, 2, 39042, 406, 6588, 19196, 25255, 17265,
+    5, 2, 34162, 39, 13592, 23645, 29411, 19042,
+    1, 2, 14641, 341, 7282, 17815, 19181, 19634,
+    2, 2, 35556, 248, 13939, 16615, 22697, 16239,
+    0, 2, 59958, 248, 13939, 16615, 22697, 16239,
+    2, 2, 34162, 89, 16297, 17661, 23337, 16969,
+    258, 2, 15338, 41, 11443, 22111, 24296, 20522,
+    2, 2, 33465, 52, 13592, 22264, 22378, 22003,
+    1, 2, 14641, 157, 16991, 15820, 22697, 15466,
+    0, 2, 31373, 248, 19765, 23799, 23976, 22447,
+    1, 2, 46711, 262, 10056, 16434, 19501, 18005,
+    0, 2, 58563, 85, 14078, 24106, 22378, 23780,
+    32, 2, 13944, 248, 13939, 16615, 22697, 16239,
+    1, 2, 41831, 157, 10749, 13825, 16943, 16524,
+    0, 2, 46014, 249, 19765, 19963, 28132, 16376,
+    16, 2, 57169, 328, 13939, 17661, 22058, 17561,
+    4098, 2, 49500, 248, 21845, 16615, 22697, 16239,
+    0, 2, 48105, 498, 21152, 16434, 25575, 14748,
+    16385, 2, 40436, 223, 10056, 17968, 15345, 23039,
+    32, 2, 19521, 20, 24619, 21651, 47313, 11786,
+    0, 2, 32768, 8, 23232, 19963, 7672, 36810,
+    3, 2, 43922, 236, 9362, 17508, 22058, 17561,
+    258, 2, 10458, 28, 16297, 18889, 20779, 19634,
+    259, 2, 13246, 1573, 18378, 18121, 21738, 18267,
+    1, 2, 23007, 88, 8669, 10603, 15025, 13859,
+    0, 2, 28584, 682, 9362, 8455, 17583, 9861,
+    0, 1, 40436, 1009, 12136, 16587, 25255, 15044,
+    1, 2, 29979, 26, 10056, 15973, 16304, 19634,
+    0, 2, 52289, 367, 13592, 14746, 22697, 14303,
+    0, 2, 39739, 20, 16991, 12904, 16304, 15784,
+    0, 1, 37648, 1442, 10056, 21651, 30690, 16821,
+    1, 2, 27887, 734, 13939, 13825, 17902, 15932,
+    512, 2, 19521, 20, 37795, 24259, 42518, 14451,
+    16384, 2, 48803, 144, 16297, 18275, 26853, 15784,
+    4096, 2, 34859, 760, 13939, 39603, 65215, 16376,
+    0, 2, 16732, 273, 13939, 15973, 27812, 13267,
+    1, 2, 38345, 105, 12136, 11217, 16624, 13711,
+    0, 2, 53683, 236, 8669, 14592, 23976, 13711,
+    0, 2, 44620, 236, 17684, 18121, 24296, 16672,
+    0, 2, 55077, 708, 13592, 15513, 12787, 22299,
+    16384, 2, 26493, 262, 16297, 14285, 22378, 14155,
+    0, 2, 61352, 328, 12136, 12751, 24296, 11934,
+    128, 2, 36951, 9, 34328, 32698, 18542, 36810,
+    1, 2, 32768, 210, 14078, 11830, 22378, 11786,
+    16385, 2, 20218, 104, 12136, 11984, 18542, 13563,
+    5, 2, 40436, 328, 18378, 10910, 26853, 9417,
+    257, 2, 29979, 5, 13939, 21190, 23976, 19930,
+    2049, 2, 46711, 304, 13592, 15206, 24296, 13859,
+    2, 2, 26493, 9, 16297, 5232, 16943, 6308,
+    1, 2, 8366, 47, 14910, 24259, 30690, 18894,
+    544, 2, 18824, 3, 13592, 15820, 30370, 12379,
+    1, 2, 32070, 315, 14910, 21497, 20460, 22447,
+    258, 2, 28584, 17, 14078, 12444, 15025, 16228,
+    1, 2, 47408, 301, 9362, 13058, 18542, 14748,
+    258, 2, 11155, 3670, 13523, 12751, 22697, 12527,
+    1, 2, 44620, 131, 13592, 15053, 17583, 17709,
+    0, 2, 52289, 236, 13592, 16434, 22697, 16080,
+    0, 2, 56472, 210, 5409, 15513, 15664, 19634,
+    1, 2, 41831, 81, 13523, 15513, 21419, 15784,
+    1, 1, 12549, 7602, 11720, 10910, 19820, 11786,
+    0, 2, 21613, 13, 13592, 23032, 12468, 33404,
+    2, 2, 46014, 249, 13939, 25180, 36764, 16969,
+    0, 2, 46711, 157, 13939, 14132, 23657, 13415,
+    0, 2, 43225, 590, 10056, 13825, 18861, 15488,
+    0, 2, 45317, 25, 9362, 14439, 18861, 16080,
+    256, 2, 37648, 223, 12830, 19809, 27812, 16524,
+    1, 2, 6275, 380, 27393, 13365, 26534, 11638,
+    256, 2, 47408, 4, 9362, 23799, 21738, 23963,
+    1, 2, 40436, 102, 13523, 10296, 15345, 13267,
+    0, 2, 41831, 564, 12136, 18582, 22697, 18153,
+    0, 2, 44620, 59, 7975, 19963, 21099, 20670,
+    0, 2, 19521, 511, 6588, 18889, 25575, 16969,
+    1, 2, 43225, 341, 13939, 12444, 19820, 13415,
+    1, 2, 45317, 106, 7282, 21497, 20140, 22891,
+    128, 2, 46014, 101, 13592, 14132, 23657, 13415,
+    0, 2, 23704, 223, 15604, 12137, 19181, 13415,
+    1, 2, 41831, 223, 14910, 13518, 24296, 12675,
+    512, 2, 36253, 3, 29473, 37915, 23337, 36217,
+    1, 2, 50894, 380, 10749, 13365, 16304, 16524,
+    0, 1, 27190, 800, 11443, 20883, 34206, 14896,
+    17, 2, 24401, 248, 13939, 16615, 22697, 16239,
+    4, 2, 49500, 248, 13939, 11063, 23337, 10602,
+    0, 2, 27887, 248, 13939, 16615, 22697, 16239,
+    2, 2, 26493, 33, 19765, 18735, 21738, 18894,
+    0, 2, 44620, 3, 13592, 24259, 23657, 23039,
+    273, 2, 41134, 354, 13939, 13058, 25255, 11786,
+    512, 2, 25796, 406, 13592, 20116, 25255, 18153,
+    4609, 2, 49500, 248, 19071, 17968, 28132, 14748,
+    4, 2, 38345, 304, 13592, 20423, 19181, 22595,
+    0, 2, 24401, 446, 32178, 25947, 18861, 28962,
+    0, 2, 44620, 549, 13592, 14746, 19501, 16080,
+    0, 2, 52289, 131, 19765, 14899, 23657, 14155,
+    0, 2, 20218, 118, 12830, 11217, 17583, 13267,
+    1, 2, 30676, 315, 12136, 17508, 23017, 16969,
+    0, 2, 18824, 446, 12830, 12751, 22697, 12481,
+    512, 2, 26493, 210, 24619, 19963, 37083, 13415,
+    16, 2, 44620, 367, 18378, 15666, 28132, 13119,
+    1024, 2, 38345, 236, 6588, 16741, 22378, 16376,
+    16385, 2, 34162, 107, 14078, 18582, 23976, 17561,
+    0, 2, 51591, 878, 14078, 24106, 29731, 19190,
+    0, 2, 58563, 76, 11443, 15973, 18222, 18301,
+    1, 2, 38345, 301, 13592, 19349, 23017, 18745,
+    1, 2, 16035, 5, 12830, 15973, 18222, 18301,
+    0, 2, 18127, 236, 22538, 17815, 32927, 12971,
+    5, 2, 33465, 13, 8669, 12137, 23017, 11786,
+    0, 2, 23007, 406, 12136, 13979, 22697, 13674,
+    16384, 2, 24401, 236, 12830, 20730, 20140, 22595,
+    1025, 2, 47408, 459, 8669, 10296, 20460, 10898,
+    1, 2, 18824, 130, 17684, 22878, 27173, 19634,
+    0, 1, 12549, 1180, 11720, 14132, 18861, 15932,
+    0, 2, 31373, 197, 10749, 18735, 24296, 17117,
+    1, 2, 35556, 1, 18378, 18275, 17583, 21411,
+    3, 2, 42528, 315, 13523, 15360, 21419, 15784,
+    0, 2, 40436, 248, 10056, 16615, 22697, 16239,
+    0, 2, 50894, 721, 13592, 18889, 28132, 15784,
+    0, 2, 42528, 248, 13939, 13518, 23337, 12971,
+    1, 2, 41134, 118, 10056, 12751, 11828, 19190,
+    1, 2, 39739, 197, 16991, 24259, 31649, 18449,
+    512, 2, 23007, 12, 25312, 30397, 22058, 30295,
+    0, 2, 22310, 236, 12136, 13672, 17902, 15932,
+    8, 2, 26493, 564, 16297, 20270, 39321, 12823,
+    3, 2, 46711, 170, 10056, 10910, 14066, 14896,
+    0, 2, 36253, 380, 5895, 7227, 10869, 11638,
+    1, 2, 41134, 20, 52359, 17968, 24296, 16821,
+    256, 1, 52986, 4719, 11720, 12137, 23657, 11638,
+    257, 2, 46711, 126, 13939, 15513, 23017, 15044,
+    2, 2, 23007, 304, 16991, 28095, 33567, 20374,
+    3, 2, 36951, 615, 13939, 17968, 23337, 17117,
+    552, 2, 28584, 0, 26699, 31011, 45395, 17561,
+    2, 2, 50894, 66, 5201, 22725, 23337, 21855,
+    0, 2, 59260, 7, 13523, 11677, 10869, 18301,
+    768, 2, 11155, 39, 10056, 15053, 16943, 18153,
+    0, 2, 24401, 380, 9362, 13672, 20460, 14600,
+    1, 2, 46711, 52, 14910, 17508, 18542, 19782,
+    16, 2, 26493, 223, 13592, 11370, 11828, 17117,
+    0, 0, 27190, 5505, 1040, 292, 19820, 444,
+    16385, 2, 16732, 170, 10056, 14285, 16624, 17561,
+    1, 2, 43225, 115, 13592, 20883, 21419, 21263,
+    2, 2, 47408, 3, 13592, 15206, 15664, 19338,
+    4096, 2, 50894, 3, 14910, 16127, 18222, 18301,
+    0, 2, 44620, 249, 12136, 12444, 20140, 13415,
+    0, 1, 39042, 1191, 11720, 15053, 26853, 12971,
+    16384, 2, 23007, 380, 13523, 9989, 19181, 11046,
+    6, 2, 42528, 3, 14910, 27635, 23976, 26001,
+    32, 2, 51591, 60, 19765, 20883, 39960, 13119,
+    0, 2, 34859, 524, 11443, 10296, 19820, 11194,
+    17408, 2, 50894, 157, 8669, 14132, 23657, 13415,
+    1, 2, 18127, 236, 16991, 14439, 23017, 12230,
+    0, 2, 13944, 304, 13592, 16938, 21738, 17081,
+    0, 2, 32070, 498, 13592, 11830, 20140, 12675,
+    2, 2, 12549, 367, 13592, 20116, 26853, 15784,
+    4, 2, 54380, 223, 1734, 13672, 5115, 30147,
+    0, 2, 35556, 223, 14078, 15360, 23976, 14451,
+    0, 2, 16035, 52, 13939, 21344, 29411, 17117,
+    512, 2, 34859, 157, 13592, 12598, 21738, 12823,
+    512, 2, 34859, 248, 17684, 16615, 22697, 16239,
+    0, 2, 13944, 236, 17684, 17968, 29411, 14451,
+    256, 1, 50894, 2884, 13523, 13211, 26214, 11638,
+    0, 2, 27887, 248, 13523, 14746, 21738, 15044,
+    1, 2, 23704, 34, 6588, 8301, 19501, 9121,
+    272, 2, 41831, 262, 13939, 12598, 23017, 12230,
+    0, 2, 59260, 786, 4508, 8455, 12468, 12527,
+    258, 2, 50894, 380, 10056, 14285, 17902, 16524,
+    1, 2, 19521, 304, 13592, 16938, 21738, 17081,
+    512, 2, 36253, 5, 14910, 17201, 20779, 18005,
+    64, 2, 42528, 56, 14910, 18275, 28132, 15044,
+    1, 2, 32768, 26, 16991, 13518, 28132, 11194,
+    17, 2, 19521, 170, 5895, 10910, 13746, 15044,
+    2048, 2, 29282, 304, 13592, 14285, 21419, 14451,
+    2048, 2, 24401, 33, 15604, 14746, 21419, 15044,
+    1, 2, 23704, 127, 16297, 11984, 15025, 15784,
+    16384, 2, 26493, 249, 16297, 14132, 29731, 11194,
+    0, 2, 20218, 301, 13592, 18735, 25894, 16524,
+    3, 2, 33465, 248, 13939, 11984, 27493, 10157,
+    2, 2, 49500, 459, 10749, 16127, 17583, 18894,
+    512, 2, 31373, 20, 36408, 35307, 20460, 37106,
+    1, 2, 9761, 248, 13939, 16615, 22697, 16239,
+    1, 2, 39739, 183, 16991, 14746, 27812, 12379,
+    0, 2, 25099, 183, 8669, 15206, 20779, 15932,
+    0, 2, 32070, 393, 9362, 23952, 21419, 24224,
+    130, 2, 50197, 79, 10056, 17968, 17263, 21263,
+    16384, 2, 23704, 111, 12136, 18275, 12148, 27037,
+    0, 2, 42528, 157, 14078, 20116, 24296, 18449,
+    514, 2, 51591, 236, 12830, 27788, 21738, 27964,
+    513, 2, 25099, 33, 13523, 12291, 27493, 10306,
+    0, 2, 46711, 485, 12830, 9836, 21419, 10306,
+    16385, 2, 17430, 33, 12136, 17968, 18222, 20374,
+    0, 2, 48105, 236, 12136, 12598, 20460, 13267,
+    5, 2, 36951, 304, 13592, 12598, 19501, 13859,
+    4097, 2, 46711, 524, 7282, 17201, 19820, 18597,
+    5, 2, 35556, 248, 13939, 14592, 13746, 20078,
+    0, 2, 27190, 96, 13523, 18121, 23657, 17117,
+    512, 2, 54380, 549, 7282, 11523, 22058, 11638,
+    2, 2, 43922, 878, 13523, 16434, 28132, 13563,
+    0, 2, 59958, 262, 8669, 14592, 20140, 15636,
+    16, 1, 62746, 1442, 11443, 12137, 19181, 13415,
+    272, 2, 45317, 131, 13523, 13518, 21419, 13711,
+    1, 2, 21613, 273, 13592, 13518, 16943, 16228,
+    0, 2, 20915, 446, 13939, 15513, 21099, 16228,
+    0, 2, 56472, 328, 7282, 16741, 12787, 24076,
+    1, 2, 35556, 341, 13592, 13518, 19820, 14600,
+    16385, 2, 20915, 210, 13592, 24719, 24296, 23039,
+    16387, 2, 22310, 354, 21845, 21497, 17902, 24816,
+    1, 2, 10458, 236, 13523, 15360, 23976, 14451,
+    258, 2, 53683, 341, 1734, 12904, 21419, 13119,
+    17, 2, 49500, 304, 13592, 12444, 21099, 12823,
+    0, 1, 23704, 4063, 11443, 9836, 20460, 10454,
+    2048, 2, 32768, 354, 15604, 13979, 21099, 14451,
+    0, 2, 43922, 511, 13592, 15820, 20779, 16524,
+    0, 2, 41831, 106, 15604, 15360, 23657, 14451,
+    8, 2, 55077, 288, 11443, 12291, 26534, 10898,
+    1, 2, 31373, 419, 7282, 18428, 21099, 19042,
+    16, 2, 49500, 760, 9362, 15973, 25255, 14451,
+    2, 2, 41134, 4, 13592, 24259, 23976, 22891,
+    0, 2, 27190, 262, 12136, 19502, 18861, 21707,
+    1025, 2, 39042, 472, 16991, 8762, 21099, 9121,
+    512, 2, 45317, 341, 14910, 16280, 21738, 16421,
+    1, 1, 41831, 1035, 19765, 17354, 23657, 16524,
+    0, 2, 52986, 537, 14078, 14592, 26853, 12527,
+    2, 2, 39739, 38, 13592, 19656, 22697, 19190,
+    18, 2, 34162, 42, 10056, 20730, 24296, 19042,
+    0, 2, 32768, 20, 13523, 18582, 21738, 18894,
+    3, 2, 48803, 1022, 9362, 16587, 21738, 16821,
+    263, 2, 47408, 12, 13592, 19656, 13427, 27185,
+    1, 1, 42528, 1126, 7282, 12444, 14705, 16524,
+    16385, 1, 42528, 1442, 6588, 15053, 16304, 18597,
+    0, 2, 29979, 210, 13592, 14439, 16943, 17413,
+    1, 2, 39042, 144, 13592, 17968, 23017, 17413,
+    0, 2, 23704, 248, 13939, 16615, 22697, 16239,
+    0, 2, 47408, 66, 5201, 12904, 19501, 14155,
+    0, 0, 41831, 13893, 1734, 322, 26534, 311,
+    0, 2, 34162, 304, 13592, 16938, 21738, 17081,
+    544, 2, 18824, 13, 65535, 13365, 26853, 11490,
+    0, 2, 28584, 13, 10056, 12904, 16624, 15784,
+    0, 2, 52289, 122, 14078, 21344, 25894, 18745,
+    0, 2, 57866, 459, 13939, 11370, 14705, 15044,
+    0, 2, 41134, 210, 14078, 16741, 22378, 16524,
+    4098, 2, 23704, 170, 10749, 12904, 21738, 13034,
+    0, 2, 19521, 354, 13592, 15513, 20779, 16228,
+    3, 2, 41134, 0, 13592, 23339, 15984, 29110,
+    0, 2, 11852, 197, 17684, 12751, 20140, 13563,
+    1, 2, 38345, 288, 14910, 13365, 17902, 15488,
+    4096, 2, 37648, 118, 15604, 17508, 21419, 17857,
+    0, 2, 47408, 380, 9362, 20270, 29091, 16376,
+    0, 2, 47408, 236, 13523, 11523, 21738, 11650,
+    1025, 1, 22310, 1573, 10056, 12751, 23017, 12379,
+    259, 2, 52289, 865, 6588, 13518, 24296, 12675,
+    1, 2, 36253, 85, 14078, 12904, 17583, 15192,
+    0, 2, 44620, 26, 16297, 19349, 22378, 19042,
+    1, 2, 18824, 170, 13592, 11830, 15664, 15044,
+    2, 2, 41134, 26, 13939, 23952, 25255, 21707,
+    1, 2, 53683, 93, 3121, 15666, 17263, 18745,
+    0, 2, 51591, 122, 13592, 19042, 21099, 19634,
+    2, 2, 41134, 446, 7975, 16280, 18542, 18449,
+    1, 2, 47408, 76, 7975, 13211, 19820, 14303,
+    0, 2, 48803, 73, 3814, 7074, 8312, 12971,
+    258, 2, 16732, 315, 14910, 22878, 34526, 16228,
+    2, 2, 31373, 66, 11443, 19809, 23657, 18894,
+    1, 2, 26493, 183, 16297, 16741, 23976, 15784,
+    0, 2, 47408, 66, 6588, 16587, 18222, 19042,
+    16657, 1, 42528, 1704, 5201, 12291, 16943, 14896,
+    1, 2, 38345, 105, 11443, 13825, 14386, 18449,
+    256, 2, 30676, 0, 13939, 19809, 19820, 21411,
+    0, 2, 50197, 3, 15604, 18275, 18542, 20670,
+    0, 2, 41134, 248, 7975, 12904, 14066, 17561,
+    0, 2, 38345, 655, 13592, 14592, 23337, 14007,
+    2, 2, 50894, 485, 14910, 14746, 24296, 13859,
+    0, 2, 42528, 170, 10056, 14285, 19181, 15784,
+    0, 2, 48803, 197, 13523, 14285, 24296, 13267,
+    0, 2, 48105, 668, 1040, 8608, 14386, 11786,
+    16385, 2, 18824, 147, 17684, 18275, 21419, 18449,
+    2, 2, 36951, 406, 12830, 14592, 23337, 14007,
+    3, 2, 44620, 1573, 7975, 17661, 19820, 18894,
+    2, 2, 46711, 39, 11443, 21651, 21738, 21855,
+    0, 1, 39042, 1704, 7975, 16127, 19820, 17413,
+    2, 2, 43922, 157, 15604, 26714, 39321, 16969,
+    16385, 2, 13944, 210, 11443, 11677, 15664, 14748,
+    0, 2, 53683, 301, 13939, 11830, 18542, 13415,
+    387, 2, 52986, 249, 10749, 17047, 22697, 16524,
+    0, 2, 57169, 197, 14910, 16741, 22058, 16672,
+    64, 2, 42528, 852, 12136, 14439, 32288, 10898,
+    16385, 2, 17430, 66, 12136, 16587, 17583, 19486,
+    4096, 2, 20218, 248, 13939, 16615, 22697, 16239,
+    0, 2, 27190, 406, 14910, 15360, 26214, 13415,
+    1, 2, 16732, 304, 13592, 16938, 21738, 17081,
+    0, 2, 59260, 223, 10749, 18582, 23337, 17709,
+    1, 2, 50197, 110, 8669, 9682, 28132, 7936,
+    0, 2, 48105, 288, 13592, 16741, 14386, 22299,
+    0, 2, 32768, 301, 5895, 15666, 10550, 25260,
+    1, 2, 35689, 50, 13523, 16894, 25575, 15044,
+    1, 2, 41134, 751, 12136, 16280, 24296, 15044,
+    0, 2, 10458, 472, 17684, 13979, 21099, 14451,
+    273, 2, 51591, 682, 13592, 14285, 19501, 15636,
+    0, 2, 29979, 183, 19765, 14899, 22058, 14896,
+    0, 2, 46711, 183, 16297, 22418, 28132, 18301,
+    0, 2, 26493, 223, 3121, 11370, 26214, 10009,
+    1, 2, 48105, 144, 13592, 9836, 17583, 11638,
+    16, 2, 56472, 26, 9362, 16894, 18222, 19190,
+    256, 2, 23007, 157, 13592, 15666, 25255, 14303,
+    256, 2, 46711, 273, 13592, 14899, 24296, 13859,
+    0, 2, 51591, 183, 13592, 11370, 13746, 15784,
+    513, 2, 36951, 5, 21152, 35000, 21738, 35329,
+    4, 2, 21613, 304, 13592, 11370, 14386, 15192,
+    0, 2, 32070, 39, 14078, 17047, 19820, 18301,
+    2, 2, 39042, 0, 15604, 32238, 25894, 28518,
+    1024, 2, 39042, 249, 14078, 16894, 23337, 16228,
+    1, 2, 39042, 170, 13592, 19963, 23017, 19338,
+    512, 2, 27887, 20, 50278, 65535, 25894, 58132,
+    1, 2, 37648, 446, 15604, 12751, 25575, 11490,
+    0, 2, 23704, 223, 13592, 13365, 17902, 15488,
+    512, 2, 24401, 273, 11443, 12291, 9590, 20818,
+    0, 2, 36253, 7, 29473, 27788, 29091, 22595,
+    1, 2, 21613, 100, 14078, 12137, 18542, 13711,
+    16385, 2, 25796, 262, 12830, 20883, 21738, 21115,
+    1, 2, 47408, 236, 13592, 11370, 18222, 13119,
+    2050, 2, 30676, 170, 8669, 10756, 24296, 10009,
+    0, 2, 44620, 223, 16297, 10756, 19501, 11786,
+    0, 2, 27190, 4325, 21845, 16938, 21738, 17081,
+    0, 2, 45317, 109, 15604, 16894, 17902, 19486,
+    0, 2, 53683, 367, 14910, 15666, 23337, 15192,
+    4097, 1, 37648, 1311, 14078, 9529, 23017, 9259,
+    1, 2, 53683, 4, 12136, 18275, 25255, 16524,
+    1, 2, 57169, 249, 3121, 20116, 14386, 26741,
+    256, 1, 10458, 813, 11720, 16127, 27493, 13563,
+    2, 2, 45317, 3, 16297, 18275, 20460, 19338,
+    16, 2, 54380, 511, 5895, 13365, 10869, 21115,
+    16385, 2, 43225, 577, 13592, 20423, 23017, 19782,
+    1, 2, 39042, 3, 14078, 14439, 14066, 19634,
+    513, 2, 28584, 5, 14078, 16587, 19501, 18153,
+    0, 2, 21613, 262, 11443, 13672, 23337, 13119,
+    1, 2, 43225, 183, 13523, 20423, 27493, 17265,
+    256, 2, 25099, 288, 13939, 14899, 27493, 12527,
+    0, 2, 50197, 315, 13523, 17815, 20460, 18745,
+    1, 2, 48105, 315, 13939, 10296, 19820, 11194,
+    520, 2, 18824, 315, 14078, 18735, 22697, 18301,
+    64, 2, 16732, 1835, 13939, 11984, 19820, 12971,
+    1, 2, 42528, 549, 14910, 15513, 26534, 13415,
+    0, 0, 46711, 5636, 1734, 1703, 23976, 1639,
+    257, 2, 36253, 94, 13592, 17968, 19181, 20226,
+    2, 2, 48803, 341, 8669, 13825, 16943, 16672,
+    16385, 2, 19521, 223, 15604, 20270, 22058, 20374,
+    1, 2, 37648, 3, 14910, 10449, 23017, 10157,
+    0, 2, 56472, 66, 13939, 18735, 17902, 21707,
+    0, 2, 38345, 66, 15604, 12598, 16943, 15192,
+    16, 2, 39739, 304, 13592, 15820, 27173, 13563,
+    544, 2, 27887, 26, 13939, 65535, 25894, 58132,
+    16385, 2, 27887, 210, 21152, 8915, 20779, 9417,
+    0, 2, 49500, 7, 9362, 13211, 27173, 11342,
+    1, 1, 46711, 1966, 13523, 11984, 23337, 11638,
+    1, 2, 35556, 39, 7975, 15053, 19820, 16228,
+    0, 2, 50894, 144, 9362, 17354, 16943, 20818,
+    2, 2, 27887, 734, 9362, 19502, 28132, 16228,
+    0, 2, 53683, 249, 16297, 16280, 22697, 15913,
+    2, 2, 57866, 39, 13939, 23185, 22058, 23187,
+    256, 2, 31373, 341, 5201, 14439, 19501, 15784,
+    1026, 2, 32768, 157, 13592, 15666, 14066, 21263,
+    0, 2, 48105, 248, 13939, 16615, 22697, 16239,
+    0, 2, 55774, 170, 10749, 13979, 16624, 17265,
+    0, 2, 20218, 79, 21845, 18428, 32288, 13859,
+    2, 2, 48803, 42, 10749, 24719, 26534, 21559,
+    2048, 2, 23007, 249, 14078, 17661, 29411, 14155,
+    16, 1, 40436, 891, 4508, 12444, 15984, 15488,
+    512, 2, 44620, 3, 21152, 17047, 20140, 18301,
+    1, 2, 38345, 210, 9362, 13365, 16624, 16376,
+    128, 2, 52986, 5112, 7975, 6920, 27493, 5864,
+    0, 2, 15338, 472, 13592, 21037, 39001, 13415,
+    0, 2, 29282, 92, 16991, 14746, 26853, 12823,
+    0, 1, 18824, 931, 11443, 14285, 19501, 15636,
+    3, 2, 38345, 4, 18378, 32085, 27812, 26889,
+    1, 2, 50197, 144, 10749, 13211, 14705, 17265,
+    8, 2, 23007, 26, 19071, 24106, 39321, 15340,
+    17, 2, 36253, 81, 11443, 17354, 23017, 16821,
+    16385, 2, 18824, 66, 14910, 13211, 24296, 12082,
+    16384, 2, 41134, 406, 12136, 14132, 20140, 15044,
+    0, 2, 38345, 629, 13592, 12291, 17902, 14303,
+    0, 2, 28584, 304, 13592, 17047, 19820, 18449,
+    1025, 1, 23007, 1311, 14910, 12751, 20140, 13711,
+    1, 2, 9761, 118, 19765, 15053, 21738, 15340,
+    1, 2, 23007, 273, 11443, 20730, 23976, 19486,
+    0, 2, 29979, 210, 13592, 11523, 16624, 14155,
+    4096, 2, 16732, 131, 21845, 17508, 26534, 15192,
+    256, 2, 48105, 0, 11443, 10449, 25575, 9417,
+    128, 2, 40436, 33, 16297, 16280, 22058, 16376,
+    0, 2, 14641, 118, 16991, 16434, 23017, 15932,
+    0, 2, 9761, 144, 13592, 18889, 28132, 15784,
+    0, 2, 39739, 18, 13523, 26407, 24296, 24076,
+    10, 2, 49500, 52, 13939, 28095, 30690, 21855,
+    0, 1, 25796, 2490, 7975, 15206, 21419, 15442,
+    0, 2, 45317, 79, 16297, 14899, 23017, 14451,
+    1, 2, 24401, 66, 18378, 24566, 24296, 22743,
+    0, 2, 51591, 75, 13592, 20270, 19181, 22299,
+    642, 2, 41831, 4719, 7975, 16280, 24296, 14896,
+    4096, 2, 36951, 183, 16991, 8148, 19820, 8825,
+    0, 2, 50894, 236, 15604, 17047, 26214, 15044,
+    256, 1, 46711, 2490, 11720, 13825, 29411, 11046,
+    0, 2, 45317, 51, 15604, 15206, 22697, 14869,
+    0, 2, 30676, 249, 15604, 13672, 24296, 12675,
+    0, 2, 40436, 39, 14078, 12137, 19181, 13415,
+    0, 2, 57169, 380, 13939, 12598, 11828, 19042,
+    1, 2, 39042, 367, 5201, 6920, 13427, 9861,
+    0, 2, 27887, 197, 14078, 14132, 22058, 14155,
+    0, 2, 21613, 170, 12830, 12444, 15984, 15488,
+    16, 2, 53683, 248, 13939, 16615, 22697, 16239,
+    0, 2, 52986, 56, 13592, 13825, 20779, 14451,
+    512, 1, 28584, 813, 11443, 10603, 19501, 11638,
+    0, 2, 44620, 41, 1734, 11830, 14066, 16080,
+    1024, 2, 25796, 76, 15604, 14746, 21738, 14896,
+    1, 2, 14641, 249, 14078, 11217, 16304, 13859,
+    0, 2, 26493, 273, 13939, 16615, 22697, 16239,
+    0, 2, 46711, 249, 13523, 14899, 20460, 15784,
+    1, 2, 34162, 26, 12136, 19502, 26853, 16821,
+    512, 2, 41831, 328, 13523, 15053, 18222, 17265,
+    16385, 2, 15338, 98, 14910, 15820, 19181, 17413,
+    256, 2, 50894, 304, 2427, 16938, 21738, 17081,
+    2, 2, 43922, 248, 13939, 16615, 22697, 16239,
+    0, 1, 49500, 1271, 7282, 11370, 16304, 14007,
+    0, 2, 47408, 380, 13592, 16434, 23976, 15488,
+    0, 2, 48803, 109, 13592, 15513, 18861, 17413,
+    1, 2, 39042, 105, 12830, 16280, 15984, 20226,
+    16385, 2, 43225, 197, 14078, 19349, 25575, 17413,
+    1, 2, 31373, 223, 9362, 13825, 15664, 17561,
+    17, 2, 20915, 8, 13592, 18428, 21738, 18575,
+    0, 2, 48105, 46, 1734, 6306, 3197, 17117,
+    512, 2, 55077, 72, 2427, 13365, 13746, 18449,
+    16, 2, 9761, 406, 13592, 13058, 14705, 17265,
+    1, 2, 43225, 67, 13592, 10910, 11189, 16821,
+    256, 1, 22310, 5374, 11443, 14132, 23657, 13415,
+    1, 2, 50894, 131, 14078, 11370, 20140, 12082,
+    1, 2, 20218, 144, 21152, 17815, 25575, 15784,
+    17, 2, 57866, 88, 5895, 10296, 15984, 12971,
+    1, 2, 29979, 33, 13939, 15820, 23657, 15192,
+    8, 2, 13944, 170, 12136, 14132, 21738, 14303,
+    514, 2, 43225, 419, 13592, 24106, 22378, 23632,
+    512, 2, 32768, 380, 11443, 11063, 22058, 11046,
+    0, 2, 23704, 144, 13592, 13365, 15664, 16969,
+    257, 1, 47408, 3146, 11443, 11063, 17902, 12823,
+    4, 2, 38345, 157, 13592, 17968, 22378, 17709,
+    1, 2, 55774, 85, 8669, 13518, 18861, 15044,
+    0, 2, 35208, 144, 13523, 17661, 27173, 15044,
+    0, 2, 43922, 341, 13592, 21344, 29411, 17117,
+    1, 2, 42528, 197, 8669, 10449, 21738, 10572,
+    1, 2, 32768, 248, 16297, 19502, 30690, 15192,
+    0, 2, 23704, 273, 13592, 19809, 26853, 17117,
+    0, 2, 30676, 248, 13939, 8301, 18222, 9269,
+    2, 2, 43922, 26, 13939, 14592, 14066, 19782,
+    1, 2, 46014, 101, 13592, 20270, 28132, 16821,
+    1, 2, 41831, 58, 13939, 11063, 10230, 18005,
+    1, 2, 41831, 248, 13939, 16615, 22697, 16239,
+    2, 2, 36253, 31, 13592, 23032, 21419, 23484,
+    1, 2, 40436, 288, 8669, 11523, 15345, 14896,
+    1, 2, 39739, 273, 16297, 14132, 21419, 14451,
+    1, 2, 36253, 52, 13939, 17201, 19820, 18597,
+    2, 2, 37648, 0, 12830, 15973, 14705, 20966,
+    1, 2, 17430, 144, 13523, 10603, 13107, 15044,
+    0, 2, 45317, 13, 12136, 16127, 13746, 22003,
+    257, 1, 43225, 878, 10056, 15053, 11828, 22595,
+    16, 2, 56472, 273, 11443, 14746, 20140, 15636,
+    2, 2, 34859, 33, 12830, 15053, 25575, 13563,
+    0, 2, 28584, 79, 16991, 18735, 30050, 14748,
+    2, 2, 41831, 1060, 7975, 13672, 21738, 13859,
+    0, 2, 52986, 10, 16991, 31471, 18542, 35477,
+    1, 2, 36951, 446, 13592, 10603, 21738, 10725,
+    0, 2, 47408, 87, 13592, 15973, 18542, 18005,
+    1, 2, 30676, 433, 13523, 13825, 22378, 13711,
+    0, 2, 43225, 0, 13939, 19042, 20460, 20078,
+    0, 2, 41134, 131, 10056, 15206, 22697, 14869,
+    0, 2, 34859, 304, 13592, 16938, 21738, 17081,
+    0, 2, 49500, 131, 13592, 14285, 19820, 15488,
+    0, 2, 39042, 446, 13592, 11063, 21419, 11342,
+    0, 2, 25796, 52, 16297, 15206, 26853, 13267,
+    16384, 2, 25099, 144, 13523, 14439, 22697, 14155,
+    0, 2, 42528, 248, 13939, 16615, 22697, 16239,
+    6144, 2, 25796, 248, 13939, 16615, 22697, 16239,
+    0, 2, 50894, 210, 15604, 17661, 22058, 17413,
+    0, 1, 57866, 1573, 11720, 15053, 25575, 13563,
+    16, 2, 18824, 328, 4508, 12904, 25575, 11638,
+    3, 2, 28584, 7209, 13592, 11370, 22058, 11490,
+    0, 2, 62746, 615, 9362, 15053, 19181, 16672,
+    1, 2, 13944, 46, 5895, 9989, 21738, 10110,
+    0, 2, 29979, 118, 12136, 17815, 22378, 17413,
+    1, 2, 19521, 249, 12136, 13825, 13107, 19634,
+    1, 0, 40436, 5505, 1040, 1703, 28132, 1421,
+    512, 1, 46711, 2621, 16991, 16587, 41239, 10157,
+    0, 2, 31373, 79, 15604, 15053, 22697, 14748,
+    1, 2, 25099, 341, 15604, 9989, 21099, 10306,
+    0, 2, 25099, 354, 23925, 31317, 21738, 31504,
+    0, 2, 42528, 210, 12830, 9682, 13746, 13415,
+    0, 2, 51591, 315, 17684, 16127, 24296, 14748,
+    0, 2, 45317, 93, 11443, 15206, 26853, 13267,
+    0, 2, 23704, 328, 7975, 18582, 26853, 16080,
+    513, 2, 39042, 248, 12136, 10449, 14066, 14303,
+    1, 2, 49500, 88, 12136, 14746, 22378, 14600,
+    0, 2, 21613, 12, 15604, 32085, 33886, 23039,
+    256, 0, 45317, 6291, 3121, 198, 34526, 104,
+    0, 2, 52289, 104, 13592, 14285, 22697, 14007,
+    1, 2, 8366, 183, 13592, 12137, 21419, 12379,
+    2048, 2, 21613, 210, 11443, 15206, 19501, 16672,
+    512, 2, 29282, 144, 15604, 21037, 29411, 16821,
+    0, 2, 49500, 367, 13592, 17047, 21419, 17413,
+    256, 2, 59958, 26, 10056, 19809, 18542, 22299,
+    0, 2, 46711, 288, 16297, 17508, 24296, 16376,
+    1, 2, 43225, 144, 15604, 13365, 19181, 14748,
+    0, 2, 56472, 22, 12136, 17815, 20140, 18894,
+    258, 2, 50894, 3670, 13939, 10910, 23976, 10306,
+    0, 2, 48105, 183, 12136, 13058, 27493, 10898,
+    768, 2, 41134, 273, 10749, 20423, 21738, 20577,
+    0, 2, 34162, 236, 16991, 17047, 26534, 14896,
+    2, 2, 38345, 0, 13939, 25640, 21738, 25853,
+    10, 2, 23007, 3408, 25312, 15973, 29731, 12675,
+    0, 1, 15338, 944, 23925, 18889, 35165, 13267,
+    0, 2, 18824, 66, 16991, 12444, 24296, 11342,
+    272, 2, 46014, 301, 18378, 18582, 23337, 17857,
+    0, 2, 31373, 114, 17684, 19349, 36444, 13119,
+    0, 2, 16035, 248, 13939, 16615, 22697, 16239,
+    0, 2, 52289, 97, 13592, 20116, 23657, 19042,
+    16, 2, 44620, 170, 9362, 21651, 32608, 15932,
+    0, 2, 47408, 9, 18378, 18428, 32288, 13711,
+    0, 2, 49500, 419, 13592, 14439, 21419, 14748,
+    0, 2, 43225, 248, 13939, 16615, 22697, 16239,
+    17, 2, 29979, 170, 10056, 9375, 23337, 8973,
+    4096, 2, 16732, 68, 12136, 15973, 20779, 16672,
+    2, 2, 44620, 7, 23232, 31778, 24296, 29110,
+    1, 1, 41134, 917, 11443, 14285, 20779, 14896,
+    0, 2, 57866, 288, 1734, 10756, 18222, 12379,
+    1, 2, 32768, 315, 18378, 16434, 25894, 14600,
+    1, 2, 20915, 223, 9362, 9068, 11509, 14155,
+    0, 2, 57169, 12, 13592, 15206, 20779, 15932,
+    1, 2, 11155, 210, 22538, 12444, 21738, 12572,
+    32, 2, 17430, 39, 13939, 22725, 54026, 10898,
+    16385, 2, 34859, 115, 14078, 13058, 18222, 15044,
+    513, 2, 27887, 0, 10056, 14899, 23337, 14303,
+    17, 2, 41831, 236, 15604, 13211, 18222, 15192,
+    0, 2, 41831, 115, 1734, 6613, 9590, 11342,
+    7, 2, 47408, 5, 9362, 24566, 17263, 29110,
+    0, 2, 39042, 30, 13592, 12598, 15345, 16080,
+    0, 2, 33465, 13, 1734, 4465, 7672, 8529,
+    0, 1, 55077, 1087, 11443, 17201, 18542, 19486,
+    2, 2, 23704, 33, 13523, 18121, 16943, 21559,
+    1, 2, 18127, 288, 11443, 13211, 18542, 15044,
+    1, 1, 43922, 1218, 16991, 13672, 21419, 13893,
+    0, 2, 43225, 760, 8669, 13672, 21099, 14155,
+    0, 2, 24401, 157, 13592, 17508, 25894, 15488,
+    2, 2, 31373, 262, 13592, 11523, 20779, 12082,
+    2, 2, 41831, 367, 11443, 14285, 17583, 16821,
+    0, 2, 20218, 273, 12136, 15053, 23976, 14155,
+    544, 2, 14641, 249, 13592, 27481, 53387, 13415,
+    1, 2, 15338, 223, 6588, 17201, 20460, 18153,
+    0, 2, 48803, 64, 13523, 18428, 21738, 18575,
+    2, 2, 41134, 68, 9362, 19656, 22378, 19338,
+    0, 2, 15338, 354, 13592, 9375, 16624, 11490,
+    2, 2, 32070, 304, 13592, 16938, 21738, 17081,
+    0, 2, 39739, 170, 12136, 16587, 20460, 17413,
+    0, 2, 17430, 446, 13939, 15513, 26853, 13267,
+    0, 2, 20915, 288, 16991, 12598, 16943, 15192,
+    128, 2, 50894, 66, 16297, 14899, 25255, 13415,
+    16387, 2, 14641, 87, 14910, 17968, 30050, 14155,
+    0, 2, 44620, 210, 12830, 19656, 21419, 20078,
+    2048, 2, 13944, 248, 13939, 19809, 18861, 22151,
+    1, 2, 65535, 577, 2427, 7841, 10869, 12527,
+    0, 2, 54380, 249, 8669, 10756, 15345, 13859,
+    16385, 2, 47408, 54, 13592, 17508, 27493, 14896,
+    0, 1, 40436, 1704, 11443, 9375, 22058, 9417,
+    0, 2, 43225, 288, 13592, 17354, 22378, 17117,
+    1, 2, 37648, 236, 6103, 13211, 12148, 19634,
+    4096, 2, 25796, 183, 13592, 13825, 17583, 16228,
+    8, 2, 39042, 433, 16991, 9682, 20140, 10454,
+    16, 2, 39739, 304, 13592, 16938, 21738, 17081,
+    0, 2, 34859, 10, 19071, 16280, 19820, 17561,
+    128, 1, 42528, 852, 11443, 16434, 36124, 11194,
+    0, 2, 29282, 262, 17684, 12904, 27173, 11194,
+    2, 2, 44620, 197, 11443, 17354, 25255, 15636,
+    1025, 2, 30676, 301, 14910, 14592, 20779, 15192,
+    0, 2, 39739, 28, 13523, 21344, 23976, 20078,
+    515, 2, 20218, 7, 12830, 16741, 15664, 21115,
+    4096, 2, 32070, 83, 17684, 24106, 29411, 19486,
+    0, 2, 49500, 5, 17684, 32392, 22697, 31627,
+    256, 2, 46711, 76, 13939, 22571, 23976, 21263,
+    16, 2, 40436, 564, 7282, 10296, 23017, 10009,
+    0, 2, 50197, 1, 12136, 26100, 23017, 25260,
+    0, 1, 16732, 3460, 15604, 10756, 25894, 9565,
+    1, 2, 24401, 197, 22538, 19809, 29731, 15932,
+    0, 2, 42528, 105, 8669, 16434, 26853, 14155,
+    256, 2, 40436, 85, 13939, 18889, 32927, 13859,
+    257, 0, 48803, 4981, 2427, 5232, 14705, 7048,
+    1025, 2, 39042, 183, 16991, 15053, 23976, 13859,
+    0, 2, 17430, 183, 14910, 17354, 27493, 14748,
+    0, 2, 14641, 157, 15604, 16938, 21738, 17081,
+    0, 2, 19521, 183, 14078, 21958, 29411, 17561,
+    1, 2, 16732, 170, 13592, 11370, 18861, 12675,
+    0, 2, 32070, 249, 11443, 14592, 25575, 12971,
+    0, 2, 47408, 197, 12136, 21344, 27173, 18153,
+    16385, 2, 27190, 301, 14910, 18428, 25894, 16376,
+    0, 0, 53683, 826, 6311, 8608, 22378, 8529,
+    0, 2, 51591, 170, 13592, 17661, 20140, 18894,
+    1, 2, 49500, 111, 11443, 11984, 19501, 13119,
+    1, 2, 44620, 106, 13592, 15206, 17902, 17709,
+    1, 2, 20915, 668, 13939, 13825, 22058, 13711,
+    0, 2, 16035, 248, 13939, 15360, 25894, 13711,
+    513, 2, 47408, 288, 13592, 12904, 16624, 15784,
+    16384, 2, 24401, 472, 8669, 23032, 23017, 22151,
+    0, 2, 20218, 549, 16991, 17047, 28132, 14007,
+    4161, 2, 46711, 63, 20458, 14439, 24296, 13267,
+    513, 2, 46014, 406, 13592, 17661, 23337, 16969,
+    16, 2, 48803, 197, 13523, 21190, 23976, 19930,
+    0, 2, 22310, 223, 13592, 15360, 27812, 12971,
+    0, 2, 36253, 197, 12136, 15666, 22697, 15316,
+    0, 2, 50197, 328, 13592, 15973, 26534, 13859,
+    259, 0, 48803, 3277, 1734, 4312, 12787, 6456,
+    1, 2, 55077, 183, 5201, 15666, 19181, 17413,
+    0, 2, 19521, 304, 3121, 16938, 21738, 17081,
+    0, 2, 25099, 485, 13523, 6767, 15025, 8973,
+    16385, 2, 26493, 223, 13592, 13365, 12787, 19190,
+    512, 2, 28584, 248, 7282, 13825, 15984, 17265,
+    0, 2, 52289, 144, 9362, 10910, 14386, 14600,
+    2, 2, 44620, 62, 5201, 23185, 15025, 29851,
+    512, 2, 37648, 3, 19071, 15666, 21738, 15805,
+    0, 2, 55077, 4325, 13592, 35460, 59781, 15784,
+    0, 2, 29979, 248, 13939, 16615, 22697, 16239,
+    0, 2, 65535, 126, 5201, 15360, 19501, 16821,
+    1, 2, 41134, 157, 10749, 14899, 18542, 16969,
+    16384, 2, 36951, 433, 4508, 11217, 14066, 15192,
+    0, 2, 49500, 52, 8669, 13518, 23657, 12823,
+    0, 2, 19521, 603, 10749, 14439, 26853, 12527,
+    16384, 2, 20915, 157, 11443, 15053, 18542, 16969,
+    16385, 2, 20218, 41, 19765, 21497, 35485, 14896,
+    16, 2, 53683, 131, 15604, 14285, 24296, 13267,
+    0, 2, 27190, 107, 13592, 21037, 24296, 19190,
+    0, 2, 50894, 76, 6588, 13365, 15664, 16969,
+    1, 2, 38345, 304, 12136, 19502, 20140, 20818,
+    1, 2, 43225, 341, 13592, 6920, 8631, 12527,
+    0, 1, 52289, 1218, 11443, 15973, 27173, 13711,
+    0, 2, 37648, 328, 13592, 14592, 16943, 17413,
+    0, 2, 13944, 170, 13592, 23032, 40919, 14155,
+    0, 2, 36951, 537, 5201, 11370, 17263, 13415,
+    16, 2, 25099, 183, 13592, 14899, 18542, 16969,
+    0, 2, 46711, 125, 13523, 16280, 27812, 13563,
+    0, 2, 49500, 301, 13523, 19502, 22697, 19046,
+    1, 2, 51591, 301, 17684, 13365, 22697, 13119,
+    0, 2, 22310, 248, 12830, 16615, 22697, 16239,
+    0, 2, 50197, 109, 21152, 18582, 26214, 16376,
+    0, 2, 36253, 682, 4508, 8915, 5754, 19338,
+    0, 2, 20915, 695, 9362, 8148, 19181, 9121,
+    0, 2, 14641, 406, 18378, 20423, 31649, 15488,
+    1, 2, 36253, 183, 12830, 15513, 20779, 16228,
+    1, 0, 46711, 1231, 6311, 4772, 11189, 7640,
+    16385, 2, 48803, 315, 16991, 13825, 25255, 12527,
+    0, 2, 27190, 223, 13939, 17508, 29731, 14007,
+    256, 1, 36951, 1311, 14910, 11984, 25894, 10602,
+    3, 2, 45317, 773, 10056, 16127, 19501, 17561,
+    256, 2, 19521, 210, 14910, 12904, 21419, 13267,
+    129, 2, 48105, 301, 19071, 13365, 26214, 11786,
+    256, 1, 48105, 1507, 6588, 19196, 21738, 19338,
+    2, 2, 34162, 4, 13939, 18582, 22697, 18894,
+    0, 2, 46014, 12, 10749, 29016, 28132, 23928,
+    2, 2, 51591, 917, 15604, 14132, 26214, 12379,
+    256, 2, 44620, 7, 13592, 22111, 27493, 18745,
+    1, 2, 20915, 304, 12136, 9836, 19501, 10306,
+    0, 0, 40436, 6160, 6311, 2470, 21099, 2606,
+    0, 2, 41134, 210, 11443, 23032, 24296, 20966,
+    2, 2, 39739, 8, 23232, 19349, 21419, 19782,
+    2, 2, 43922, 197, 10056, 13211, 22058, 13267,
+    1, 2, 45317, 105, 12136, 17047, 20460, 18005,
+    128, 2, 38345, 354, 10056, 15360, 21419, 15784,
+    513, 2, 30676, 26, 14078, 15053, 17902, 17561,
+    643, 2, 47408, 39, 17684, 13211, 26214, 11638,
+    386, 2, 48105, 524, 12136, 16280, 17263, 19338,
+    0, 2, 17430, 304, 13592, 18428, 24296, 16821,
+    1, 2, 32070, 79, 11443, 13979, 22697, 13674,
+    779, 2, 50894, 682, 13939, 16615, 22697, 16239,
+    768, 2, 52289, 328, 13939, 17661, 23017, 17117,
+    16384, 2, 27887, 107, 9362, 19349, 19181, 21411,
+    4096, 2, 26493, 105, 14910, 13518, 16304, 16672,
+    0, 2, 49500, 118, 13592, 23032, 22697, 22595,
+    0, 2, 46014, 249, 13939, 22878, 27173, 19634,
+    0, 2, 39042, 7, 11443, 11063, 16943, 13415,
+    0, 2, 43922, 498, 12136, 14439, 18222, 16524,
+    1, 2, 18127, 248, 13939, 11677, 16304, 14451,
+    1, 2, 29979, 248, 13939, 17661, 21419, 18005,
+    1, 2, 34162, 393, 14910, 13518, 26534, 11786,
+    0, 2, 47408, 210, 12830, 13365, 22697, 13119,
+    258, 2, 20915, 5, 18378, 24566, 21099, 25112,
+    0, 2, 36951, 406, 13939, 15513, 19820, 16821,
+    0, 2, 53683, 118, 12136, 14899, 20140, 15932,
+    1, 2, 57169, 315, 12136, 14746, 15345, 18894,
+    0, 2, 39739, 210, 13523, 17815, 26534, 15488,
+    0, 2, 55774, 273, 13592, 20577, 27812, 17265,
+    1, 2, 45317, 42, 4508, 12904, 20140, 13859,
+    1, 2, 4183, 123, 13523, 13825, 17902, 15932,
+    128, 2, 27887, 419, 8669, 11523, 22058, 11490,
+    0, 2, 49500, 183, 9362, 17201, 22058, 17117,
+    2, 2, 34859, 8, 13592, 37609, 36764, 25260,
+    17, 2, 32070, 144, 13939, 13979, 22058, 14007,
+    9, 2, 24401, 304, 20458, 10449, 18222, 12082,
+    1, 2, 18824, 7, 10749, 13518, 19181, 14896,
+    0, 2, 52986, 7, 16297, 21958, 20460, 23187,
+    0, 2, 46014, 20, 19765, 14746, 27493, 12675,
+    0, 2, 49500, 511, 16991, 12904, 26534, 11194,
+    512, 2, 13246, 118, 16297, 18428, 22697, 18153,
+    0, 2, 12549, 223, 12830, 14899, 24296, 13415,
+    0, 2, 22310, 87, 13592, 24106, 47952, 12971,
+    1, 2, 19521, 33, 7282, 6613, 22697, 15044,
+    0, 2, 54380, 273, 14910, 14439, 23337, 14007,
+    0, 2, 37648, 131, 19071, 18275, 26853, 15784,
+    0, 2, 52986, 92, 14910, 10603, 28132, 8825,
+    0, 2, 53683, 170, 12830, 18889, 19820, 20522,
+    16385, 2, 27887, 472, 23232, 14746, 25255, 13415,
+    0, 1, 30676, 1218, 10056, 8301, 13107, 11934,
+    3, 2, 39739, 341, 13939, 24719, 26214, 21707,
+    1, 2, 39739, 223, 7282, 15666, 18861, 17561,
+    1, 2, 49500, 39, 12830, 15513, 23337, 15044,
+    0, 2, 48105, 223, 13592, 14439, 27173, 12379,
+    0, 2, 27887, 110, 13592, 19502, 24296, 17857,
+    0, 2, 43922, 170, 13523, 15513, 21099, 16080,
+    1, 2, 34859, 223, 8669, 24106, 22697, 23632,
+    0, 2, 12549, 170, 16991, 22725, 29731, 18153,
+    128, 2, 45317, 354, 6588, 9836, 17583, 11490,
+    0, 2, 47408, 41, 13939, 17661, 17583, 20670,
+    2, 2, 50197, 273, 13592, 23492, 22697, 23039,
+    0, 2, 27887, 537, 13523, 19042, 24296, 17709,
+    4096, 0, 41134, 1573, 14910, 10449, 35804, 7196,
+    0, 2, 37648, 642, 13523, 14439, 18861, 16228,
+    0, 2, 49500, 301, 5895, 21037, 22697, 20540,
+    0, 1, 39739, 983, 10749, 12137, 25575, 11046,
+    1, 2, 13246, 157, 10056, 15360, 26214, 13415,
+    4096, 2, 45317, 79, 14910, 18428, 20779, 19190,
+    16384, 2, 21613, 485, 14078, 18582, 21419, 19042,
+    0, 2, 52986, 288, 1040, 11830, 16624, 14303,
+    16385, 2, 18127, 114, 12136, 14592, 23017, 14155,
+    1, 2, 40436, 197, 13592, 16894, 20460, 17857,
+    4096, 2, 29979, 304, 13592, 16938, 21738, 17081,
+    4608, 2, 43225, 12, 33634, 33466, 20779, 34737,
+    1, 2, 10458, 170, 16991, 15360, 18542, 17413,
+    0, 2, 49500, 183, 13939, 16894, 22058, 16969,
+    512, 2, 23007, 304, 13592, 16938, 21738, 17081,
+    1, 2, 12549, 110, 13523, 14592, 19181, 16228,
+    4, 2, 34859, 304, 13592, 20577, 17902, 23780,
+    0, 2, 50197, 55, 20458, 13518, 27812, 11342,
+    0, 2, 43922, 564, 13939, 17047, 24296, 15636,
+    1, 2, 26493, 72, 13939, 12291, 24296, 11490,
+    9, 2, 23007, 5, 19071, 23339, 23017, 22595,
+    0, 2, 14641, 170, 15604, 12291, 22058, 12230,
+    1, 2, 31373, 288, 13592, 17354, 23017, 16969,
+    0, 2, 15338, 341, 13523, 15513, 24296, 14155,
+    0, 2, 19521, 248, 13939, 13365, 23017, 12971,
+    0, 2, 31373, 615, 12830, 14285, 26853, 12230,
+    512, 2, 23007, 29, 19071, 14132, 26214, 12379,
+    1, 2, 44620, 157, 3814, 8915, 9590, 15192,
+    16385, 2, 30676, 170, 11443, 13365, 9271, 23039,
+    1, 2, 48803, 90, 13592, 20270, 23657, 19338,
+    16385, 2, 31373, 393, 15604, 12598, 19820, 13563,
+    1, 2, 36253, 131, 14910, 16127, 19501, 17561,
+    1, 2, 23007, 498, 13523, 12904, 27812, 10898,
+    64, 2, 51591, 109, 12830, 17354, 22697, 16969,
+    0, 2, 48105, 315, 13939, 15053, 19820, 16376,
+    0, 2, 41831, 328, 13592, 16894, 21099, 17413,
+    0, 2, 34859, 5, 25312, 25487, 27493, 21559,
+    128, 1, 50894, 904, 11720, 14439, 18861, 16228,
+    258, 2, 43225, 4, 10056, 22111, 20779, 23039,
+    16384, 2, 34162, 236, 16297, 17354, 22058, 17413,
+    0, 2, 26493, 13, 12136, 13365, 13746, 18301,
+    0, 2, 17430, 262, 13939, 20577, 43157, 12082,
+    3, 2, 52986, 118, 13939, 19656, 14705, 25705,
+    0, 2, 47408, 109, 16297, 18428, 27493, 15636,
+    0, 2, 57169, 917, 13592, 22264, 18861, 24816,
+    1024, 2, 25796, 668, 10749, 13518, 25575, 12230,
+    512, 2, 11155, 248, 13939, 16615, 22697, 16239,
+    1, 2, 39739, 84, 6588, 15360, 22697, 15019,
+    1, 2, 52986, 106, 13523, 11830, 21738, 11958,
+    521, 2, 27887, 0, 14910, 9375, 21099, 9861,
+    0, 2, 39042, 248, 13939, 16615, 22697, 16239,
+    0, 2, 61352, 328, 10749, 16127, 20460, 17117,
+    0, 2, 32070, 197, 13592, 14439, 17583, 16969,
+    2, 2, 18824, 9, 12830, 26407, 30370, 20818,
+    0, 2, 14641, 249, 13592, 22571, 24296, 20670,
+    1, 2, 26493, 1, 13592, 14592, 15025, 19042,
+    4, 2, 38345, 210, 20458, 15513, 27812, 12971,
+    0, 1, 44620, 1311, 13523, 11523, 23017, 11182,
+    0, 2, 50197, 73, 8669, 16587, 18542, 18597,
+    257, 2, 47408, 170, 12830, 15053, 22697, 14719,
+    1, 2, 35556, 433, 10056, 16587, 22378, 16524,
+    257, 2, 38345, 170, 12136, 15513, 22697, 15167,
+    0, 2, 42528, 304, 13592, 19656, 27173, 16821,
+    0, 2, 34162, 304, 13592, 16938, 21738, 17081,
+    2, 2, 33465, 33, 13939, 27788, 18542, 31331,
+    1, 2, 59958, 131, 7975, 15360, 18861, 17117,
+    2, 2, 38345, 3, 10056, 17047, 13427, 23780,
+    0, 0, 34162, 11665, 1040, 1089, 27173, 977,
+    544, 2, 23007, 0, 23925, 29936, 48272, 16080,
+    2, 2, 36951, 33, 13939, 23492, 30370, 18301,
+    1, 2, 47408, 33, 10749, 12751, 13427, 17857,
+    514, 2, 27190, 248, 13939, 16615, 22697, 16239,
+    16384, 2, 50894, 315, 7975, 14132, 16624, 17265,
+    256, 2, 22310, 223, 13592, 10143, 7672, 18894,
+    5, 2, 34859, 248, 13939, 11370, 15664, 14303,
+    16385, 2, 12549, 144, 11443, 16587, 17583, 19486,
+    0, 2, 43922, 304, 13592, 16938, 17583, 16524,
+    17, 2, 37648, 128, 13939, 15973, 22697, 15488,
+    0, 2, 40436, 1, 10056, 21037, 19181, 23336,
+    4096, 2, 42528, 4, 17684, 19196, 23976, 18005,
+    1, 2, 33465, 223, 15604, 18428, 27812, 15340,
+    2, 2, 13246, 248, 13939, 16615, 22697, 16239,
+    16, 2, 34162, 183, 12136, 18889, 25255, 16969,
+    0, 2, 55077, 341, 14910, 14439, 24296, 13563,
+    0, 2, 25099, 157, 13592, 23952, 48592, 12675,
+    2, 2, 52986, 304, 13592, 16938, 21738, 17081,
+    8, 2, 14641, 315, 11443, 15360, 23017, 14896,
+    1, 2, 25099, 144, 12830, 17508, 23017, 17117,
+    2, 2, 46014, 3, 13939, 18121, 21738, 18449,
+    16, 2, 13944, 248, 13939, 16615, 22697, 16239,
+    0, 2, 26493, 248, 13939, 16615, 22697, 16239,
+    0, 2, 48105, 20, 7282, 25794, 25894, 22891,
+    3, 2, 41134, 1704, 9362, 8301, 10869, 13267,
+    0, 2, 39042, 3, 23232, 20423, 14386, 27037,
+    0, 2, 13944, 197, 13523, 11217, 23976, 10454,
+    0, 2, 34859, 273, 14910, 16615, 22697, 13711,
+    0, 2, 19521, 197, 16991, 14899, 20779, 15488,
+    1, 2, 39042, 183, 13939, 12137, 25255, 11046,
+    4096, 2, 16035, 183, 20458, 19809, 34206, 14155,
+    256, 2, 15338, 79, 13939, 11523, 25255, 10454,
+    512, 2, 19521, 144, 10056, 13825, 15025, 18005,
+    8, 2, 18824, 39, 19765, 25794, 29411, 20818,
+    0, 2, 53683, 328, 7282, 10296, 20460, 10898,
+    4128, 2, 20915, 248, 19765, 23952, 36764, 16080,
+    0, 2, 52289, 734, 6588, 21497, 17583, 25260,
+    1, 2, 21613, 304, 13592, 16938, 21738, 17081,
+    16, 2, 20915, 406, 12136, 17968, 30050, 14303,
+    16384, 2, 23007, 223, 12830, 15513, 27173, 13267,
+    2, 2, 32768, 8, 9362, 19349, 19820, 20818,
+    0, 2, 51591, 24, 6588, 22725, 13427, 31627,
+    256, 2, 28584, 262, 12136, 18889, 20140, 20078,
+    0, 2, 39739, 93, 16991, 13979, 21099, 14451,
+    2, 2, 29282, 26, 13939, 20116, 23976, 19042,
+    258, 2, 34162, 8782, 4508, 11830, 25255, 10602,
+    4098, 2, 63443, 39, 13939, 16615, 22697, 16239,
+    4, 2, 39042, 9, 13592, 21344, 18861, 23780,
+    256, 2, 46014, 301, 13592, 11984, 20140, 12823,
+    0, 2, 61352, 248, 13939, 16615, 22697, 16239,
+    0, 2, 50894, 236, 13592, 15513, 23337, 14896,
+    513, 2, 23704, 248, 14910, 11984, 21738, 12082,
+    1, 2, 30676, 249, 16991, 17047, 23337, 16376,
+    0, 2, 18824, 62, 14910, 24259, 24296, 22299,
+    0, 2, 30676, 236, 11443, 15513, 22697, 15167,
+    2, 2, 32768, 878, 13592, 24259, 42838, 14303,
+    0, 2, 47408, 157, 15604, 20270, 25255, 18449,
+    0, 2, 33465, 315, 16991, 13979, 27812, 11786,
+    0, 2, 23704, 236, 12830, 16434, 20779, 17117,
+    4640, 2, 23007, 33, 26699, 20883, 31649, 15932,
+    1, 2, 25796, 127, 10749, 15666, 18542, 17709,
+    2, 2, 16732, 210, 11443, 18428, 24296, 16821,
+    273, 1, 37648, 1126, 1734, 10756, 15345, 13859,
+    512, 2, 57866, 248, 13939, 13058, 18861, 14451,
+    0, 2, 18127, 7, 58600, 36995, 22378, 36514,
+    16385, 2, 27190, 304, 14078, 14899, 21738, 15044,
+    0, 2, 35556, 67, 13592, 15666, 24296, 14600,
+    0, 0, 28584, 4063, 5201, 1550, 29091, 1273,
+    0, 2, 23007, 20, 18378, 14285, 24296, 13119,
+    0, 2, 15338, 354, 13592, 15973, 27173, 13711,
+    1, 2, 38345, 708, 11443, 15513, 23337, 14896,
+    1, 2, 56472, 42, 10749, 14592, 19501, 15932,
+    258, 2, 46014, 262, 16991, 19963, 29091, 16228,
+    0, 1, 37648, 1218, 12830, 12598, 25255, 11490,
+    0, 2, 18824, 118, 30860, 30857, 55945, 14451,
+    0, 2, 39739, 1442, 23925, 21958, 26214, 19338,
+    512, 2, 27190, 786, 13523, 18735, 24296, 17413,
+    16385, 2, 50197, 236, 14078, 15360, 20460, 16228,
+    0, 2, 39739, 549, 14078, 12291, 29091, 9861,
+    512, 2, 32070, 50, 23232, 21651, 31329, 16524,
+    1, 2, 23007, 354, 21152, 14439, 26214, 12379,
+    0, 2, 19521, 577, 11443, 13979, 22058, 14007,
+    2, 2, 57866, 3408, 13939, 10756, 23976, 10306,
+    4608, 2, 16732, 249, 14078, 14132, 21099, 14600,
+    0, 2, 9761, 170, 13592, 23492, 23657, 22151,
+    0, 2, 57866, 273, 13592, 14132, 11189, 22003,
+    1, 2, 50197, 210, 7975, 15820, 30370, 12379,
+    1, 2, 48803, 13, 9362, 17968, 18861, 20078,
+    0, 2, 46014, 248, 13939, 16615, 22697, 16239,
+    66, 2, 49500, 131, 9362, 17968, 21099, 18597,
+    258, 2, 41831, 2228, 14910, 19656, 30050, 15636,
+    1, 2, 12549, 73, 13592, 12137, 9590, 20226,
+    6, 2, 48105, 9, 5895, 15513, 17583, 18005,
+    1, 2, 24401, 33, 16991, 15206, 21738, 15340,
+    16, 2, 48105, 102, 12830, 20423, 19820, 22151,
+    2, 2, 9761, 13, 15604, 27635, 19501, 29999,
+    1, 2, 11155, 170, 13592, 10910, 15664, 13859,
+    2, 2, 25796, 5, 10749, 22418, 22058, 22447,
+    0, 2, 55774, 419, 13592, 11063, 23017, 10750,
+    0, 2, 18127, 5, 15604, 25026, 17902, 28962,
+    1, 2, 42528, 170, 16991, 13518, 23657, 12971,
+    16384, 2, 40436, 328, 14078, 11677, 22697, 11490,
+    0, 2, 43225, 511, 12136, 15360, 17902, 18005,
+    5, 2, 46711, 304, 13592, 12751, 20779, 13267,
+    2, 2, 47408, 642, 13939, 10756, 20779, 11342,
+    0, 2, 48105, 144, 17684, 17508, 24296, 16080,
+    130, 0, 34162, 7995, 6311, 1550, 28132, 1273,
+    0, 2, 48105, 223, 13592, 16587, 17263, 19930,
+    1, 2, 46014, 734, 13592, 12598, 21099, 12971,
+    0, 2, 50894, 367, 13523, 14746, 23976, 13711,
+    0, 2, 17430, 249, 16991, 15206, 28132, 12527,
+    0, 2, 12549, 524, 14910, 13365, 28132, 11194,
+    1, 2, 14641, 301, 12136, 21804, 20460, 23039,
+    0, 2, 56472, 210, 3121, 14899, 21738, 15044,
+    1, 2, 22310, 52, 14910, 13365, 22378, 13119,
+    0, 2, 25099, 537, 16991, 17661, 22697, 17257,
+    4096, 2, 15338, 603, 13939, 23645, 45715, 13267,
+    0, 2, 21613, 1966, 13592, 24566, 40919, 15044,
+    2, 2, 34859, 8, 14910, 24719, 25894, 22003,
+    0, 0, 29282, 9175, 3121, 0, 24296, 59,
+    0, 2, 26493, 248, 13939, 16615, 22697, 16239,
+    514, 2, 55774, 511, 9362, 15206, 23657, 14451,
+    2, 2, 38345, 1245, 13939, 17201, 32927, 12675,
+    0, 2, 33465, 249, 13592, 20116, 31968, 15192,
+    2, 2, 25099, 7, 13939, 27328, 29731, 21855,
+    0, 2, 18127, 564, 16991, 15666, 23337, 14896,
+    257, 2, 54380, 315, 13939, 16615, 22697, 16239,
+    1, 2, 52289, 144, 12136, 19042, 31968, 14303,
+    1, 2, 41134, 288, 10749, 18428, 25894, 16376,
+    512, 0, 38345, 8520, 6311, 7074, 21419, 7344,
+    0, 2, 20915, 629, 17684, 13825, 28132, 11342,
+    0, 2, 47408, 1, 16297, 19042, 17902, 22151,
+    0, 2, 22310, 105, 15604, 17047, 24296, 15932,
+    17, 2, 57866, 249, 16991, 20577, 26214, 18153,
+    520, 2, 51591, 26, 23232, 15360, 33247, 11194,
+    0, 1, 55774, 1311, 0, 13518, 22058, 13415,
+    4096, 2, 16035, 83, 16297, 13979, 20779, 14600,
+    272, 2, 52986, 459, 5201, 9989, 22058, 10009,
+    0, 2, 43922, 248, 21152, 20423, 25255, 18449,
+    0, 2, 11852, 773, 14078, 13825, 21738, 14007,
+    0, 2, 23007, 944, 13592, 35460, 13427, 49099,
+    0, 2, 53683, 288, 21152, 19809, 24296, 18153,
+    0, 2, 30676, 26, 13523, 12904, 22697, 12630,
+    0, 2, 44620, 157, 13592, 13979, 16624, 17117,
+    0, 2, 31373, 157, 15604, 14592, 20779, 15192,
+    4128, 2, 19521, 183, 23232, 22111, 38682, 14303,
+    256, 1, 34162, 8126, 5895, 12904, 21099, 13267,
+    0, 0, 39739, 2621, 6311, 5539, 23017, 5419,
+    0, 2, 22310, 248, 13939, 17968, 22378, 17709,
+    1, 2, 55774, 248, 11443, 10449, 20460, 11046,
+    4, 2, 41134, 304, 13592, 14746, 23976, 13859,
+    512, 2, 41134, 354, 8669, 15666, 23337, 15044,
+    0, 2, 44620, 117, 17684, 14132, 23337, 13711,
+    0, 2, 57866, 603, 10056, 12291, 15984, 15340,
+    1, 2, 27190, 34, 13939, 17968, 24296, 16524,
+    0, 2, 7669, 304, 13592, 16938, 21738, 17081,
+    0, 2, 40436, 3, 10749, 21037, 21419, 21559,
+    0, 2, 38345, 79, 16297, 21344, 26853, 18449,
+    1, 2, 45317, 118, 12830, 10603, 17902, 12379,
+    259, 2, 52289, 157, 14078, 11984, 21099, 12379,
+    67, 2, 20915, 210, 13939, 16587, 23017, 16080,
+    2, 2, 46014, 223, 12136, 21497, 18861, 23928,
+    514, 2, 44620, 1, 12830, 13058, 16943, 15784,
+    1, 2, 43922, 603, 10056, 19963, 25575, 18005,
+    1, 2, 39739, 301, 15604, 15513, 25575, 13859,
+    2049, 2, 29979, 117, 13939, 5693, 21738, 5864,
+    0, 2, 28584, 96, 13592, 19042, 24296, 17561,
+    0, 2, 40436, 236, 19765, 18428, 32927, 13563,
+    1, 2, 39042, 131, 14910, 11677, 13427, 16524,
+    16385, 2, 25796, 96, 16297, 20270, 24296, 18745,
+    0, 2, 32768, 55, 16297, 20116, 27493, 16969,
+    1, 2, 42528, 157, 9362, 16894, 23976, 15932,
+    0, 2, 29979, 94, 5895, 14285, 15025, 18449,
+    1024, 2, 25099, 84, 14078, 13672, 22697, 13415,
+    0, 2, 16732, 248, 13939, 11523, 19820, 12527,
+    0, 2, 13944, 52, 14078, 12137, 15345, 15636,
+    1, 2, 29282, 498, 14910, 19502, 22058, 19486,
+    258, 2, 50894, 944, 8669, 14285, 22697, 14007,
+    0, 2, 41831, 248, 13939, 13518, 13746, 18597,
+    1, 2, 39042, 183, 16991, 18121, 23657, 17265,
+    258, 2, 49500, 590, 13592, 15206, 21099, 15636,
+    512, 2, 42528, 144, 16297, 11984, 22058, 12082,
+    1, 2, 41134, 248, 13939, 16615, 22697, 16239,
+    0, 2, 47408, 249, 10056, 18889, 21738, 19042,
+    0, 2, 34859, 197, 16297, 15360, 27493, 12971,
+    4096, 2, 29979, 157, 13592, 10603, 17902, 12379,
+    0, 2, 58563, 105, 14078, 14899, 24296, 13711,
+    1, 2, 26493, 50, 8669, 12444, 20140, 14007,
+    1, 2, 23704, 8, 13592, 16938, 21738, 20818,
+    0, 2, 35556, 341, 10749, 15360, 20460, 16080,
+    513, 2, 55077, 26, 12136, 16587, 22058, 16524,
+    0, 2, 43922, 157, 13592, 20730, 20779, 21559,
+    0, 2, 36253, 248, 13939, 16615, 22697, 16239,
+    0, 2, 47408, 183, 13939, 18428, 20140, 19782,
+    0, 2, 41134, 315, 13939, 16615, 22697, 16239,
+    0, 2, 54380, 105, 7975, 16894, 23337, 16080,
+    0, 2, 14641, 304, 13592, 17815, 26853, 15488,
+    5, 2, 48105, 48, 3814, 17201, 14386, 23039,
+    1, 2, 18824, 603, 10056, 13672, 23657, 12971,
+    0, 2, 47408, 262, 11443, 16280, 20779, 16969,
+    0, 2, 44620, 131, 9362, 19349, 23017, 18745,
+    0, 2, 50197, 273, 13939, 13058, 20779, 13711,
+    0, 2, 10458, 144, 14910, 13365, 22378, 13267,
+    0, 0, 50894, 2884, 7975, 10449, 26534, 9121,
+    16385, 2, 36951, 13, 12830, 15206, 20779, 15932,
+    512, 2, 49500, 197, 12136, 14439, 23017, 14007,
+    0, 2, 25796, 380, 12136, 13825, 21419, 14155,
+    256, 2, 52289, 118, 14910, 15666, 25894, 13859,
+    0, 2, 50894, 210, 13592, 23645, 30690, 18449,
+    0, 2, 29979, 183, 13592, 13979, 19820, 15192,
+    1, 2, 20218, 273, 11443, 16587, 17263, 19634,
+    3, 2, 43225, 33, 13939, 24259, 25255, 22003,
+    256, 2, 30676, 10, 13592, 25794, 19181, 28370,
+    0, 2, 38345, 52, 13939, 16615, 22697, 16239,
+    256, 2, 39042, 273, 13939, 11217, 23017, 10750,
+    0, 2, 53683, 144, 16991, 19656, 26534, 17117,
+    0, 2, 11155, 248, 13939, 12291, 22697, 12082,
+    1, 2, 49500, 249, 13592, 12751, 25894, 11342,
+    16384, 2, 14641, 157, 12830, 13672, 18861, 15192,
+    1, 2, 41831, 197, 15604, 15513, 20460, 16376,
+    512, 2, 39042, 4063, 28086, 34847, 54985, 16672,
+    64, 2, 41134, 304, 18378, 10449, 18222, 12082,
+    0, 2, 38345, 655, 11443, 8762, 15664, 11194,
+    0, 2, 34859, 210, 12830, 14285, 23017, 13859,
+    0, 2, 41831, 50, 13592, 16434, 23337, 15784,
+    0, 2, 18127, 248, 13939, 15360, 27493, 13119,
+    16385, 2, 44620, 406, 18378, 19656, 23976, 18301,
+    1, 2, 42528, 13, 4508, 10449, 14705, 13859,
+    17, 2, 40436, 39, 16297, 12751, 19820, 13859,
+    2, 2, 10458, 354, 12830, 16741, 31329, 12823,
+    2, 2, 28584, 262, 15604, 20116, 23017, 19486,
+    1, 2, 20218, 564, 13523, 23185, 23017, 22447,
+    0, 2, 48803, 39, 14078, 17815, 23976, 16821,
+    2, 2, 41831, 10, 15604, 22571, 29411, 18153,
+    1025, 2, 16732, 273, 13939, 15053, 23017, 14600,
+    512, 2, 36951, 4, 18378, 16741, 23017, 16228,
+    0, 1, 36951, 2490, 14910, 12291, 23976, 11638,
+    16, 2, 46014, 26, 5895, 11063, 14386, 14748,
+    2, 2, 40436, 76, 13592, 17968, 20779, 18745,
+    0, 2, 58563, 131, 7282, 16434, 25575, 14748,
+    256, 1, 50197, 839, 11443, 14439, 18861, 16228,
+    0, 2, 22310, 126, 21845, 23185, 33247, 16969,
+    1, 2, 18824, 288, 14910, 12137, 21099, 12527,
+    1, 2, 20218, 577, 18378, 19656, 22697, 19190,
+    256, 0, 36951, 5243, 12830, 6920, 16304, 8677,
+    128, 2, 48105, 118, 13939, 10296, 16624, 12527,
+    0, 2, 17430, 668, 13523, 11830, 15664, 15044,
+    0, 2, 9063, 472, 7975, 15360, 19181, 17117,
+    1, 2, 39739, 157, 13592, 14592, 20779, 15192,
+    0, 2, 41134, 248, 13939, 17354, 24296, 15784,
+    1, 2, 18824, 5, 17684, 21497, 25255, 19486,
+    0, 2, 51591, 105, 0, 15820, 27493, 13415,
+    4097, 2, 49500, 37, 5895, 11677, 13427, 16228,
+    1, 2, 38345, 668, 19765, 19963, 23017, 19338,
+    0, 1, 42528, 2752, 9362, 13058, 15664, 16672,
+    0, 2, 45317, 249, 14910, 16434, 29731, 13119,
+    1, 2, 32768, 273, 10749, 14285, 16304, 17709,
+    3, 2, 50894, 5, 14078, 25026, 19501, 27185,
+    16385, 2, 32070, 126, 9362, 15820, 19820, 17117,
+    1, 2, 49500, 73, 13592, 13979, 10550, 22447,
+    2, 2, 44620, 183, 12830, 16280, 20460, 17117,
+    2, 2, 52289, 9, 17684, 23645, 25894, 20966,
+    0, 2, 53683, 92, 10056, 13058, 18861, 14600,
+    0, 2, 13246, 170, 17684, 12904, 22697, 12630,
+    1, 2, 46014, 9, 13592, 20730, 22697, 20226,
+    0, 2, 52986, 354, 13523, 15360, 19820, 16524,
+    0, 2, 10458, 406, 7282, 14285, 18861, 16080,
+    258, 2, 41134, 393, 10749, 15513, 22378, 15340,
+    0, 2, 43922, 12, 6588, 15053, 17263, 17857,
+    0, 2, 39042, 301, 13592, 16127, 18542, 18153,
+    0, 2, 50197, 537, 14910, 21804, 33886, 15636,
+    0, 2, 47408, 107, 12830, 23952, 28132, 19930,
+    0, 2, 21613, 459, 12136, 13518, 19820, 14600,
+    0, 2, 57169, 288, 10056, 17201, 17902, 19930,
+    1, 2, 36253, 236, 12136, 14285, 18542, 16228,
+    0, 2, 18824, 433, 13523, 11063, 17263, 13267,
+    16384, 2, 54380, 183, 10749, 16434, 18222, 18745,
+    256, 2, 55774, 66, 14910, 15206, 18222, 17265,
+    1, 2, 50197, 13, 11443, 15973, 21099, 16376,
+    1, 2, 32070, 92, 12830, 14746, 16304, 18153,
+    64, 2, 23007, 50, 12830, 20577, 17263, 24372,
+    1, 2, 39739, 144, 13592, 9529, 21738, 9713,
+    256, 2, 25796, 236, 10749, 19656, 21738, 19807,
+    256, 2, 33465, 315, 13592, 13365, 20460, 14155,
+    0, 2, 34162, 33, 13523, 11370, 15025, 14896
+};
+
+/* bit of each binary input, -1 - index of each quantized input */
+const int16_t thyroid_packed_columns[21] = {-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, -2, -3, -4, -5, -6};
+
+#ifndef FIXEDFANN
+
+const fann_type thyroid_packed_minimum[6] = {1.000000000e-02, 0.000000000e+00, 5.000000000e-04, 2.900000000e-03, 2.800000000e-02, 2.400000000e-03};
+const fann_type thyroid_packed_scale[6] = {1.434348058e-05, 7.629510948e-06, 1.441977569e-06, 6.517128252e-06, 3.128099489e-06, 6.753643091e-06};
+
+struct packed_tests thyroid_tests = {
+    0, 3600, 21, 3, 8, 2, 16, 3,
+    thyroid_packed_columns, thyroid_packed_minimum, thyroid_packed_scale,
+    1, 0, 1
+};
+
+#elif defined(FANN_Q15)
+
+#define TEST_DECIMAL_POINT 15
+
+const fann_type thyroid_packed_minimum[6] = {328, 0, 16, 95, 918, 79};
+const fann_type thyroid_packed_scale[6] = {30802, 16384, 3097, 13995, 6717, 14503};
+
+struct packed_tests thyroid_tests = {
+    0, 3600, 21, 3, 8, 2, 16, 3,
+    thyroid_packed_columns, thyroid_packed_minimum, thyroid_packed_scale,
+    32767, 0, 32767
+};
+
+#else
+
+#define TEST_DECIMAL_POINT 10
+
+const fann_type thyroid_packed_minimum[6] = {10, 0, 1, 3, 29, 2};
+const fann_type thyroid_packed_scale[6] = {963, 512, 97, 437, 210, 453};
+
+struct packed_tests thyroid_tests = {
+    0, 3600, 21, 3, 8, 2, 16, 3,
+    thyroid_packed_columns, thyroid_packed_minimum, thyroid_packed_scale,
+    1024, 0, 1024
+};
+
+#endif // FIXEDFANN
+
+#endif // __THYROID_PACKED__
@@ -0,0 +1,733 @@
+#ifndef __THYROID_STATIC__
+#define __THYROID_STATIC__
+
+/*
+ * Statically allocated network generated by gen-infer --static, one flavour
+ * per network: the struct fann and its weights are placed in FRAM (weights
+ * in .fann_weights), the activations in SRAM (.fann_act), see
+ * lnk_msp430fr5994.cmd. fann_create_from_header() only returns its address.
+ */
+
+#include "fann.h"
+
+#if !defined(FIXEDFANN)
+
+/* Floating point, generated from thyroid_trained.net */
+
+#pragma DATA_SECTION(thyroid_values, ".fann_act")
+fann_type thyroid_values[32];
+
+#pragma DATA_SECTION(thyroid_output, ".fann_act")
+fann_type thyroid_output[3];
+
+#pragma PERSISTENT(thyroid_neurons)
+struct fann_neuron thyroid_neurons[32] = {
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 22, .activation_steepness = 5.00000000000000000000e-01, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 22, .last_con = 44, .activation_steepness = 5.00000000000000000000e-01, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 44, .last_con = 66, .activation_steepness = 5.00000000000000000000e-01, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 66, .last_con = 88, .activation_steepness = 5.00000000000000000000e-01, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 88, .last_con = 110, .activation_steepness = 5.00000000000000000000e-01, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 110, .last_con = 110, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 110, .last_con = 116, .activation_steepness = 5.00000000000000000000e-01, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 116, .last_con = 122, .activation_steepness = 5.00000000000000000000e-01, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 122, .last_con = 128, .activation_steepness = 5.00000000000000000000e-01, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 128, .last_con = 128, .activation_steepness = 0.00000000000000000000e+00, .activation_function = (enum fann_activationfunc_enum) 0}
+};
+
+#pragma DATA_SECTION(thyroid_weights, ".fann_weights")
+const fann_type thyroid_weights[128] = {
+    1.80704677e+00,
+    -7.48860717e-01,
+    -1.91387272e+00,
+    4.24051613e-01,
+    4.99437046e+00,
+    -1.53383225e-01,
+    1.40092647e+00,
+    -3.20110941e+00,
+    -2.82713264e-01,
+    6.92393124e-01,
+    -7.24546553e-04,
+    8.29365611e-01,
+    1.36203969e+00,
+    1.74610659e-01,
+    2.58809417e-01,
+    6.79947138e-01,
+    -2.61315247e+02,
+    2.40025654e+01,
+    7.34438992e+00,
+    3.80151081e+00,
+    2.48054647e+00,
+    -1.42801833e+00,
+    -2.13987350e+00,
+    -7.30148196e-01,
+    4.25153065e+00,
+    -7.81058729e-01,
+    -1.16193438e+00,
+    -1.06622732e+00,
+    7.76764154e-01,
+    5.86801243e+00,
+    -4.07636499e+00,
+    -8.33430111e-01,
+    2.17335773e+00,
+    -5.61780453e+00,
+    9.21104193e-01,
+    -9.84272361e-01,
+    1.95831552e-01,
+    -3.68902653e-01,
+    -2.07059814e+02,
+    1.47279453e+01,
+    7.81866074e+00,
+    1.38453360e+01,
+    2.91275358e+00,
+    -3.59865546e-01,
+    5.22149992e+00,
+    8.39167118e+00,
+    1.73513947e+01,
+    3.03654718e+00,
+    -3.53087568e+00,
+    2.50030041e+00,
+    6.34308815e-01,
+    -7.29063463e+00,
+    2.32250094e+00,
+    -3.84322381e+00,
+    -5.36510897e+00,
+    5.28955364e+00,
+    9.86408532e-01,
+    4.51735783e+00,
+    1.72344863e-01,
+    7.10959959e+00,
+    -5.97624550e+01,
+    4.84008646e+00,
+    -7.03933954e+00,
+    -3.65562034e+00,
+    -2.32551858e-01,
+    -5.88854647e+00,
+    6.93114221e-01,
+    7.83797562e-01,
+    2.70361156e+01,
+    -4.65040535e-01,
+    -2.33562851e+00,
+    1.91488838e+00,
+    1.27542973e+00,
+    3.41309128e+01,
+    1.21196318e+01,
+    -2.41700448e-02,
+    -7.35338449e+00,
+    4.41504192e+00,
+    1.06752717e+00,
+    6.70902058e-02,
+    6.81623369e-02,
+    6.18837297e-01,
+    -2.18934265e+02,
+    1.80720196e+01,
+    -2.16701908e+01,
+    -1.67877350e+01,
+    8.71159649e+00,
+    3.02866507e+00,
+    -3.00255746e-01,
+    1.83196336e-01,
+    -1.35274577e+00,
+    1.07756603e+00,
+    3.20794725e+00,
+    -4.85601664e-01,
+    9.40083414e-02,
+    -1.75679541e+00,
+    -1.24631691e+00,
+    1.07939291e+00,
+    4.33938533e-01,
+    7.86406946e+00,
+    9.54017818e-01,
+    -9.05515909e-01,
+    -5.77457398e-02,
+    1.69703178e+01,
+    -3.90921116e+00,
+    3.49799309e+01,
+    7.02143326e+01,
+    -1.71621494e+01,
+    8.40449753e+01,
+    -8.48918819e+00,
+    -3.39457417e+00,
+    -2.98730397e+00,
+    5.66771775e-02,
+    -1.44509518e+00,
+    -4.00198936e+00,
+    2.03013515e+00,
+    -3.04338288e+00,
+    -2.93320227e+00,
+    -1.12706006e+00,
+    -2.91778398e+00,
+    6.25999308e+00,
+    -2.31198692e+00,
+    3.27958536e+00,
+    2.97028971e+00,
+    1.07357693e+00,
+    3.05739737e+00,
+    -3.12593341e-01,
+    -3.45614934e+00
+};
+
+#pragma PERSISTENT(thyroid_layers)
+struct fann_layer thyroid_layers[3] = {
+    {
+        .first_neuron = thyroid_neurons + 0,
+        .last_neuron = thyroid_neurons + 22,
+        .values = thyroid_values + 0,
+        .activation_function = (enum fann_activationfunc_enum) 0,
+        .activation_steepness = 0.00000000000000000000e+00
+    },
+    {
+        .first_neuron = thyroid_neurons + 22,
+        .last_neuron = thyroid_neurons + 28,
+        .values = thyroid_values + 22,
+        .activation_function = (enum fann_activationfunc_enum) 4,
+        .stepwise_values = {-2.64665241e+00, -1.47221949e+00, -5.49306144e-01, 5.49306144e-01, 1.47221949e+00, 2.64665241e+00},
+        .max_sum = 3.00000000e+02,
+        .activation_steepness = 5.00000000000000000000e-01
+    },
+    {
+        .first_neuron = thyroid_neurons + 28,
+        .last_neuron = thyroid_neurons + 32,
+        .values = thyroid_values + 28,
+        .activation_function = (enum fann_activationfunc_enum) 4,
+        .stepwise_values = {-2.64665241e+00, -1.47221949e+00, -5.49306144e-01, 5.49306144e-01, 1.47221949e+00, 2.64665241e+00},
+        .max_sum = 3.00000000e+02,
+        .activation_steepness = 5.00000000000000000000e-01
+    }
+};
+
+#pragma PERSISTENT(thyroid_ann)
+struct fann thyroid_ann = {
+    .errno_f = FANN_E_NO_ERROR,
+    .learning_rate = 0.700000,
+    .learning_momentum = 0.400000,
+    .connection_rate = 1.000000,
+    .engine = FANN_ENGINE_DENSE,
+    .network_type = (enum fann_nettype_enum) 0,
+    .first_layer = thyroid_layers,
+    .last_layer = thyroid_layers + 3,
+    .total_neurons = 32,
+    .num_input = 21,
+    .num_output = 3,
+    .weights = (fann_type *) thyroid_weights,
+    .columns = NULL,
+    .values = thyroid_values,
+    .training_algorithm = (enum fann_train_enum) 0,
+    .sigmoid_results = {0.005, 0.05, 0.25, 0.75, 0.95, 0.995},
+    .sigmoid_values = {-2.64665241e+00, -1.47221949e+00, -5.49306144e-01, 5.49306144e-01, 1.47221949e+00, 2.64665241e+00},
+    .sigmoid_symmetric_results = {-0.99, -0.9, -0.5, 0.5, 0.9, 0.99},
+    .sigmoid_symmetric_values = {-2.64665241e+00, -1.47221949e+00, -5.49306144e-01, 5.49306144e-01, 1.47221949e+00, 2.64665241e+00},
+    .gaussian_results = {1, 0.95, 0.75, 0.25, 0.05, 0.005},
+    .gaussian_values = {-0.00000000e+00, 2.26480230e-01, 5.36360021e-01, 1.17741002e+00, 1.73081838e+00, 2.30180741e+00},
+    .total_connections = 128,
+    .output = thyroid_output,
+    .bit_fail_limit = 3.49999994039535522461e-01,
+    .train_error_function = (enum fann_errorfunc_enum) 1,
+    .train_stop_function = (enum fann_stopfunc_enum) 0
+};
+
+#elif defined(FIXEDFANN) && !defined(FANN_Q15)
+
+/* Fixed point, generated from thyroid_trained_fixed.net */
+
+#pragma DATA_SECTION(thyroid_values, ".fann_act")
+fann_type thyroid_values[32];
+
+#pragma DATA_SECTION(thyroid_output, ".fann_act")
+fann_type thyroid_output[3];
+
+#pragma PERSISTENT(thyroid_neurons)
+struct fann_neuron thyroid_neurons[32] = {
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 22, .activation_steepness = 512, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 22, .last_con = 44, .activation_steepness = 512, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 44, .last_con = 66, .activation_steepness = 512, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 66, .last_con = 88, .activation_steepness = 512, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 88, .last_con = 110, .activation_steepness = 512, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 110, .last_con = 110, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 110, .last_con = 116, .activation_steepness = 512, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 116, .last_con = 122, .activation_steepness = 512, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 122, .last_con = 128, .activation_steepness = 512, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 128, .last_con = 128, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0}
+};
+
+#pragma DATA_SECTION(thyroid_weights, ".fann_weights")
+const fann_type thyroid_weights[128] = {
+    3701,
+    -1534,
+    -3920,
+    868,
+    10228,
+    -314,
+    2869,
+    -6556,
+    -579,
+    1418,
+    -1,
+    1699,
+    2789,
+    358,
+    530,
+    1393,
+    -535174,
+    49157,
+    15041,
+    7785,
+    5080,
+    -2925,
+    -4382,
+    -1495,
+    8707,
+    -1600,
+    -2380,
+    -2184,
+    1591,
+    12018,
+    -8348,
+    -1707,
+    4451,
+    -11505,
+    1886,
+    -2016,
+    401,
+    -756,
+    -424059,
+    30163,
+    16013,
+    28355,
+    5965,
+    -737,
+    10694,
+    17186,
+    35536,
+    6219,
+    -7231,
+    5121,
+    1299,
+    -14931,
+    4756,
+    -7871,
+    -10988,
+    10833,
+    2020,
+    9252,
+    353,
+    14560,
+    -122394,
+    9912,
+    -14417,
+    -7487,
+    -476,
+    -12060,
+    1419,
+    1605,
+    55370,
+    -952,
+    -4783,
+    3922,
+    2612,
+    69900,
+    24821,
+    -50,
+    -15060,
+    9042,
+    2186,
+    137,
+    140,
+    1267,
+    -448377,
+    37011,
+    -44381,
+    -34381,
+    17841,
+    6203,
+    -615,
+    375,
+    -2770,
+    2207,
+    6570,
+    -995,
+    193,
+    -3598,
+    -2552,
+    2211,
+    889,
+    16106,
+    1954,
+    -1854,
+    -118,
+    34755,
+    -8006,
+    71639,
+    143799,
+    -35148,
+    172124,
+    -17386,
+    -6952,
+    -6118,
+    116,
+    -2960,
+    -8196,
+    4158,
+    -6233,
+    -6007,
+    -2308,
+    -5976,
+    12820,
+    -4735,
+    6717,
+    6083,
+    2199,
+    6262,
+    -640,
+    -7078
+};
+
+#pragma PERSISTENT(thyroid_layers)
+struct fann_layer thyroid_layers[3] = {
+    {
+        .first_neuron = thyroid_neurons + 0,
+        .last_neuron = thyroid_neurons + 22,
+        .values = thyroid_values + 0,
+        .activation_function = (enum fann_activationfunc_enum) 0,
+        .activation_steepness = 0
+    },
+    {
+        .first_neuron = thyroid_neurons + 22,
+        .last_neuron = thyroid_neurons + 28,
+        .values = thyroid_values + 22,
+        .activation_function = (enum fann_activationfunc_enum) 4,
+        .stepwise_values = {-5444, -3019, -1124, 1124, 3019, 5444},
+        .activation_steepness = 512
+    },
+    {
+        .first_neuron = thyroid_neurons + 28,
+        .last_neuron = thyroid_neurons + 32,
+        .values = thyroid_values + 28,
+        .activation_function = (enum fann_activationfunc_enum) 4,
+        .stepwise_values = {-5444, -3019, -1124, 1124, 3019, 5444},
+        .activation_steepness = 512
+    }
+};
+
+#pragma PERSISTENT(thyroid_ann)
+struct fann thyroid_ann = {
+    .errno_f = FANN_E_NO_ERROR,
+    .learning_rate = 0.700000,
+    .learning_momentum = 0.400000,
+    .connection_rate = 1.000000,
+    .engine = FANN_ENGINE_DENSE,
+    .network_type = (enum fann_nettype_enum) 0,
+    .first_layer = thyroid_layers,
+    .last_layer = thyroid_layers + 3,
+    .total_neurons = 32,
+    .num_input = 21,
+    .num_output = 3,
+    .weights = (fann_type *) thyroid_weights,
+    .columns = NULL,
+    .values = thyroid_values,
+    .training_algorithm = (enum fann_train_enum) 0,
+    .decimal_point = 10,
+    .multiplier = 1024,
+    .sigmoid_results = {5, 51, 256, 768, 973, 1019},
+    .sigmoid_values = {-2787712, -1545893, -575989, 575989, 1545893, 2787712},
+    .sigmoid_symmetric_results = {-1014, -922, -512, 512, 922, 1013},
+    .sigmoid_symmetric_values = {-2787712, -1545893, -575989, 575989, 1545893, 2737484},
+    .gaussian_results = {1024, 973, 768, 256, 51, 5},
+    .gaussian_values = {0, 237005, 562414, 1234603, 1816079, 2419015},
+    .total_connections = 128,
+    .output = thyroid_output,
+    .bit_fail_limit = 358,
+    .train_error_function = (enum fann_errorfunc_enum) 1,
+    .train_stop_function = (enum fann_stopfunc_enum) 0
+};
+
+#elif defined(FANN_Q15)
+
+/* Q15, generated from thyroid_trained_q15.net */
+
+#pragma DATA_SECTION(thyroid_values, ".fann_act")
+fann_type thyroid_values[32];
+
+#pragma DATA_SECTION(thyroid_output, ".fann_act")
+fann_type thyroid_output[3];
+
+#pragma PERSISTENT(thyroid_neurons)
+struct fann_neuron thyroid_neurons[32] = {
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 0, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 0, .last_con = 22, .activation_steepness = 128, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 22, .last_con = 44, .activation_steepness = 128, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 44, .last_con = 66, .activation_steepness = 128, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 66, .last_con = 88, .activation_steepness = 128, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 88, .last_con = 110, .activation_steepness = 128, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 110, .last_con = 110, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0},
+    {.first_con = 110, .last_con = 116, .activation_steepness = 128, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 116, .last_con = 122, .activation_steepness = 128, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 122, .last_con = 128, .activation_steepness = 128, .activation_function = (enum fann_activationfunc_enum) 4},
+    {.first_con = 128, .last_con = 128, .activation_steepness = 0, .activation_function = (enum fann_activationfunc_enum) 0}
+};
+
+#pragma DATA_SECTION(thyroid_weights, ".fann_weights")
+const fann_type thyroid_weights[128] = {
+    116,
+    -48,
+    -122,
+    27,
+    320,
+    -10,
+    90,
+    -205,
+    -18,
+    44,
+    0,
+    53,
+    87,
+    11,
+    17,
+    44,
+    -16724,
+    1536,
+    470,
+    243,
+    159,
+    -91,
+    -137,
+    -47,
+    272,
+    -50,
+    -74,
+    -68,
+    50,
+    376,
+    -261,
+    -53,
+    139,
+    -360,
+    59,
+    -63,
+    13,
+    -24,
+    -13252,
+    943,
+    500,
+    886,
+    186,
+    -23,
+    334,
+    537,
+    1110,
+    194,
+    -226,
+    160,
+    41,
+    -467,
+    149,
+    -246,
+    -343,
+    339,
+    63,
+    289,
+    11,
+    455,
+    -3825,
+    310,
+    -451,
+    -234,
+    -15,
+    -377,
+    44,
+    50,
+    1730,
+    -30,
+    -149,
+    123,
+    82,
+    2184,
+    776,
+    -2,
+    -471,
+    283,
+    68,
+    4,
+    4,
+    40,
+    -14012,
+    1157,
+    -1387,
+    -1074,
+    558,
+    194,
+    -19,
+    12,
+    -87,
+    69,
+    205,
+    -31,
+    6,
+    -112,
+    -80,
+    69,
+    28,
+    503,
+    61,
+    -58,
+    -4,
+    1086,
+    -250,
+    2239,
+    4494,
+    -1098,
+    5379,
+    -543,
+    -6952,
+    -6118,
+    116,
+    -2960,
+    -8196,
+    4158,
+    -6233,
+    -6007,
+    -2308,
+    -5976,
+    12820,
+    -4735,
+    6717,
+    6083,
+    2199,
+    6262,
+    -640,
+    -7078
+};
+
+#pragma PERSISTENT(thyroid_layers)
+struct fann_layer thyroid_layers[3] = {
+    {
+        .first_neuron = thyroid_neurons + 0,
+        .last_neuron = thyroid_neurons + 22,
+        .values = thyroid_values + 0,
+        .activation_function = (enum fann_activationfunc_enum) 0,
+        .weight_decimal_point = 0,
+        .activation_steepness = 0
+    },
+    {
+        .first_neuron = thyroid_neurons + 22,
+        .last_neuron = thyroid_neurons + 28,
+        .values = thyroid_values + 22,
+        .activation_function = (enum fann_activationfunc_enum) 4,
+        .weight_decimal_point = 5,
+        .stepwise_values = {-1354, -752, -280, 280, 752, 1354},
+        .activation_steepness = 128
+    },
+    {
+        .first_neuron = thyroid_neurons + 28,
+        .last_neuron = thyroid_neurons + 32,
+        .values = thyroid_values + 28,
+        .activation_function = (enum fann_activationfunc_enum) 4,
+        .weight_decimal_point = 10,
+        .stepwise_values = {-1354, -752, -280, 280, 752, 1354},
+        .activation_steepness = 128
+    }
+};
+
+#pragma PERSISTENT(thyroid_ann)
+struct fann thyroid_ann = {
+    .errno_f = FANN_E_NO_ERROR,
+    .learning_rate = 0.700000,
+    .learning_momentum = 0.400000,
+    .connection_rate = 1.000000,
+    .engine = FANN_ENGINE_DENSE,
+    .network_type = (enum fann_nettype_enum) 0,
+    .first_layer = thyroid_layers,
+    .last_layer = thyroid_layers + 3,
+    .total_neurons = 32,
+    .num_input = 21,
+    .num_output = 3,
+    .weights = (fann_type *) thyroid_weights,
+    .columns = NULL,
+    .values = thyroid_values,
+    .training_algorithm = (enum fann_train_enum) 0,
+    .decimal_point = 15,
+    .multiplier = 32767,
+    .sigmoid_results = {164, 1638, 8192, 24575, 31129, 32603},
+    .sigmoid_values = {-677, -376, -140, 140, 376, 677},
+    .sigmoid_symmetric_results = {-32439, -29490, -16384, 16383, 29490, 32439},
+    .sigmoid_symmetric_values = {-677, -376, -140, 140, 376, 677},
+    .gaussian_results = {32767, 31129, 24575, 8192, 1638, 164},
+    .gaussian_values = {0, 57, 137, 301, 443, 589},
+    .total_connections = 128,
+    .output = thyroid_output,
+    .bit_fail_limit = 11469,
+    .train_error_function = (enum fann_errorfunc_enum) 1,
+    .train_stop_function = (enum fann_stopfunc_enum) 0
+};
+
+#else
+
+#error "thyroid_static.h was not generated for this flavour, run gen-infer with its network"
+
+#endif
+
+#endif // __THYROID_STATIC__
@@ -8,6 +8,8 @@ uint8_t num_data = 250;
 uint8_t num_input = 21;
 uint8_t num_output = 3;
 
+#ifndef FIXEDFANN
+
 #pragma PERSISTENT(input) // Place data in FRAM
 fann_type input [250][21] = {
     {0.720000, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0.000030, 0.049000, 0.192000, 0.109000, 0.176000},
@@ -516,5 +518,1030 @@ fann_type output [250][3] = {
     {0, 0, 1}
 };
 
+#elif defined(FANN_Q15)
+
+#define TEST_DECIMAL_POINT 15
+
+#pragma PERSISTENT(input) // Place data in FRAM
+fann_type input [250][21] = {
+    {23593, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1606, 6291, 3572, 5767},
+    {23593, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 524, 4096, 3113, 4325},
+    {20972, 0, 32767, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 18, 590, 2949, 2589, 3736},
+    {18022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 754, 3408, 3375, 3310},
+    {5571, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 819, 3604, 2982, 3965},
+    {15073, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 786, 3801, 2621, 4751},
+    {17039, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 659, 4522, 4063, 3637},
+    {16712, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 659, 3604, 2785, 4227},
+    {11469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 49, 721, 3211, 3736, 2818},
+    {8192, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 3, 557, 3015, 2916, 3375},
+    {15401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 786, 3047, 3604, 2785},
+    {21627, 0, 32767, 0, 0, 0, 0, 0, 32767, 32767, 0, 0, 0, 0, 0, 0, 154, 426, 4751, 3146, 4939},
+    {12780, 32767, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 659, 3867, 2327, 5439},
+    {18350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 492, 682, 4358, 3178, 4489},
+    {11796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 655, 3506, 2753, 4162},
+    {11469, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 675, 2523, 2195, 3768},
+    {9503, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 682, 3604, 3113, 3801},
+    {8520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 682, 4588, 3408, 4325},
+    {28508, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 459, 3637, 4129, 2884},
+    {22938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 203, 590, 4063, 3637, 3670},
+    {19333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 819, 5276, 2720, 6390},
+    {7537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 459, 2490, 2720, 2982},
+    {12780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 393, 1901, 2753, 2228},
+    {7864, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 819, 3244, 3178, 3342},
+    {17695, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 28, 426, 3342, 2982, 3703},
+    {24576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 623, 3998, 3113, 4227},
+    {19333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 2, 1180, 3080, 3342, 3015},
+    {10486, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 754, 2490, 2818, 2884},
+    {10813, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 62, 754, 3604, 3310, 3572},
+    {12452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 659, 2982, 3408, 2884},
+    {19005, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 88, 459, 3932, 2785, 4620},
+    {12780, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 950, 3178, 3375, 3080},
+    {27525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1114, 229, 1704, 3637, 1540},
+    {18350, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 524, 3899, 3408, 3703},
+    {6881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3643, 3244, 3672},
+    {11141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 659, 3712, 3146, 3859},
+    {22282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 786, 3637, 2982, 3998},
+    {17367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 659, 3712, 3146, 3859},
+    {21299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 295, 3670, 3080, 3899},
+    {13107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 659, 2654, 2556, 3408},
+    {23593, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3736, 3637, 3342},
+    {9503, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 590, 3244, 3244, 3270},
+    {12780, 32767, 0, 0, 0, 0, 0, 32767, 0, 32767, 0, 0, 0, 0, 0, 0, 118, 675, 3015, 3572, 2753},
+    {15073, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 754, 3244, 3408, 2982},
+    {9830, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3643, 3244, 3672},
+    {22938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 721, 4358, 3113, 4588},
+    {27197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 524, 3277, 2916, 3670},
+    {17695, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 659, 4162, 2916, 4686},
+    {18350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2097, 6259, 3178, 6455},
+    {13107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 659, 4555, 3146, 4735},
+    {9830, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 459, 2523, 2294, 3604},
+    {20972, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 659, 3899, 3310, 3899},
+    {22610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 659, 3637, 4325, 2753},
+    {26214, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 590, 3932, 3408, 3801},
+    {20972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 15, 786, 3015, 2359, 4194},
+    {11141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2687, 66, 190, 3375, 183},
+    {9830, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 659, 3703, 3670, 3310},
+    {19005, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 682, 3473, 3080, 3703},
+    {20316, 32767, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 492, 3441, 2818, 3998},
+    {21299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 10, 885, 3146, 4588, 2261},
+    {7209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3643, 3244, 3672},
+    {15401, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 557, 3572, 2916, 4030},
+    {17367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 131, 2720, 1769, 5046},
+    {8520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 721, 3113, 3277, 3113},
+    {12780, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 659, 5308, 3899, 4456},
+    {16056, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 675, 2425, 2851, 2785},
+    {23593, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 328, 2458, 2687, 3015},
+    {20644, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 95, 659, 2687, 2195, 3998},
+    {29164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 721, 3441, 3080, 3670},
+    {11141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 8, 885, 3834, 3539, 3539},
+    {5898, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 36, 675, 4817, 3113, 5046},
+    {10158, 0, 32767, 0, 0, 0, 32767, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 14, 492, 2458, 3015, 2654},
+    {21955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 43, 754, 3178, 3572, 2884},
+    {4915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 590, 2753, 3211, 2818},
+    {18678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 2, 1373, 7700, 3604, 7012},
+    {13435, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 918, 1966, 3113, 2064},
+    {17039, 32767, 32767, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3244, 3015, 3506},
+    {24576, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 295, 3080, 2425, 4162},
+    {17695, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 659, 2785, 2785, 3277},
+    {11469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 623, 4456, 3506, 4162},
+    {22938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 659, 4030, 2785, 4751},
+    {19988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 557, 2359, 3047, 2523},
+    {23265, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 754, 5046, 3736, 4424},
+    {22610, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 754, 3539, 3375, 3441},
+    {655, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 315, 1106, 3375, 1065},
+    {11796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 1212, 6029, 5898, 3342},
+    {15073, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 659, 3310, 3408, 3178},
+    {7209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 1016, 3604, 2687, 4391},
+    {19333, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 655, 3867, 3015, 4227},
+    {17039, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 852, 3473, 3178, 3572},
+    {9175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 1245, 6324, 6324, 3277},
+    {10486, 32767, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 557, 2785, 2753, 3310},
+    {22282, 32767, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 590, 2916, 2720, 3441},
+    {11141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 39, 983, 3113, 4391, 2327},
+    {19005, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3643, 3244, 3672},
+    {5898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 786, 2425, 3801, 2064},
+    {4588, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 983, 3736, 3277, 3736},
+    {21627, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 11, 675, 3113, 3244, 3113},
+    {12452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 659, 3506, 3408, 3310},
+    {7864, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 46, 754, 2392, 3572, 2195},
+    {10813, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 659, 2523, 2720, 3047},
+    {11469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 682, 3801, 3408, 3572},
+    {18022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 85, 623, 3768, 3342, 3736},
+    {6554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 4030, 3408, 3867},
+    {6554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 721, 3310, 3408, 3113},
+    {19988, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 3572, 426, 1442, 3211, 1475},
+    {19333, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 659, 2720, 2654, 3375},
+    {8192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 659, 5112, 4456, 3768},
+    {23593, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 688, 315, 1966, 3801, 1671},
+    {13435, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 10, 754, 3637, 2720, 4391},
+    {11141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 659, 5865, 2654, 7242},
+    {16056, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 754, 3015, 3244, 3039},
+    {7864, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2163, 328, 3670, 3310, 3604},
+    {25231, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 164, 1769, 2818, 2032},
+    {28180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 492, 2392, 3146, 2486},
+    {21299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 43, 1081, 4260, 3965, 3506},
+    {12452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 29, 524, 3539, 2785, 4162},
+    {22938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 659, 3178, 3670, 2851},
+    {17367, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 786, 3408, 2654, 4194},
+    {23265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 324, 590, 2916, 3244, 2949},
+    {15729, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 590, 3408, 3637, 3080},
+    {14418, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 659, 4293, 3080, 4522},
+    {18678, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 492, 3047, 3178, 3113},
+    {23593, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 36, 682, 3408, 2982, 3736},
+    {11141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 524, 3506, 3408, 3342},
+    {8192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 659, 4456, 4915, 2949},
+    {21955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 590, 4686, 2982, 5145},
+    {7537, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 655, 5112, 3801, 4391},
+    {9503, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 885, 5112, 4096, 4096},
+    {23921, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 43, 557, 1933, 2851, 2228},
+    {20644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 269, 682, 2621, 3342, 2556},
+    {10158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 659, 3712, 3146, 3859},
+    {22938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 852, 5243, 2884, 5898},
+    {7537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 885, 4325, 4555, 3146},
+    {25887, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105, 492, 5210, 3801, 4456},
+    {14418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 557, 2654, 3146, 2753},
+    {8847, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 426, 3539, 2589, 4489},
+    {9503, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 918, 4719, 3801, 4030},
+    {11141, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 659, 3441, 3310, 3408},
+    {24576, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 68, 1114, 4424, 3408, 4227},
+    {20644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 659, 3310, 3146, 3441},
+    {22938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 819, 3637, 4096, 2884},
+    {7537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 659, 3342, 3146, 3473},
+    {7537, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 62, 659, 5472, 3637, 4915},
+    {6881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 62, 1212, 5308, 4817, 3604},
+    {20644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4129, 426, 1278, 3539, 1212},
+    {18022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 492, 2884, 3080, 3080},
+    {14418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 59, 623, 3867, 3506, 3604},
+    {17039, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 49, 659, 3211, 2884, 3637},
+    {18350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 393, 2490, 2425, 3342},
+    {15073, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 655, 3473, 3310, 3408},
+    {24248, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 623, 3965, 3572, 3637},
+    {12452, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 492, 3473, 2589, 4391},
+    {18350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 659, 4588, 3015, 4981},
+    {20316, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 623, 2556, 2785, 2982},
+    {24576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 393, 2884, 2064, 4588},
+    {655, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 4456, 659, 1737, 2523, 2261},
+    {6226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 721, 3712, 3146, 3859},
+    {25559, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 524, 3342, 4030, 2720},
+    {24248, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 557, 3768, 3637, 3408},
+    {6554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 623, 3080, 2982, 3342},
+    {24248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 659, 2818, 3310, 2785},
+    {8520, 32767, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 18, 682, 4489, 2982, 4948},
+    {13435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 754, 3736, 3244, 3765},
+    {25231, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 655, 3441, 3408, 3277},
+    {11796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 1016, 4358, 5014, 2851},
+    {25887, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 328, 2654, 2687, 3244},
+    {19661, 32767, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3643, 3244, 3672},
+    {8847, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 623, 2916, 2785, 3441},
+    {18022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 819, 3080, 3211, 3146},
+    {19988, 32767, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 590, 2720, 2327, 3834},
+    {14746, 32767, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 675, 3047, 3801, 2621},
+    {19661, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 659, 3080, 3572, 2818},
+    {15729, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 659, 3080, 2589, 3899},
+    {19988, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 659, 3080, 2818, 3572},
+    {18350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 557, 4063, 3637, 3670},
+    {28180, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 721, 2458, 2687, 3015},
+    {24248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 6, 623, 3572, 3178, 3670},
+    {19333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 62, 682, 3211, 2949, 3539},
+    {23921, 0, 32767, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 85, 524, 2916, 3080, 3113},
+    {18022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 659, 2064, 2916, 2327},
+    {6554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 7, 983, 4424, 4227, 3441},
+    {21627, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 655, 4030, 3768, 3506},
+    {27525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 459, 3375, 3604, 3080},
+    {23265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 193, 590, 3712, 3146, 2589},
+    {24904, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 164, 1868, 3244, 1883},
+    {22610, 32767, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 659, 2818, 2458, 3768},
+    {17367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 623, 4424, 3342, 4325},
+    {19005, 0, 32767, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 105, 682, 2458, 3408, 2359},
+    {7209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 721, 3047, 3539, 2851},
+    {8520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3643, 3244, 3672},
+    {20316, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 655, 6849, 3146, 7143},
+    {27197, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 426, 3539, 2490, 4620},
+    {19005, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 918, 557, 2818, 3342, 2753},
+    {11469, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 1016, 852, 1507, 3277, 1507},
+    {20316, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 557, 3441, 3342, 3375},
+    {19661, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 29, 328, 4620, 3342, 4522},
+    {19661, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 393, 1016, 3047, 3146, 3168},
+    {18350, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 659, 2195, 2327, 3080},
+    {9175, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 1016, 3506, 3408, 3375},
+    {9175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 1147, 754, 1376, 3310, 1343},
+    {19988, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 36, 459, 3604, 3244, 3633},
+    {11796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 885, 3932, 3178, 4030},
+    {10158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 659, 3703, 3801, 3146},
+    {27197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 393, 1802, 2425, 2425},
+    {18678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 360, 3277, 2097, 5112},
+    {20972, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 72, 754, 3703, 2261, 5374},
+    {12780, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 32767, 0, 0, 0, 0, 0, 66, 754, 3342, 3801, 2884},
+    {14418, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 557, 3867, 3604, 3506},
+    {28508, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 557, 2916, 3310, 2884},
+    {20644, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 819, 3572, 3506, 3342},
+    {11141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 46, 459, 3768, 2982, 4129},
+    {20644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3867, 3342, 3768},
+    {24904, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 76, 659, 3712, 3146, 3859},
+    {18678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 659, 2720, 2490, 3539},
+    {23265, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 459, 2785, 3670, 2523},
+    {25559, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 557, 2490, 2818, 2884},
+    {23921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 623, 4948, 3178, 5079},
+    {13107, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 819, 4293, 2982, 4719},
+    {8192, 0, 0, 0, 0, 32767, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 291, 557, 2032, 2458, 2720},
+    {22938, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 659, 3712, 3146, 3859},
+    {12780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 8, 950, 4456, 4719, 3080},
+    {24576, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 524, 3342, 3080, 3572},
+    {12452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 426, 3867, 2851, 4456},
+    {27197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 675, 3113, 2818, 3637},
+    {15729, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 675, 3670, 3015, 3965},
+    {12452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 239, 557, 3113, 3113, 3256},
+    {20644, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 590, 2392, 2097, 3736},
+    {18350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 786, 4489, 3899, 3768},
+    {12452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 3643, 3244, 3672},
+    {14090, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 675, 3211, 2785, 3768},
+    {10813, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 659, 5439, 5800, 3080},
+    {21627, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 524, 2523, 2785, 2949},
+    {13763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 675, 3342, 3375, 3047},
+    {10813, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 147, 682, 2720, 3113, 2851},
+    {21299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 659, 4850, 2785, 5702},
+    {17039, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 390, 852, 2589, 2949, 2884},
+    {26542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 623, 3867, 3342, 3801},
+    {11469, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 492, 3178, 2785, 3736},
+    {18022, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 675, 5571, 3604, 5079},
+    {20316, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 659, 2818, 3146, 2929},
+    {24248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 590, 3441, 2949, 3834},
+    {23921, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 623, 3965, 3310, 3899},
+    {9175, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 675, 6849, 3539, 6357},
+    {21627, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 659, 3768, 4096, 3015},
+    {21627, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 885, 2949, 3244, 2982},
+    {11469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 557, 3867, 3604, 3506},
+    {15401, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 75, 524, 2458, 3047, 2621},
+    {11141, 0, 0, 0, 0, 0, 32767, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 2, 1278, 4850, 3310, 4817},
+    {19661, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 786, 5407, 3277, 5407}
+};
+
+#pragma PERSISTENT(output) // Place data in FRAM
+fann_type output [250][3] = {
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {32767, 0, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {32767, 0, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {32767, 0, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {32767, 0, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {32767, 0, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {32767, 0, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {32767, 0, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {32767, 0, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 32767, 0},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767},
+    {0, 0, 32767}
+};
+
+#else
+
+#define TEST_DECIMAL_POINT 10
+
+#pragma PERSISTENT(input) // Place data in FRAM
+fann_type input [250][21] = {
+    {737, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 197, 112, 180},
+    {737, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 16, 128, 97, 135},
+    {655, 0, 1024, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 1, 18, 92, 81, 117},
+    {563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 24, 106, 105, 103},
+    {174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 26, 113, 93, 124},
+    {471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 25, 119, 82, 148},
+    {532, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 21, 141, 127, 114},
+    {522, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 113, 87, 132},
+    {358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 2, 23, 100, 117, 88},
+    {256, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 17, 94, 91, 105},
+    {481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 25, 95, 113, 87},
+    {676, 0, 1024, 0, 0, 0, 0, 0, 1024, 1024, 0, 0, 0, 0, 0, 0, 5, 13, 148, 98, 154},
+    {399, 1024, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 121, 73, 170},
+    {573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 21, 136, 99, 140},
+    {369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 20, 110, 86, 130},
+    {358, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 79, 69, 118},
+    {297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 113, 97, 119},
+    {266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 143, 106, 135},
+    {891, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 14, 114, 129, 90},
+    {717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 18, 127, 114, 115},
+    {604, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 165, 85, 200},
+    {236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 14, 78, 85, 93},
+    {399, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 12, 59, 86, 70},
+    {246, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 26, 101, 99, 104},
+    {553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 1, 13, 104, 93, 116},
+    {768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 19, 125, 97, 132},
+    {604, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 37, 96, 104, 94},
+    {328, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 24, 78, 88, 90},
+    {338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 2, 24, 113, 103, 112},
+    {389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 93, 106, 90},
+    {594, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 3, 14, 123, 87, 144},
+    {399, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 30, 99, 105, 96},
+    {860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 7, 53, 114, 48},
+    {573, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 16, 122, 106, 116},
+    {215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 114, 101, 115},
+    {348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 116, 98, 121},
+    {696, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 25, 114, 93, 125},
+    {543, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 116, 98, 121},
+    {666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 9, 115, 96, 122},
+    {410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 83, 80, 106},
+    {737, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 117, 114, 104},
+    {297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 18, 101, 101, 102},
+    {399, 1024, 0, 0, 0, 0, 0, 1024, 0, 1024, 0, 0, 0, 0, 0, 0, 4, 21, 94, 112, 86},
+    {471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 24, 101, 106, 93},
+    {307, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 114, 101, 115},
+    {717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 23, 136, 97, 143},
+    {850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 16, 102, 91, 115},
+    {553, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 130, 91, 146},
+    {573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 196, 99, 202},
+    {410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 142, 98, 148},
+    {307, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 14, 79, 72, 113},
+    {655, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 122, 103, 122},
+    {707, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 114, 135, 86},
+    {819, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 18, 123, 106, 119},
+    {655, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 25, 94, 74, 131},
+    {348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 2, 6, 105, 6},
+    {307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 116, 115, 103},
+    {594, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 109, 96, 116},
+    {635, 1024, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 15, 108, 88, 125},
+    {666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 28, 98, 143, 71},
+    {225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 114, 101, 115},
+    {481, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 17, 112, 91, 126},
+    {543, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 85, 55, 158},
+    {266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 23, 97, 102, 97},
+    {399, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 166, 122, 139},
+    {502, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 76, 89, 87},
+    {737, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 10, 77, 84, 94},
+    {645, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 3, 21, 84, 69, 125},
+    {911, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 23, 108, 96, 115},
+    {348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 28, 120, 111, 111},
+    {184, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 1, 21, 151, 97, 158},
+    {317, 0, 1024, 0, 0, 0, 1024, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 15, 77, 94, 83},
+    {686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 1, 24, 99, 112, 90},
+    {154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 18, 86, 100, 88},
+    {584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 43, 241, 113, 219},
+    {420, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 29, 61, 97, 65},
+    {532, 1024, 1024, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 101, 94, 110},
+    {768, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 9, 96, 76, 130},
+    {553, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 87, 87, 102},
+    {358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 19, 139, 110, 130},
+    {717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 126, 87, 148},
+    {625, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 17, 74, 95, 79},
+    {727, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 24, 158, 117, 138},
+    {707, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 24, 111, 105, 108},
+    {20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 10, 35, 105, 33},
+    {369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 38, 188, 184, 104},
+    {471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 21, 103, 106, 99},
+    {225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 32, 113, 84, 137},
+    {604, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 121, 94, 132},
+    {532, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 27, 109, 99, 112},
+    {287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 39, 198, 198, 102},
+    {328, 1024, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 87, 86, 103},
+    {696, 1024, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 18, 91, 85, 108},
+    {348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 1, 31, 97, 137, 73},
+    {594, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 114, 101, 115},
+    {184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 25, 76, 119, 65},
+    {143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 31, 117, 102, 117},
+    {676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 21, 97, 101, 97},
+    {389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 110, 106, 103},
+    {246, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 1, 24, 75, 112, 69},
+    {338, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 79, 85, 95},
+    {358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 119, 106, 112},
+    {563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 3, 19, 118, 104, 117},
+    {205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 126, 106, 121},
+    {205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 23, 103, 106, 97},
+    {625, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 112, 13, 45, 100, 46},
+    {604, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 85, 83, 105},
+    {256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 160, 139, 118},
+    {737, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 10, 61, 119, 52},
+    {420, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 24, 114, 85, 137},
+    {348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 183, 83, 226},
+    {502, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 24, 94, 101, 95},
+    {246, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 10, 115, 103, 113},
+    {788, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 55, 88, 63},
+    {881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 15, 75, 98, 78},
+    {666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 1, 34, 133, 124, 110},
+    {389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 1, 16, 111, 87, 130},
+    {717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 21, 99, 115, 89},
+    {543, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 25, 106, 83, 131},
+    {727, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 10, 18, 91, 101, 92},
+    {492, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 106, 114, 96},
+    {451, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 134, 96, 141},
+    {584, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 15, 95, 99, 97},
+    {737, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 1, 21, 106, 93, 117},
+    {348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 110, 106, 104},
+    {256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 139, 154, 92},
+    {686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 18, 146, 93, 161},
+    {236, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 20, 160, 119, 137},
+    {297, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 28, 160, 128, 128},
+    {748, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 1, 17, 60, 89, 70},
+    {645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 21, 82, 104, 80},
+    {317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 116, 98, 121},
+    {717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 164, 90, 184},
+    {236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 28, 135, 142, 98},
+    {809, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 15, 163, 119, 139},
+    {451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 83, 98, 86},
+    {276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13, 111, 81, 140},
+    {297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 29, 147, 119, 126},
+    {348, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 21, 108, 103, 106},
+    {768, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 2, 35, 138, 106, 132},
+    {645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 21, 103, 98, 108},
+    {717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 26, 114, 128, 90},
+    {236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 104, 98, 109},
+    {236, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 2, 21, 171, 114, 154},
+    {215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 2, 38, 166, 151, 113},
+    {645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 13, 40, 111, 38},
+    {563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 15, 90, 96, 96},
+    {451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 2, 19, 121, 110, 113},
+    {532, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 2, 21, 100, 90, 114},
+    {573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 12, 78, 76, 104},
+    {471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 20, 109, 103, 106},
+    {758, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 19, 124, 112, 114},
+    {389, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 109, 81, 137},
+    {573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 143, 94, 156},
+    {635, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 19, 80, 87, 93},
+    {768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 12, 90, 65, 143},
+    {20, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 139, 21, 54, 79, 71},
+    {195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 23, 116, 98, 121},
+    {799, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 16, 104, 126, 85},
+    {758, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 17, 118, 114, 106},
+    {205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 96, 93, 104},
+    {758, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 88, 103, 87},
+    {266, 1024, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 140, 93, 155},
+    {420, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 24, 117, 101, 118},
+    {788, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 20, 108, 106, 102},
+    {369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 32, 136, 157, 89},
+    {809, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 10, 83, 84, 101},
+    {614, 1024, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 114, 101, 115},
+    {276, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 19, 91, 87, 108},
+    {563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 26, 96, 100, 98},
+    {625, 1024, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 18, 85, 73, 120},
+    {461, 1024, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 95, 119, 82},
+    {614, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 96, 112, 88},
+    {492, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 96, 81, 122},
+    {625, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 96, 88, 112},
+    {573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 17, 127, 114, 115},
+    {881, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 23, 77, 84, 94},
+    {758, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 19, 112, 99, 115},
+    {604, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 2, 21, 100, 92, 111},
+    {748, 0, 1024, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 3, 16, 91, 96, 97},
+    {563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 65, 91, 73},
+    {205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 31, 138, 132, 108},
+    {676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 126, 118, 110},
+    {860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 14, 105, 113, 96},
+    {727, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 18, 116, 98, 81},
+    {778, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 58, 101, 59},
+    {707, 1024, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 21, 88, 77, 118},
+    {543, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 138, 104, 135},
+    {594, 0, 1024, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 3, 21, 77, 106, 74},
+    {225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 23, 95, 111, 89},
+    {266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 114, 101, 115},
+    {635, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 214, 98, 223},
+    {850, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13, 111, 78, 144},
+    {594, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 17, 88, 104, 86},
+    {358, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 32, 27, 47, 102, 47},
+    {635, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 108, 104, 105},
+    {614, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 1, 10, 144, 104, 141},
+    {614, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 12, 32, 95, 98, 99},
+    {573, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 69, 73, 96},
+    {287, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 32, 110, 106, 105},
+    {287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 36, 24, 43, 103, 42},
+    {625, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 1, 14, 113, 101, 114},
+    {369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 123, 99, 126},
+    {317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 116, 119, 98},
+    {850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 12, 56, 76, 76},
+    {584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 102, 66, 160},
+    {655, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 2, 24, 116, 71, 168},
+    {399, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 1024, 0, 0, 0, 0, 0, 2, 24, 104, 119, 90},
+    {451, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 17, 121, 113, 110},
+    {891, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 17, 91, 103, 90},
+    {645, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 26, 112, 110, 104},
+    {348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 1, 14, 118, 93, 129},
+    {645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 121, 104, 118},
+    {778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 2, 21, 116, 98, 121},
+    {584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 85, 78, 111},
+    {727, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 87, 115, 79},
+    {799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 78, 88, 90},
+    {748, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 19, 155, 99, 159},
+    {410, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 134, 93, 147},
+    {256, 0, 0, 0, 0, 1024, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 9, 17, 63, 77, 85},
+    {717, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 116, 98, 121},
+    {399, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 30, 139, 147, 96},
+    {768, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 16, 104, 96, 112},
+    {389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 13, 121, 89, 139},
+    {850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 97, 88, 114},
+    {492, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 21, 115, 94, 124},
+    {389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 17, 97, 97, 102},
+    {645, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 18, 75, 66, 117},
+    {573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 25, 140, 122, 118},
+    {389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 114, 101, 115},
+    {440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 100, 87, 118},
+    {338, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 170, 181, 96},
+    {676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 16, 79, 87, 92},
+    {430, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 104, 105, 95},
+    {338, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 5, 21, 85, 97, 89},
+    {666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 152, 87, 178},
+    {532, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 27, 81, 92, 90},
+    {829, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 19, 121, 104, 119},
+    {358, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 15, 99, 87, 117},
+    {563, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 21, 174, 113, 159},
+    {635, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 21, 88, 98, 92},
+    {758, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 18, 108, 92, 120},
+    {748, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 19, 124, 103, 122},
+    {287, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 214, 111, 199},
+    {676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 21, 118, 128, 94},
+    {676, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 28, 92, 101, 93},
+    {358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 17, 121, 113, 110},
+    {481, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 2, 16, 77, 95, 82},
+    {348, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 40, 152, 103, 151},
+    {614, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 169, 102, 169}
+};
+
+#pragma PERSISTENT(output) // Place data in FRAM
+fann_type output [250][3] = {
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {1024, 0, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {1024, 0, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {1024, 0, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {1024, 0, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {1024, 0, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {1024, 0, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {1024, 0, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {1024, 0, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 1024, 0},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024},
+    {0, 0, 1024}
+};
+
+#endif // FIXEDFANN
 
 #endif // __THYROID_TEST__
@@ -52,171 +52,187 @@
 #define LAYER_SIZE_3                         4
 #define SCALE_INCLUDED                       0
 
-fann_type neurons[][3] = {
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {0, 0, 0.00000000000000000000e+00},
-    {22, 4, 5.00000000000000000000e-01},
-    {22, 4, 5.00000000000000000000e-01},
-    {22, 4, 5.00000000000000000000e-01},
-    {22, 4, 5.00000000000000000000e-01},
-    {22, 4, 5.00000000000000000000e-01},
-    {0, 0, 0.00000000000000000000e+00},
-    {6, 4, 5.00000000000000000000e-01},
-    {6, 4, 5.00000000000000000000e-01},
-    {6, 4, 5.00000000000000000000e-01},
-    {0, 0, 0.00000000000000000000e+00} 
+#pragma DATA_SECTION(neuron_inputs, ".fann_weights") // Place data in FRAM
+const uint8_t neuron_inputs[32] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 0, 6, 6, 6, 0
 };
 
-fann_type connections[][2] = {
-    {0, 3.61409354209899902344e+00},
-    {1, -1.49772143363952636719e+00},
-    {2, -3.82774543762207031250e+00},
-    {3, 8.48103225231170654297e-01},
-    {4, 9.98874092102050781250e+00},
-    {5, -3.06766450405120849609e-01},
-    {6, 2.80185294151306152344e+00},
-    {7, -6.40221881866455078125e+00},
-    {8, -5.65426528453826904297e-01},
-    {9, 1.38478624820709228516e+00},
-    {10, -1.44909310620278120041e-03},
-    {11, 1.65873122215270996094e+00},
-    {12, 2.72407937049865722656e+00},
-    {13, 3.49221318960189819336e-01},
-    {14, 5.17618834972381591797e-01},
-    {15, 1.35989427566528320312e+00},
-    {16, -5.22630493164062500000e+02},
-    {17, 4.80051307678222656250e+01},
-    {18, 1.46887798309326171875e+01},
-    {19, 7.60302162170410156250e+00},
-    {20, 4.96109294891357421875e+00},
-    {21, -2.85603666305541992188e+00},
-    {0, -4.27974700927734375000e+00},
-    {1, -1.46029639244079589844e+00},
-    {2, 8.50306129455566406250e+00},
-    {3, -1.56211745738983154297e+00},
-    {4, -2.32386875152587890625e+00},
-    {5, -2.13245463371276855469e+00},
-    {6, 1.55352830886840820312e+00},
-    {7, 1.17360248565673828125e+01},
-    {8, -8.15272998809814453125e+00},
-    {9, -1.66686022281646728516e+00},
-    {10, 4.34671545028686523438e+00},
-    {11, -1.12356090545654296875e+01},
-    {12, 1.84220838546752929688e+00},
-    {13, -1.96854472160339355469e+00},
-    {14, 3.91663104295730590820e-01},
-    {15, -7.37805306911468505859e-01},
-    {16, -4.14119628906250000000e+02},
-    {17, 2.94558906555175781250e+01},
-    {18, 1.56373214721679687500e+01},
-    {19, 2.76906719207763671875e+01},
-    {20, 5.82550716400146484375e+00},
-    {21, -7.19731092453002929688e-01},
-    {0, 1.04429998397827148438e+01},
-    {1, 1.67833423614501953125e+01},
-    {2, 3.47027893066406250000e+01},
-    {3, 6.07309436798095703125e+00},
-    {4, -7.06175136566162109375e+00},
-    {5, 5.00060081481933593750e+00},
-    {6, 1.26861763000488281250e+00},
-    {7, -1.45812692642211914062e+01},
-    {8, 4.64500188827514648438e+00},
-    {9, -7.68644762039184570312e+00},
-    {10, -1.07302179336547851562e+01},
-    {11, 1.05791072845458984375e+01},
-    {12, 1.97281706333160400391e+00},
-    {13, 9.03471565246582031250e+00},
-    {14, 3.44689726829528808594e-01},
-    {15, 1.42191991806030273438e+01},
-    {16, -1.19524909973144531250e+02},
-    {17, 9.68017292022705078125e+00},
-    {18, -1.40786790847778320312e+01},
-    {19, -7.31124067306518554688e+00},
-    {20, -4.65103715658187866211e-01},
-    {21, -1.17770929336547851562e+01},
-    {0, 1.38622844219207763672e+00},
-    {1, 1.56759512424468994141e+00},
-    {2, 5.40722312927246093750e+01},
-    {3, -9.30081069469451904297e-01},
-    {4, -4.67125701904296875000e+00},
-    {5, 3.82977676391601562500e+00},
-    {6, 2.55085945129394531250e+00},
-    {7, 6.82618255615234375000e+01},
-    {8, 2.42392635345458984375e+01},
-    {9, -4.83400896191596984863e-02},
-    {10, -1.47067689895629882812e+01},
-    {11, 8.83008384704589843750e+00},
-    {12, 2.13505434989929199219e+00},
-    {13, 1.34180411696434020996e-01},
-    {14, 1.36324673891067504883e-01},
-    {15, 1.23767459392547607422e+00},
-    {16, -4.37868530273437500000e+02},
-    {17, 3.61440391540527343750e+01},
-    {18, -4.33403816223144531250e+01},
-    {19, -3.35754699707031250000e+01},
-    {20, 1.74231929779052734375e+01},
-    {21, 6.05733013153076171875e+00},
-    {0, -6.00511491298675537109e-01},
-    {1, 3.66392672061920166016e-01},
-    {2, -2.70549154281616210938e+00},
-    {3, 2.15513205528259277344e+00},
-    {4, 6.41589450836181640625e+00},
-    {5, -9.71203327178955078125e-01},
-    {6, 1.88016682863235473633e-01},
-    {7, -3.51359081268310546875e+00},
-    {8, -2.49263381958007812500e+00},
-    {9, 2.15878582000732421875e+00},
-    {10, 8.67877066135406494141e-01},
-    {11, 1.57281389236450195312e+01},
-    {12, 1.90803563594818115234e+00},
-    {13, -1.81103181838989257812e+00},
-    {14, -1.15491479635238647461e-01},
-    {15, 3.39406356811523437500e+01},
-    {16, -7.81842231750488281250e+00},
-    {17, 6.99598617553710937500e+01},
-    {18, 1.40428665161132812500e+02},
-    {19, -3.43242988586425781250e+01},
-    {20, 1.68089950561523437500e+02},
-    {21, -1.69783763885498046875e+01},
-    {22, -6.78914833068847656250e+00},
-    {23, -5.97460794448852539062e+00},
-    {24, 1.13354355096817016602e-01},
-    {25, -2.89019036293029785156e+00},
-    {26, -8.00397872924804687500e+00},
-    {27, 4.06027030944824218750e+00},
-    {22, -6.08676576614379882812e+00},
-    {23, -5.86640453338623046875e+00},
-    {24, -2.25412011146545410156e+00},
-    {25, -5.83556795120239257812e+00},
-    {26, 1.25199861526489257812e+01},
-    {27, -4.62397384643554687500e+00},
-    {22, 6.55917072296142578125e+00},
-    {23, 5.94057941436767578125e+00},
-    {24, 2.14715385437011718750e+00},
-    {25, 6.11479473114013671875e+00},
-    {26, -6.25186681747436523438e-01},
-    {27, -6.91229867935180664062e+00} 
+#pragma DATA_SECTION(neuron_activations, ".fann_weights") // Place data in FRAM
+const uint8_t neuron_activations[32] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 4, 4, 0
 };
 
+#pragma DATA_SECTION(neuron_steepnesses, ".fann_weights") // Place data in FRAM
+const fann_type neuron_steepnesses[32] = {
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    0.00000000000000000000e+00,
+    5.00000000000000000000e-01,
+    5.00000000000000000000e-01,
+    5.00000000000000000000e-01,
+    5.00000000000000000000e-01,
+    5.00000000000000000000e-01,
+    0.00000000000000000000e+00,
+    5.00000000000000000000e-01,
+    5.00000000000000000000e-01,
+    5.00000000000000000000e-01,
+    0.00000000000000000000e+00
+};
+
+#pragma DATA_SECTION(connection_weights, ".fann_weights") // Place data in FRAM
+const fann_type connection_weights[128] = {
+    1.80704677e+00,
+    -7.48860717e-01,
+    -1.91387272e+00,
+    4.24051613e-01,
+    4.99437046e+00,
+    -1.53383225e-01,
+    1.40092647e+00,
+    -3.20110941e+00,
+    -2.82713264e-01,
+    6.92393124e-01,
+    -7.24546553e-04,
+    8.29365611e-01,
+    1.36203969e+00,
+    1.74610659e-01,
+    2.58809417e-01,
+    6.79947138e-01,
+    -2.61315247e+02,
+    2.40025654e+01,
+    7.34438992e+00,
+    3.80151081e+00,
+    2.48054647e+00,
+    -1.42801833e+00,
+    -2.13987350e+00,
+    -7.30148196e-01,
+    4.25153065e+00,
+    -7.81058729e-01,
+    -1.16193438e+00,
+    -1.06622732e+00,
+    7.76764154e-01,
+    5.86801243e+00,
+    -4.07636499e+00,
+    -8.33430111e-01,
+    2.17335773e+00,
+    -5.61780453e+00,
+    9.21104193e-01,
+    -9.84272361e-01,
+    1.95831552e-01,
+    -3.68902653e-01,
+    -2.07059814e+02,
+    1.47279453e+01,
+    7.81866074e+00,
+    1.38453360e+01,
+    2.91275358e+00,
+    -3.59865546e-01,
+    5.22149992e+00,
+    8.39167118e+00,
+    1.73513947e+01,
+    3.03654718e+00,
+    -3.53087568e+00,
+    2.50030041e+00,
+    6.34308815e-01,
+    -7.29063463e+00,
+    2.32250094e+00,
+    -3.84322381e+00,
+    -5.36510897e+00,
+    5.28955364e+00,
+    9.86408532e-01,
+    4.51735783e+00,
+    1.72344863e-01,
+    7.10959959e+00,
+    -5.97624550e+01,
+    4.84008646e+00,
+    -7.03933954e+00,
+    -3.65562034e+00,
+    -2.32551858e-01,
+    -5.88854647e+00,
+    6.93114221e-01,
+    7.83797562e-01,
+    2.70361156e+01,
+    -4.65040535e-01,
+    -2.33562851e+00,
+    1.91488838e+00,
+    1.27542973e+00,
+    3.41309128e+01,
+    1.21196318e+01,
+    -2.41700448e-02,
+    -7.35338449e+00,
+    4.41504192e+00,
+    1.06752717e+00,
+    6.70902058e-02,
+    6.81623369e-02,
+    6.18837297e-01,
+    -2.18934265e+02,
+    1.80720196e+01,
+    -2.16701908e+01,
+    -1.67877350e+01,
+    8.71159649e+00,
+    3.02866507e+00,
+    -3.00255746e-01,
+    1.83196336e-01,
+    -1.35274577e+00,
+    1.07756603e+00,
+    3.20794725e+00,
+    -4.85601664e-01,
+    9.40083414e-02,
+    -1.75679541e+00,
+    -1.24631691e+00,
+    1.07939291e+00,
+    4.33938533e-01,
+    7.86406946e+00,
+    9.54017818e-01,
+    -9.05515909e-01,
+    -5.77457398e-02,
+    1.69703178e+01,
+    -3.90921116e+00,
+    3.49799309e+01,
+    7.02143326e+01,
+    -1.71621494e+01,
+    8.40449753e+01,
+    -8.48918819e+00,
+    -3.39457417e+00,
+    -2.98730397e+00,
+    5.66771775e-02,
+    -1.44509518e+00,
+    -4.00198936e+00,
+    2.03013515e+00,
+    -3.04338288e+00,
+    -2.93320227e+00,
+    -1.12706006e+00,
+    -2.91778398e+00,
+    6.25999308e+00,
+    -2.31198692e+00,
+    3.27958536e+00,
+    2.97028971e+00,
+    1.07357693e+00,
+    3.05739737e+00,
+    -3.12593341e-01,
+    -3.45614934e+00
+};
+
+#define COLUMNS_INCLUDED                     0
+
 
 #endif // __THYROID_TRAINED__
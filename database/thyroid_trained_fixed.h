@@ -0,0 +1,239 @@
+#ifndef __THYROID_TRAINED_FIXED__
+#define __THYROID_TRAINED_FIXED__
+
+
+// FANN_FIX_2.0
+
+#define DECIMAL_POINT                        10
+#define NUM_LAYERS                           3
+#define LEARNING_RATE                        0.700000
+#define CONNECTION_RATE                      1.000000
+#define NETWORK_TYPE                         0
+#define LEARNING_MOMENTUM                    0.400000
+#define TRAINING_ALGORITHM                   0
+#define TRAIN_ERROR_FUNCTION                 1
+#define TRAIN_STOP_FUNCTION                  0
+#define CASCADE_OUTPUT_CHANGE_FRACTION       0.010000
+#define QUICKPROP_DECAY                      -0.000100
+#define QUICKPROP_MU                         1.750000
+#define RPROP_INCREASE_FACTOR                1.200000
+#define RPROP_DECREASE_FACTOR                0.500000
+#define RPROP_DELTA_MIN                      0.000000
+#define RPROP_DELTA_MAX                      50.000000
+#define RPROP_DELTA_ZERO                     0.100000
+#define CASCADE_OUTPUT_STAGNATION_EPOCHS     12
+#define CASCADE_CANDIDATE_CHANGE_FRACTION    0.010000
+#define CASCADE_CANDIDATE_STAGNATION_EPOCHS  12
+#define CASCADE_MAX_OUT_EPOCHS               150
+#define CASCADE_MIN_OUT_EPOCHS               50
+#define CASCADE_MAX_CAND_EPOCHS              150
+#define CASCADE_MIN_CAND_EPOCHS              50
+#define CASCADE_NUM_CANDIDATE_GROUPS         2
+#define BIT_FAIL_LIMIT                       358
+#define CASCADE_CANDIDATE_LIMIT              1024000
+#define CASCADE_WEIGHT_MULTIPLIER            410
+#define CASCADE_ACTIVATION_FUNCTIONS_COUNT   10
+#define CASCADE_ACTIVATION_FUNCTION_1        3
+#define CASCADE_ACTIVATION_FUNCTION_2        5
+#define CASCADE_ACTIVATION_FUNCTION_3        7
+#define CASCADE_ACTIVATION_FUNCTION_4        8
+#define CASCADE_ACTIVATION_FUNCTION_5        10
+#define CASCADE_ACTIVATION_FUNCTION_6        11
+#define CASCADE_ACTIVATION_FUNCTION_7        14
+#define CASCADE_ACTIVATION_FUNCTION_8        15
+#define CASCADE_ACTIVATION_FUNCTION_9        16
+#define CASCADE_ACTIVATION_FUNCTION_10       17
+#define CASCADE_ACTIVATION_STEEPNESSES_COUNT 4
+#define CASCADE_ACTIVATION_STEEPNESS_1       256
+#define CASCADE_ACTIVATION_STEEPNESS_2       512
+#define CASCADE_ACTIVATION_STEEPNESS_3       768
+#define CASCADE_ACTIVATION_STEEPNESS_4       1024
+#define LAYER_SIZE_1                         22
+#define LAYER_SIZE_2                         6
+#define LAYER_SIZE_3                         4
+#define SCALE_INCLUDED                       0
+
+#pragma DATA_SECTION(neuron_inputs, ".fann_weights") // Place data in FRAM
+const uint8_t neuron_inputs[32] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 0, 6, 6, 6, 0
+};
+
+#pragma DATA_SECTION(neuron_activations, ".fann_weights") // Place data in FRAM
+const uint8_t neuron_activations[32] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 4, 4, 0
+};
+
+#pragma DATA_SECTION(neuron_steepnesses, ".fann_weights") // Place data in FRAM
+const fann_type neuron_steepnesses[32] = {
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    512,
+    512,
+    512,
+    512,
+    512,
+    0,
+    512,
+    512,
+    512,
+    0
+};
+
+#pragma DATA_SECTION(connection_weights, ".fann_weights") // Place data in FRAM
+const fann_type connection_weights[128] = {
+    3701,
+    -1534,
+    -3920,
+    868,
+    10228,
+    -314,
+    2869,
+    -6556,
+    -579,
+    1418,
+    -1,
+    1699,
+    2789,
+    358,
+    530,
+    1393,
+    -535174,
+    49157,
+    15041,
+    7785,
+    5080,
+    -2925,
+    -4382,
+    -1495,
+    8707,
+    -1600,
+    -2380,
+    -2184,
+    1591,
+    12018,
+    -8348,
+    -1707,
+    4451,
+    -11505,
+    1886,
+    -2016,
+    401,
+    -756,
+    -424059,
+    30163,
+    16013,
+    28355,
+    5965,
+    -737,
+    10694,
+    17186,
+    35536,
+    6219,
+    -7231,
+    5121,
+    1299,
+    -14931,
+    4756,
+    -7871,
+    -10988,
+    10833,
+    2020,
+    9252,
+    353,
+    14560,
+    -122394,
+    9912,
+    -14417,
+    -7487,
+    -476,
+    -12060,
+    1419,
+    1605,
+    55370,
+    -952,
+    -4783,
+    3922,
+    2612,
+    69900,
+    24821,
+    -50,
+    -15060,
+    9042,
+    2186,
+    137,
+    140,
+    1267,
+    -448377,
+    37011,
+    -44381,
+    -34381,
+    17841,
+    6203,
+    -615,
+    375,
+    -2770,
+    2207,
+    6570,
+    -995,
+    193,
+    -3598,
+    -2552,
+    2211,
+    889,
+    16106,
+    1954,
+    -1854,
+    -118,
+    34755,
+    -8006,
+    71639,
+    143799,
+    -35148,
+    172124,
+    -17386,
+    -6952,
+    -6118,
+    116,
+    -2960,
+    -8196,
+    4158,
+    -6233,
+    -6007,
+    -2308,
+    -5976,
+    12820,
+    -4735,
+    6717,
+    6083,
+    2199,
+    6262,
+    -640,
+    -7078
+};
+
+#define COLUMNS_INCLUDED                     0
+
+
+#endif // __THYROID_TRAINED_FIXED__
@@ -0,0 +1,242 @@
+#ifndef __THYROID_TRAINED_Q15__
+#define __THYROID_TRAINED_Q15__
+
+
+// FANN_Q15_2.0
+
+#define DECIMAL_POINT                        15
+#define WEIGHT_DECIMAL_POINT_1               0
+#define WEIGHT_DECIMAL_POINT_2               5
+#define WEIGHT_DECIMAL_POINT_3               10
+#define NUM_LAYERS                           3
+#define LEARNING_RATE                        0.700000
+#define CONNECTION_RATE                      1.000000
+#define NETWORK_TYPE                         0
+#define LEARNING_MOMENTUM                    0.400000
+#define TRAINING_ALGORITHM                   0
+#define TRAIN_ERROR_FUNCTION                 1
+#define TRAIN_STOP_FUNCTION                  0
+#define CASCADE_OUTPUT_CHANGE_FRACTION       0.010000
+#define QUICKPROP_DECAY                      -0.000100
+#define QUICKPROP_MU                         1.750000
+#define RPROP_INCREASE_FACTOR                1.200000
+#define RPROP_DECREASE_FACTOR                0.500000
+#define RPROP_DELTA_MIN                      0.000000
+#define RPROP_DELTA_MAX                      50.000000
+#define RPROP_DELTA_ZERO                     0.100000
+#define CASCADE_OUTPUT_STAGNATION_EPOCHS     12
+#define CASCADE_CANDIDATE_CHANGE_FRACTION    0.010000
+#define CASCADE_CANDIDATE_STAGNATION_EPOCHS  12
+#define CASCADE_MAX_OUT_EPOCHS               150
+#define CASCADE_MIN_OUT_EPOCHS               50
+#define CASCADE_MAX_CAND_EPOCHS              150
+#define CASCADE_MIN_CAND_EPOCHS              50
+#define CASCADE_NUM_CANDIDATE_GROUPS         2
+#define BIT_FAIL_LIMIT                       11469
+#define CASCADE_CANDIDATE_LIMIT              32767
+#define CASCADE_WEIGHT_MULTIPLIER            13107
+#define CASCADE_ACTIVATION_FUNCTIONS_COUNT   10
+#define CASCADE_ACTIVATION_FUNCTION_1        3
+#define CASCADE_ACTIVATION_FUNCTION_2        5
+#define CASCADE_ACTIVATION_FUNCTION_3        7
+#define CASCADE_ACTIVATION_FUNCTION_4        8
+#define CASCADE_ACTIVATION_FUNCTION_5        10
+#define CASCADE_ACTIVATION_FUNCTION_6        11
+#define CASCADE_ACTIVATION_FUNCTION_7        14
+#define CASCADE_ACTIVATION_FUNCTION_8        15
+#define CASCADE_ACTIVATION_FUNCTION_9        16
+#define CASCADE_ACTIVATION_FUNCTION_10       17
+#define CASCADE_ACTIVATION_STEEPNESSES_COUNT 4
+#define CASCADE_ACTIVATION_STEEPNESS_1       64
+#define CASCADE_ACTIVATION_STEEPNESS_2       128
+#define CASCADE_ACTIVATION_STEEPNESS_3       192
+#define CASCADE_ACTIVATION_STEEPNESS_4       256
+#define LAYER_SIZE_1                         22
+#define LAYER_SIZE_2                         6
+#define LAYER_SIZE_3                         4
+#define SCALE_INCLUDED                       0
+
+#pragma DATA_SECTION(neuron_inputs, ".fann_weights") // Place data in FRAM
+const uint8_t neuron_inputs[32] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 0, 6, 6, 6, 0
+};
+
+#pragma DATA_SECTION(neuron_activations, ".fann_weights") // Place data in FRAM
+const uint8_t neuron_activations[32] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 4, 4, 0
+};
+
+#pragma DATA_SECTION(neuron_steepnesses, ".fann_weights") // Place data in FRAM
+const fann_type neuron_steepnesses[32] = {
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    128,
+    128,
+    128,
+    128,
+    128,
+    0,
+    128,
+    128,
+    128,
+    0
+};
+
+#pragma DATA_SECTION(connection_weights, ".fann_weights") // Place data in FRAM
+const fann_type connection_weights[128] = {
+    116,
+    -48,
+    -122,
+    27,
+    320,
+    -10,
+    90,
+    -205,
+    -18,
+    44,
+    0,
+    53,
+    87,
+    11,
+    17,
+    44,
+    -16724,
+    1536,
+    470,
+    243,
+    159,
+    -91,
+    -137,
+    -47,
+    272,
+    -50,
+    -74,
+    -68,
+    50,
+    376,
+    -261,
+    -53,
+    139,
+    -360,
+    59,
+    -63,
+    13,
+    -24,
+    -13252,
+    943,
+    500,
+    886,
+    186,
+    -23,
+    334,
+    537,
+    1110,
+    194,
+    -226,
+    160,
+    41,
+    -467,
+    149,
+    -246,
+    -343,
+    339,
+    63,
+    289,
+    11,
+    455,
+    -3825,
+    310,
+    -451,
+    -234,
+    -15,
+    -377,
+    44,
+    50,
+    1730,
+    -30,
+    -149,
+    123,
+    82,
+    2184,
+    776,
+    -2,
+    -471,
+    283,
+    68,
+    4,
+    4,
+    40,
+    -14012,
+    1157,
+    -1387,
+    -1074,
+    558,
+    194,
+    -19,
+    12,
+    -87,
+    69,
+    205,
+    -31,
+    6,
+    -112,
+    -80,
+    69,
+    28,
+    503,
+    61,
+    -58,
+    -4,
+    1086,
+    -250,
+    2239,
+    4494,
+    -1098,
+    5379,
+    -543,
+    -6952,
+    -6118,
+    116,
+    -2960,
+    -8196,
+    4158,
+    -6233,
+    -6007,
+    -2308,
+    -5976,
+    12820,
+    -4735,
+    6717,
+    6083,
+    2199,
+    6262,
+    -640,
+    -7078
+};
+
+#define COLUMNS_INCLUDED                     0
+
+
+#endif // __THYROID_TRAINED_Q15__
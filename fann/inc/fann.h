@@ -36,8 +36,18 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
  */
 /* Group: Creation, Destruction & Execution */
 
+/* FANN_Q15 is the 16-bit flavour of the fixed point mode */
+#if defined(FANN_Q15) && !defined(FIXEDFANN)
+#define FIXEDFANN
+#endif
+
 #ifdef FIXEDFANN
+#ifdef FANN_Q15
+#include <stdint.h>
+typedef int16_t fann_type;
+#else
 typedef long fann_type;
+#endif // FANN_Q15
 #else
 typedef float fann_type;
 #endif
@@ -225,6 +235,122 @@ FANN_EXTERNAL struct fann * FANN_API fann_copy(struct fann *ann);
 */ 
 FANN_EXTERNAL fann_type * FANN_API fann_run(struct fann *ann, fann_type * input);
 
+
+/* Function: fann_run_batch
+	Runs num_samples inputs through the network, as many calls to <fann_run>: inputs holds
+	num_samples rows of <fann_get_num_input> values, outputs receives num_samples rows of
+	<fann_get_num_output> values. Returns outputs.
+
+	Compiled with FANN_BATCH=B, the samples are run B at a time, layer by layer, with the
+	activations of the B samples of each neuron side by side in SRAM: each weight is read once
+	and applied to the B samples, which amortizes the reads of the weights (in FRAM with
+	FANN_STATIC) and the overhead of the loops. The results are the same as with <fann_run>.
+	The networks of the generic engine and those of more than <FANN_BATCH_NEURONS> neurons are
+	run one sample at a time, as without FANN_BATCH.
+
+	See also:
+		<fann_test_batch>
+*/
+FANN_EXTERNAL fann_type * FANN_API fann_run_batch(struct fann *ann, fann_type * inputs,
+                                                  unsigned int num_samples, fann_type * outputs);
+
+
+/* Function: fann_set_input
+	Sets the input of the network (and the bias neuron of the input layer), before running it layer
+	by layer with <fann_run_layer>.
+
+	See also:
+		<fann_run>
+*/
+FANN_EXTERNAL void FANN_API fann_set_input(struct fann *ann, fann_type * input);
+
+
+/* Function: fann_run_layer
+	Computes the activations of one layer, from 1 (the first hidden layer) to <fann_get_num_layers> - 1
+	(the output layer), from those of the previous layers. <fann_run> is <fann_set_input> followed by
+	fann_run_layer on every layer in order, so the layers can be run in separate steps, e.g. the tasks
+	of an intermittent program, as long as the activations (<fann_get_values>) are preserved in between.
+
+	Returns the array of outputs when the output layer is run, NULL otherwise.
+*/
+FANN_EXTERNAL fann_type * FANN_API fann_run_layer(struct fann *ann, unsigned int layer);
+
+
+/* Function: fann_run_resumable
+	Like <fann_run>, but every state->interval neurons the activations computed since the last
+	checkpoint are saved to state->values and the neuron cursor is committed to the double-buffered
+	<fann_checkpoint>. After a power failure, calling it again with the same input resumes from the
+	last committed cursor, so at most interval neurons are computed again and the inference makes
+	progress even when a whole run does not fit in one power-on period.
+
+	The cursor is reset when the inference completes: the caller must keep passing the same input
+	until the output is returned, and can then move to the next one.
+
+	Returns the array of outputs, as <fann_run>.
+*/
+FANN_EXTERNAL fann_type * FANN_API fann_run_resumable(struct fann *ann, fann_type * input,
+                                                       struct fann_checkpoint *state);
+
+
+/* Function: fann_power_history_boot
+	To be called at every start: records the uptime of the previous power cycle (the last one
+	recorded at a checkpoint) in the history, and starts a new cycle.
+
+	Returns 1 when <FANN_POWER_HISTORY> new cycles have been recorded since the last time it
+	returned 1, i.e. when it is time to call <fann_checkpoint_adapt>.
+*/
+FANN_EXTERNAL int FANN_API fann_power_history_boot(struct fann_power_history *history);
+
+
+/* Function: fann_checkpoint_adapt
+	Chooses the checkpoint interval of <fann_run_resumable> from the on-times of the last power
+	cycles (state->history) and the costs of the model: the interval whose chunks of neurons,
+	saved and committed, complete the most neurons in those cycles. Short cycles favour frequent
+	checkpoints, which lose less work at each power failure; long ones favour coarse checkpoints,
+	down to one per test, which spend less time committing.
+
+	The candidates are the powers of two and the number of neurons of an inference. The interval is
+	stored in state->interval and returned; it is left unchanged without history.
+*/
+FANN_EXTERNAL unsigned int FANN_API fann_checkpoint_adapt(struct fann *ann, struct fann_checkpoint *state,
+                                                           const struct fann_checkpoint_costs *costs);
+
+
+/* Function: fann_checkpoint_measure
+	Measures the neuron, save and commit costs of <fann_checkpoint_adapt> with state->clock, in
+	the units of the recorded uptimes: the network is run twice on input, checkpointing once per
+	inference then after every neuron into a scratch checkpoint, whose activations are saved to
+	values (<fann_get_total_neurons> values, in FRAM like state->values but distinct from it).
+	The inference in progress in state is not affected; the restart cost, which depends on the
+	program, is left to the caller. This takes about three inferences: call it once, on a start
+	that has already recorded a long enough power cycle.
+
+	Returns 0, or -1 (costs unchanged) without clock, when the clock saturates during the runs or
+	when the network has less than two neurons to run.
+*/
+FANN_EXTERNAL int FANN_API fann_checkpoint_measure(struct fann *ann, struct fann_checkpoint *state,
+                                                   fann_type *input, fann_type *values,
+                                                   struct fann_checkpoint_costs *costs);
+
+
+/* Function: fann_get_num_layers
+	Returns the number of layers of the network, input and output layers included.
+*/
+FANN_EXTERNAL unsigned int FANN_API fann_get_num_layers(struct fann *ann);
+
+
+/* Function: fann_get_total_neurons
+	Returns the total number of neurons of the network, bias neurons included.
+*/
+FANN_EXTERNAL unsigned int FANN_API fann_get_total_neurons(struct fann *ann);
+
+
+/* Function: fann_get_values
+	Returns the activations of all the neurons, layer after layer (<fann_get_total_neurons> values,
+	bias neurons included). They are what <fann_run_layer> reads and writes.
+*/
+FANN_EXTERNAL fann_type * FANN_API fann_get_values(struct fann *ann);
+
 #ifdef FIXEDFANN
 	
 /* Function: fann_get_decimal_point
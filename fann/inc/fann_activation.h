@@ -41,16 +41,25 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #define fann_sigmoid_real(sum) (1.0f/(1.0f + exp(-2.0f * sum)))
 #define fann_sigmoid_derive(steepness, value) (2.0f * steepness * value * (1.0f - value))
 
+/* FANN_SIGMOID_STEPWISE */
+#define fann_sigmoid_stepwise_real(sum) fann_stepwise(-2.64665246009826660156e+00, -1.47221946716308593750e+00, -5.49306154251098632812e-01, 5.49306154251098632812e-01, 1.47221934795379638672e+00, 2.64665293693542480469e+00, 4.99999988824129104614e-03, 5.00000007450580596924e-02, 2.50000000000000000000e-01, 7.50000000000000000000e-01, 9.49999988079071044922e-01, 9.95000004768371582031e-01, 0, 1, sum)
+
 /* FANN_SIGMOID_SYMMETRIC */
 /* #define fann_sigmoid_symmetric(steepness, sum) (2.0f/(1.0f + exp(-2.0f * steepness * sum)) - 1.0f) */
 #define fann_sigmoid_symmetric_real(sum) (2.0f/(1.0f + exp(-2.0f * sum)) - 1.0f)
 #define fann_sigmoid_symmetric_derive(steepness, value) steepness * (1.0f - (value*value))
 
+/* FANN_SIGMOID_SYMMETRIC_STEPWISE */
+#define fann_sigmoid_symmetric_stepwise_real(sum) fann_stepwise(-2.64665293693542480469e+00, -1.47221934795379638672e+00, -5.49306154251098632812e-01, 5.49306154251098632812e-01, 1.47221934795379638672e+00, 2.64665293693542480469e+00, -9.90000009536743164062e-01, -8.99999976158142089844e-01, -5.00000000000000000000e-01, 5.00000000000000000000e-01, 8.99999976158142089844e-01, 9.90000009536743164062e-01, -1, 1, sum)
+
 /* FANN_GAUSSIAN */
 /* #define fann_gaussian(steepness, sum) (exp(-sum * steepness * sum * steepness)) */
 #define fann_gaussian_real(sum) (exp(-sum * sum))
 #define fann_gaussian_derive(steepness, value, sum) (-2.0f * sum * value * steepness * steepness)
 
+/* FANN_GAUSSIAN_STEPWISE */
+#define fann_gaussian_stepwise_real(sum) fann_stepwise(0.00000000000000000000e+00, 2.26480229573246823e-01, 5.36360021302651602e-01, 1.17741002251547466e+00, 1.73081838260228540e+00, 2.30180741300136500e+00, 1.00000000000000000000e+00, 9.49999988079071044922e-01, 7.50000000000000000000e-01, 2.50000000000000000000e-01, 5.00000007450580596924e-02, 4.99999988824129104614e-03, 1, 0, fann_abs(sum))
+
 /* FANN_GAUSSIAN_SYMMETRIC */
 /* #define fann_gaussian_symmetric(steepness, sum) ((exp(-sum * steepness * sum * steepness)*2.0)-1.0) */
 #define fann_gaussian_symmetric_real(sum) ((exp(-sum * sum)*2.0f)-1.0f)
@@ -82,6 +91,39 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #define fann_cos_real(sum) (cos(sum)/2.0f+0.5f)
 #define fann_cos_derive(steepness, sum) (steepness*-sin(steepness*sum)/2.0f)
 
+/* Table-driven activation functions (FANN_ACTIVATION_LUT, floating point
+ * only): the functions that need exp, sin or cos are replaced by a linear
+ * interpolation in FANN_LUT_SIZE-entry tables (64, 128 or 256, default 128)
+ * generated by database/gen-lut, see fann_activation_lut.h for the maximum
+ * error of each table. The symmetric variants double the error.
+ */
+#if defined(FANN_ACTIVATION_LUT) && !defined(FIXEDFANN)
+#ifndef FANN_LUT_SIZE
+#define FANN_LUT_SIZE 128
+#endif
+
+fann_type fann_lut_sigmoid(fann_type sum);
+fann_type fann_lut_gaussian(fann_type sum);
+fann_type fann_lut_sin(fann_type turns);
+
+#undef fann_sigmoid_real
+#define fann_sigmoid_real(sum) fann_lut_sigmoid(sum)
+#undef fann_sigmoid_symmetric_real
+#define fann_sigmoid_symmetric_real(sum) (fann_lut_sigmoid(sum) * 2.0f - 1.0f)
+#undef fann_gaussian_real
+#define fann_gaussian_real(sum) fann_lut_gaussian(sum)
+#undef fann_gaussian_symmetric_real
+#define fann_gaussian_symmetric_real(sum) (fann_lut_gaussian(sum) * 2.0f - 1.0f)
+#undef fann_sin_symmetric_real
+#define fann_sin_symmetric_real(sum) fann_lut_sin((sum) * 0.159154943f)
+#undef fann_cos_symmetric_real
+#define fann_cos_symmetric_real(sum) fann_lut_sin((sum) * 0.159154943f + 0.25f)
+#undef fann_sin_real
+#define fann_sin_real(sum) (fann_lut_sin((sum) * 0.159154943f) / 2.0f + 0.5f)
+#undef fann_cos_real
+#define fann_cos_real(sum) (fann_lut_sin((sum) * 0.159154943f + 0.25f) / 2.0f + 0.5f)
+#endif // FANN_ACTIVATION_LUT
+
 #define fann_activation_switch(activation_function, value, result) \
 switch(activation_function) \
 { \
@@ -101,10 +143,10 @@ switch(activation_function) \
 		result = (fann_type)fann_sigmoid_symmetric_real(value); \
         break; \
 	case FANN_SIGMOID_SYMMETRIC_STEPWISE: \
-		result = (fann_type)fann_stepwise(-2.64665293693542480469e+00, -1.47221934795379638672e+00, -5.49306154251098632812e-01, 5.49306154251098632812e-01, 1.47221934795379638672e+00, 2.64665293693542480469e+00, -9.90000009536743164062e-01, -8.99999976158142089844e-01, -5.00000000000000000000e-01, 5.00000000000000000000e-01, 8.99999976158142089844e-01, 9.90000009536743164062e-01, -1, 1, value); \
+		result = (fann_type)fann_sigmoid_symmetric_stepwise_real(value); \
         break; \
 	case FANN_SIGMOID_STEPWISE: \
-		result = (fann_type)fann_stepwise(-2.64665246009826660156e+00, -1.47221946716308593750e+00, -5.49306154251098632812e-01, 5.49306154251098632812e-01, 1.47221934795379638672e+00, 2.64665293693542480469e+00, 4.99999988824129104614e-03, 5.00000007450580596924e-02, 2.50000000000000000000e-01, 7.50000000000000000000e-01, 9.49999988079071044922e-01, 9.95000004768371582031e-01, 0, 1, value); \
+		result = (fann_type)fann_sigmoid_stepwise_real(value); \
         break; \
 	case FANN_THRESHOLD: \
 		result = (fann_type)((value < 0) ? 0 : 1); \
@@ -137,7 +179,7 @@ switch(activation_function) \
 		result = (fann_type)fann_cos_real(value); \
         break; \
 	case FANN_GAUSSIAN_STEPWISE: \
-        result = 0; \
+		result = (fann_type)fann_gaussian_stepwise_real(value); \
         break; \
 }
 
@@ -0,0 +1,402 @@
+#ifndef __fann_activation_lut_h__
+#define __fann_activation_lut_h__
+
+/* Generated by database/gen-lut from the macros of fann_activation.h.
+ * Activation tables used with FANN_ACTIVATION_LUT, see fann_lut in fann.c.
+ */
+
+#define FANN_LUT_SIGMOID_RANGE 8.0f
+#define FANN_LUT_GAUSSIAN_RANGE 4.0f
+
+#if FANN_LUT_SIZE == 64
+
+#define FANN_LUT_SIGMOID_MAX_ERROR 7.5e-04
+static const fann_type fann_lut_sigmoid_table[65] = {
+    5.000000000e-01, 5.621765256e-01, 6.224593520e-01, 6.791787148e-01,
+    7.310585976e-01, 7.772998810e-01, 8.175745010e-01, 8.519527912e-01,
+    8.807970881e-01, 9.046505094e-01, 9.241418242e-01, 9.399133325e-01,
+    9.525741339e-01, 9.626731277e-01, 9.706877470e-01, 9.770226479e-01,
+    9.820137620e-01, 9.859363437e-01, 9.890130758e-01, 9.914225340e-01,
+    9.933071733e-01, 9.947798848e-01, 9.959298372e-01, 9.968273044e-01,
+    9.975273609e-01, 9.980732799e-01, 9.984987974e-01, 9.988304973e-01,
+    9.990889430e-01, 9.992903471e-01, 9.994472265e-01, 9.995694160e-01,
+    9.996646643e-01, 9.997388124e-01, 9.997965693e-01, 9.998415709e-01,
+    9.998766184e-01, 9.999039173e-01, 9.999251366e-01, 9.999417067e-01,
+    9.999545813e-01, 9.999646544e-01, 9.999724627e-01, 9.999785423e-01,
+    9.999833107e-01, 9.999870062e-01, 9.999898672e-01, 9.999921322e-01,
+    9.999938607e-01, 9.999952316e-01, 9.999962449e-01, 9.999970794e-01,
+    9.999977350e-01, 9.999982119e-01, 9.999986291e-01, 9.999989271e-01,
+    9.999991655e-01, 9.999993443e-01, 9.999995232e-01, 9.999995828e-01,
+    9.999997020e-01, 9.999997616e-01, 9.999998212e-01, 9.999998808e-01,
+    9.999998808e-01
+};
+
+#define FANN_LUT_GAUSSIAN_MAX_ERROR 9.7e-04
+static const fann_type fann_lut_gaussian_table[65] = {
+    1.000000000e+00, 9.961013794e-01, 9.844964147e-01, 9.654545784e-01,
+    9.394130707e-01, 9.069606066e-01, 8.688150644e-01, 8.257970214e-01,
+    7.788007855e-01, 7.287633419e-01, 6.766338348e-01, 6.233443022e-01,
+    5.697828531e-01, 5.167706013e-01, 4.650431871e-01, 4.152368307e-01,
+    3.678794503e-01, 3.233867586e-01, 2.820629478e-01, 2.441051453e-01,
+    2.096113861e-01, 1.785911322e-01, 1.509774178e-01, 1.266400814e-01,
+    1.053992212e-01, 8.703836799e-02, 7.131668180e-02, 5.798005313e-02,
+    4.677062109e-02, 3.743473440e-02, 2.972921729e-02, 2.342605963e-02,
+    1.831563935e-02, 1.420862321e-02, 1.093676779e-02, 8.352818899e-03,
+    6.329715252e-03, 4.759292584e-03, 3.550648456e-03, 2.628331073e-03,
+    1.930454164e-03, 1.406844240e-03, 1.017277827e-03, 7.298611454e-04,
+    5.195746780e-04, 3.669972357e-04, 2.572081285e-04, 1.788601658e-04,
+    1.234098017e-04, 8.448756125e-05, 5.739088738e-05, 3.868122440e-05,
+    2.586809933e-05, 1.716468978e-05, 1.130093642e-05, 7.382440799e-06,
+    4.785117198e-06, 3.077459269e-06, 1.963808245e-06, 1.243405904e-06,
+    7.811489127e-07, 4.869247618e-07, 3.011597585e-07, 1.848157893e-07,
+    1.125351758e-07
+};
+
+#define FANN_LUT_SIN_MAX_ERROR 1.2e-03
+static const fann_type fann_lut_sin_table[65] = {
+    0.000000000e+00, 9.801714122e-02, 1.950903237e-01, 2.902846634e-01,
+    3.826834261e-01, 4.713967443e-01, 5.555702448e-01, 6.343932748e-01,
+    7.071067691e-01, 7.730104327e-01, 8.314695954e-01, 8.819212914e-01,
+    9.238795042e-01, 9.569403529e-01, 9.807852507e-01, 9.951847196e-01,
+    1.000000000e+00, 9.951847196e-01, 9.807852507e-01, 9.569403529e-01,
+    9.238795042e-01, 8.819212914e-01, 8.314695954e-01, 7.730104327e-01,
+    7.071067691e-01, 6.343932748e-01, 5.555702448e-01, 4.713967443e-01,
+    3.826834261e-01, 2.902846634e-01, 1.950903237e-01, 9.801714122e-02,
+    1.224646853e-16, -9.801714122e-02, -1.950903237e-01, -2.902846634e-01,
+    -3.826834261e-01, -4.713967443e-01, -5.555702448e-01, -6.343932748e-01,
+    -7.071067691e-01, -7.730104327e-01, -8.314695954e-01, -8.819212914e-01,
+    -9.238795042e-01, -9.569403529e-01, -9.807852507e-01, -9.951847196e-01,
+    -1.000000000e+00, -9.951847196e-01, -9.807852507e-01, -9.569403529e-01,
+    -9.238795042e-01, -8.819212914e-01, -8.314695954e-01, -7.730104327e-01,
+    -7.071067691e-01, -6.343932748e-01, -5.555702448e-01, -4.713967443e-01,
+    -3.826834261e-01, -2.902846634e-01, -1.950903237e-01, -9.801714122e-02,
+    -2.449293705e-16
+};
+
+#elif FANN_LUT_SIZE == 128
+
+#define FANN_LUT_SIGMOID_MAX_ERROR 1.9e-04
+static const fann_type fann_lut_sigmoid_table[129] = {
+    5.000000000e-01, 5.312093496e-01, 5.621765256e-01, 5.926666260e-01,
+    6.224593520e-01, 6.513548493e-01, 6.791787148e-01, 7.057850361e-01,
+    7.310585976e-01, 7.549149990e-01, 7.772998810e-01, 7.981867790e-01,
+    8.175745010e-01, 8.354835510e-01, 8.519527912e-01, 8.670357466e-01,
+    8.807970881e-01, 8.933094144e-01, 9.046505094e-01, 9.149009585e-01,
+    9.241418242e-01, 9.324533343e-01, 9.399133325e-01, 9.465966821e-01,
+    9.525741339e-01, 9.579122663e-01, 9.626731277e-01, 9.669139981e-01,
+    9.706877470e-01, 9.740426540e-01, 9.770226479e-01, 9.796676636e-01,
+    9.820137620e-01, 9.840936065e-01, 9.859363437e-01, 9.875683784e-01,
+    9.890130758e-01, 9.902915359e-01, 9.914225340e-01, 9.924227595e-01,
+    9.933071733e-01, 9.940889478e-01, 9.947798848e-01, 9.953904152e-01,
+    9.959298372e-01, 9.964063764e-01, 9.968273044e-01, 9.971990585e-01,
+    9.975273609e-01, 9.978172779e-01, 9.980732799e-01, 9.982993007e-01,
+    9.984987974e-01, 9.986749887e-01, 9.988304973e-01, 9.989677668e-01,
+    9.990889430e-01, 9.991959333e-01, 9.992903471e-01, 9.993736744e-01,
+    9.994472265e-01, 9.995121360e-01, 9.995694160e-01, 9.996200204e-01,
+    9.996646643e-01, 9.997040629e-01, 9.997388124e-01, 9.997695088e-01,
+    9.997965693e-01, 9.998204708e-01, 9.998415709e-01, 9.998601675e-01,
+    9.998766184e-01, 9.998911023e-01, 9.999039173e-01, 9.999151826e-01,
+    9.999251366e-01, 9.999339581e-01, 9.999417067e-01, 9.999485612e-01,
+    9.999545813e-01, 9.999599457e-01, 9.999646544e-01, 9.999688268e-01,
+    9.999724627e-01, 9.999756813e-01, 9.999785423e-01, 9.999810457e-01,
+    9.999833107e-01, 9.999852777e-01, 9.999870062e-01, 9.999884963e-01,
+    9.999898672e-01, 9.999910593e-01, 9.999921322e-01, 9.999930263e-01,
+    9.999938607e-01, 9.999945760e-01, 9.999952316e-01, 9.999957681e-01,
+    9.999962449e-01, 9.999967217e-01, 9.999970794e-01, 9.999974370e-01,
+    9.999977350e-01, 9.999980330e-01, 9.999982119e-01, 9.999984503e-01,
+    9.999986291e-01, 9.999988079e-01, 9.999989271e-01, 9.999990463e-01,
+    9.999991655e-01, 9.999992847e-01, 9.999993443e-01, 9.999994040e-01,
+    9.999995232e-01, 9.999995828e-01, 9.999995828e-01, 9.999996424e-01,
+    9.999997020e-01, 9.999997020e-01, 9.999997616e-01, 9.999997616e-01,
+    9.999998212e-01, 9.999998212e-01, 9.999998808e-01, 9.999998808e-01,
+    9.999998808e-01
+};
+
+#define FANN_LUT_GAUSSIAN_MAX_ERROR 2.4e-04
+static const fann_type fann_lut_gaussian_table[129] = {
+    1.000000000e+00, 9.990239143e-01, 9.961013794e-01, 9.912494421e-01,
+    9.844964147e-01, 9.758815765e-01, 9.654545784e-01, 9.532752633e-01,
+    9.394130707e-01, 9.239460826e-01, 9.069606066e-01, 8.885502815e-01,
+    8.688150644e-01, 8.478605747e-01, 8.257970214e-01, 8.027382493e-01,
+    7.788007855e-01, 7.541028261e-01, 7.287633419e-01, 7.029011250e-01,
+    6.766338348e-01, 6.500772834e-01, 6.233443022e-01, 5.965444446e-01,
+    5.697828531e-01, 5.431599021e-01, 5.167706013e-01, 4.907040596e-01,
+    4.650431871e-01, 4.398642778e-01, 4.152368307e-01, 3.912234008e-01,
+    3.678794503e-01, 3.452534378e-01, 3.233867586e-01, 3.023140132e-01,
+    2.820629478e-01, 2.626549602e-01, 2.441051453e-01, 2.264227271e-01,
+    2.096113861e-01, 1.936696172e-01, 1.785911322e-01, 1.643652767e-01,
+    1.509774178e-01, 1.384094357e-01, 1.266400814e-01, 1.156454086e-01,
+    1.053992212e-01, 9.587341547e-02, 8.703836799e-02, 7.886332273e-02,
+    7.131668180e-02, 6.436636299e-02, 5.798005313e-02, 5.212547258e-02,
+    4.677062109e-02, 4.188399389e-02, 3.743473440e-02, 3.339283168e-02,
+    2.972921729e-02, 2.641590312e-02, 2.342605963e-02, 2.073407918e-02,
+    1.831563935e-02, 1.614771783e-02, 1.420862321e-02, 1.247798931e-02,
+    1.093676779e-02, 9.567205794e-03, 8.352818899e-03, 7.278346457e-03,
+    6.329715252e-03, 5.493984092e-03, 4.759292584e-03, 4.114803858e-03,
+    3.550648456e-03, 3.057862632e-03, 2.628331073e-03, 2.254726598e-03,
+    1.930454164e-03, 1.649593236e-03, 1.406844240e-03, 1.197476289e-03,
+    1.017277827e-03, 8.625097689e-04, 7.298611454e-04, 6.164079532e-04,
+    5.195746780e-04, 4.370986717e-04, 3.669972357e-04, 3.075373243e-04,
+    2.572081285e-04, 2.146956540e-04, 1.788601658e-04, 1.487153349e-04,
+    1.234098017e-04, 1.022104552e-04, 8.448756125e-05, 6.970147660e-05,
+    5.739088738e-05, 4.716237891e-05, 3.868122440e-05, 3.166332317e-05,
+    2.586809933e-05, 2.109232082e-05, 1.716468978e-05, 1.394117226e-05,
+    1.130093642e-05, 9.142843737e-06, 7.382440799e-06, 5.949362276e-06,
+    4.785117198e-06, 3.841196758e-06, 3.077459269e-06, 2.460762971e-06,
+    1.963808245e-06, 1.564156150e-06, 1.243405904e-06, 9.865009361e-07,
+    7.811489127e-07, 6.173365250e-07, 4.869247618e-07, 3.833129654e-07,
+    3.011597585e-07, 2.361522604e-07, 1.848157893e-07, 1.443569886e-07,
+    1.125351758e-07
+};
+
+#define FANN_LUT_SIN_MAX_ERROR 3.0e-04
+static const fann_type fann_lut_sin_table[129] = {
+    0.000000000e+00, 4.906767607e-02, 9.801714122e-02, 1.467304677e-01,
+    1.950903237e-01, 2.429801822e-01, 2.902846634e-01, 3.368898630e-01,
+    3.826834261e-01, 4.275550842e-01, 4.713967443e-01, 5.141027570e-01,
+    5.555702448e-01, 5.956993103e-01, 6.343932748e-01, 6.715589762e-01,
+    7.071067691e-01, 7.409511209e-01, 7.730104327e-01, 8.032075167e-01,
+    8.314695954e-01, 8.577286005e-01, 8.819212914e-01, 9.039893150e-01,
+    9.238795042e-01, 9.415440559e-01, 9.569403529e-01, 9.700312614e-01,
+    9.807852507e-01, 9.891765118e-01, 9.951847196e-01, 9.987954497e-01,
+    1.000000000e+00, 9.987954497e-01, 9.951847196e-01, 9.891765118e-01,
+    9.807852507e-01, 9.700312614e-01, 9.569403529e-01, 9.415440559e-01,
+    9.238795042e-01, 9.039893150e-01, 8.819212914e-01, 8.577286005e-01,
+    8.314695954e-01, 8.032075167e-01, 7.730104327e-01, 7.409511209e-01,
+    7.071067691e-01, 6.715589762e-01, 6.343932748e-01, 5.956993103e-01,
+    5.555702448e-01, 5.141027570e-01, 4.713967443e-01, 4.275550842e-01,
+    3.826834261e-01, 3.368898630e-01, 2.902846634e-01, 2.429801822e-01,
+    1.950903237e-01, 1.467304677e-01, 9.801714122e-02, 4.906767607e-02,
+    1.224646853e-16, -4.906767607e-02, -9.801714122e-02, -1.467304677e-01,
+    -1.950903237e-01, -2.429801822e-01, -2.902846634e-01, -3.368898630e-01,
+    -3.826834261e-01, -4.275550842e-01, -4.713967443e-01, -5.141027570e-01,
+    -5.555702448e-01, -5.956993103e-01, -6.343932748e-01, -6.715589762e-01,
+    -7.071067691e-01, -7.409511209e-01, -7.730104327e-01, -8.032075167e-01,
+    -8.314695954e-01, -8.577286005e-01, -8.819212914e-01, -9.039893150e-01,
+    -9.238795042e-01, -9.415440559e-01, -9.569403529e-01, -9.700312614e-01,
+    -9.807852507e-01, -9.891765118e-01, -9.951847196e-01, -9.987954497e-01,
+    -1.000000000e+00, -9.987954497e-01, -9.951847196e-01, -9.891765118e-01,
+    -9.807852507e-01, -9.700312614e-01, -9.569403529e-01, -9.415440559e-01,
+    -9.238795042e-01, -9.039893150e-01, -8.819212914e-01, -8.577286005e-01,
+    -8.314695954e-01, -8.032075167e-01, -7.730104327e-01, -7.409511209e-01,
+    -7.071067691e-01, -6.715589762e-01, -6.343932748e-01, -5.956993103e-01,
+    -5.555702448e-01, -5.141027570e-01, -4.713967443e-01, -4.275550842e-01,
+    -3.826834261e-01, -3.368898630e-01, -2.902846634e-01, -2.429801822e-01,
+    -1.950903237e-01, -1.467304677e-01, -9.801714122e-02, -4.906767607e-02,
+    -2.449293705e-16
+};
+
+#elif FANN_LUT_SIZE == 256
+
+#define FANN_LUT_SIGMOID_MAX_ERROR 4.7e-05
+static const fann_type fann_lut_sigmoid_table[257] = {
+    5.000000000e-01, 5.156199336e-01, 5.312093496e-01, 5.467381477e-01,
+    5.621765256e-01, 5.774953365e-01, 5.926666260e-01, 6.076631546e-01,
+    6.224593520e-01, 6.370307803e-01, 6.513548493e-01, 6.654105783e-01,
+    6.791787148e-01, 6.926419735e-01, 7.057850361e-01, 7.185943723e-01,
+    7.310585976e-01, 7.431679964e-01, 7.549149990e-01, 7.662936449e-01,
+    7.772998810e-01, 7.879312038e-01, 7.981867790e-01, 8.080672026e-01,
+    8.175745010e-01, 8.267117739e-01, 8.354835510e-01, 8.438950777e-01,
+    8.519527912e-01, 8.596637249e-01, 8.670357466e-01, 8.740772605e-01,
+    8.807970881e-01, 8.872045875e-01, 8.933094144e-01, 8.991214037e-01,
+    9.046505094e-01, 9.099069834e-01, 9.149009585e-01, 9.196425080e-01,
+    9.241418242e-01, 9.284088016e-01, 9.324533343e-01, 9.362850189e-01,
+    9.399133325e-01, 9.433475733e-01, 9.465966821e-01, 9.496693611e-01,
+    9.525741339e-01, 9.553191066e-01, 9.579122663e-01, 9.603611827e-01,
+    9.626731277e-01, 9.648551345e-01, 9.669139981e-01, 9.688561559e-01,
+    9.706877470e-01, 9.724147320e-01, 9.740426540e-01, 9.755769372e-01,
+    9.770226479e-01, 9.783846736e-01, 9.796676636e-01, 9.808759689e-01,
+    9.820137620e-01, 9.830850959e-01, 9.840936065e-01, 9.850429296e-01,
+    9.859363437e-01, 9.867771864e-01, 9.875683784e-01, 9.883127213e-01,
+    9.890130758e-01, 9.896718264e-01, 9.902915359e-01, 9.908743501e-01,
+    9.914225340e-01, 9.919379950e-01, 9.924227595e-01, 9.928785563e-01,
+    9.933071733e-01, 9.937101007e-01, 9.940889478e-01, 9.944450855e-01,
+    9.947798848e-01, 9.950945973e-01, 9.953904152e-01, 9.956684709e-01,
+    9.959298372e-01, 9.961755276e-01, 9.964063764e-01, 9.966233969e-01,
+    9.968273044e-01, 9.970189929e-01, 9.971990585e-01, 9.973683357e-01,
+    9.975273609e-01, 9.976768494e-01, 9.978172779e-01, 9.979492426e-01,
+    9.980732799e-01, 9.981898069e-01, 9.982993007e-01, 9.984021783e-01,
+    9.984987974e-01, 9.985896349e-01, 9.986749887e-01, 9.987551570e-01,
+    9.988304973e-01, 9.989012480e-01, 9.989677668e-01, 9.990302324e-01,
+    9.990889430e-01, 9.991440773e-01, 9.991959333e-01, 9.992445707e-01,
+    9.992903471e-01, 9.993333220e-01, 9.993736744e-01, 9.994115829e-01,
+    9.994472265e-01, 9.994807243e-01, 9.995121360e-01, 9.995416999e-01,
+    9.995694160e-01, 9.995955229e-01, 9.996200204e-01, 9.996430278e-01,
+    9.996646643e-01, 9.996849895e-01, 9.997040629e-01, 9.997219443e-01,
+    9.997388124e-01, 9.997546077e-01, 9.997695088e-01, 9.997834563e-01,
+    9.997965693e-01, 9.998089075e-01, 9.998204708e-01, 9.998313189e-01,
+    9.998415709e-01, 9.998511672e-01, 9.998601675e-01, 9.998686314e-01,
+    9.998766184e-01, 9.998840690e-01, 9.998911023e-01, 9.998977184e-01,
+    9.999039173e-01, 9.999096990e-01, 9.999151826e-01, 9.999203086e-01,
+    9.999251366e-01, 9.999296665e-01, 9.999339581e-01, 9.999379516e-01,
+    9.999417067e-01, 9.999452233e-01, 9.999485612e-01, 9.999516606e-01,
+    9.999545813e-01, 9.999573231e-01, 9.999599457e-01, 9.999623895e-01,
+    9.999646544e-01, 9.999668002e-01, 9.999688268e-01, 9.999706745e-01,
+    9.999724627e-01, 9.999741316e-01, 9.999756813e-01, 9.999771714e-01,
+    9.999785423e-01, 9.999798536e-01, 9.999810457e-01, 9.999822378e-01,
+    9.999833107e-01, 9.999843240e-01, 9.999852777e-01, 9.999861717e-01,
+    9.999870062e-01, 9.999877810e-01, 9.999884963e-01, 9.999892116e-01,
+    9.999898672e-01, 9.999904633e-01, 9.999910593e-01, 9.999915957e-01,
+    9.999921322e-01, 9.999926090e-01, 9.999930263e-01, 9.999934435e-01,
+    9.999938607e-01, 9.999942183e-01, 9.999945760e-01, 9.999949336e-01,
+    9.999952316e-01, 9.999955297e-01, 9.999957681e-01, 9.999960065e-01,
+    9.999962449e-01, 9.999964833e-01, 9.999967217e-01, 9.999969006e-01,
+    9.999970794e-01, 9.999972582e-01, 9.999974370e-01, 9.999976158e-01,
+    9.999977350e-01, 9.999978542e-01, 9.999980330e-01, 9.999981523e-01,
+    9.999982119e-01, 9.999983311e-01, 9.999984503e-01, 9.999985695e-01,
+    9.999986291e-01, 9.999986887e-01, 9.999988079e-01, 9.999988675e-01,
+    9.999989271e-01, 9.999989867e-01, 9.999990463e-01, 9.999991059e-01,
+    9.999991655e-01, 9.999992251e-01, 9.999992847e-01, 9.999992847e-01,
+    9.999993443e-01, 9.999994040e-01, 9.999994040e-01, 9.999994636e-01,
+    9.999995232e-01, 9.999995232e-01, 9.999995828e-01, 9.999995828e-01,
+    9.999995828e-01, 9.999996424e-01, 9.999996424e-01, 9.999997020e-01,
+    9.999997020e-01, 9.999997020e-01, 9.999997020e-01, 9.999997616e-01,
+    9.999997616e-01, 9.999997616e-01, 9.999997616e-01, 9.999998212e-01,
+    9.999998212e-01, 9.999998212e-01, 9.999998212e-01, 9.999998212e-01,
+    9.999998808e-01, 9.999998808e-01, 9.999998808e-01, 9.999998808e-01,
+    9.999998808e-01
+};
+
+#define FANN_LUT_GAUSSIAN_MAX_ERROR 6.1e-05
+static const fann_type fann_lut_gaussian_table[257] = {
+    1.000000000e+00, 9.997558594e-01, 9.990239143e-01, 9.978051186e-01,
+    9.961013794e-01, 9.939150810e-01, 9.912494421e-01, 9.881083965e-01,
+    9.844964147e-01, 9.804188609e-01, 9.758815765e-01, 9.708910584e-01,
+    9.654545784e-01, 9.595798254e-01, 9.532752633e-01, 9.465498328e-01,
+    9.394130707e-01, 9.318749309e-01, 9.239460826e-01, 9.156374931e-01,
+    9.069606066e-01, 8.979274631e-01, 8.885502815e-01, 8.788417578e-01,
+    8.688150644e-01, 8.584834337e-01, 8.478605747e-01, 8.369603753e-01,
+    8.257970214e-01, 8.143848181e-01, 8.027382493e-01, 7.908719778e-01,
+    7.788007855e-01, 7.665394545e-01, 7.541028261e-01, 7.415058017e-01,
+    7.287633419e-01, 7.158901691e-01, 7.029011250e-01, 6.898108125e-01,
+    6.766338348e-01, 6.633845568e-01, 6.500772834e-01, 6.367259026e-01,
+    6.233443022e-01, 6.099460721e-01, 5.965444446e-01, 5.831524730e-01,
+    5.697828531e-01, 5.564479232e-01, 5.431599021e-01, 5.299302936e-01,
+    5.167706013e-01, 5.036916733e-01, 4.907040596e-01, 4.778179824e-01,
+    4.650431871e-01, 4.523889720e-01, 4.398642778e-01, 4.274775386e-01,
+    4.152368307e-01, 4.031497240e-01, 3.912234008e-01, 3.794645369e-01,
+    3.678794503e-01, 3.564739525e-01, 3.452534378e-01, 3.342228532e-01,
+    3.233867586e-01, 3.127492666e-01, 3.023140132e-01, 2.920842767e-01,
+    2.820629478e-01, 2.722524703e-01, 2.626549602e-01, 2.532720566e-01,
+    2.441051453e-01, 2.351551503e-01, 2.264227271e-01, 2.179081440e-01,
+    2.096113861e-01, 2.015320957e-01, 1.936696172e-01, 1.860230416e-01,
+    1.785911322e-01, 1.713724583e-01, 1.643652767e-01, 1.575676501e-01,
+    1.509774178e-01, 1.445921957e-01, 1.384094357e-01, 1.324263662e-01,
+    1.266400814e-01, 1.210474968e-01, 1.156454086e-01, 1.104304716e-01,
+    1.053992212e-01, 1.005480886e-01, 9.587341547e-02, 9.137144685e-02,
+    8.703836799e-02, 8.287030458e-02, 7.886332273e-02, 7.501344383e-02,
+    7.131668180e-02, 6.776899844e-02, 6.436636299e-02, 6.110472977e-02,
+    5.798005313e-02, 5.498830602e-02, 5.212547258e-02, 4.938756302e-02,
+    4.677062109e-02, 4.427072406e-02, 4.188399389e-02, 3.960658982e-02,
+    3.743473440e-02, 3.536470234e-02, 3.339283168e-02, 3.151551262e-02,
+    2.972921729e-02, 2.803047746e-02, 2.641590312e-02, 2.488217689e-02,
+    2.342605963e-02, 2.204438671e-02, 2.073407918e-02, 1.949213631e-02,
+    1.831563935e-02, 1.720174961e-02, 1.614771783e-02, 1.515087113e-02,
+    1.420862321e-02, 1.331846975e-02, 1.247798931e-02, 1.168484148e-02,
+    1.093676779e-02, 1.023158897e-02, 9.567205794e-03, 8.941597305e-03,
+    8.352818899e-03, 7.799000014e-03, 7.278346457e-03, 6.789135747e-03,
+    6.329715252e-03, 5.898503121e-03, 5.493984092e-03, 5.114709027e-03,
+    4.759292584e-03, 4.426411819e-03, 4.114803858e-03, 3.823265433e-03,
+    3.550648456e-03, 3.295860719e-03, 3.057862632e-03, 2.835665829e-03,
+    2.628331073e-03, 2.434966620e-03, 2.254726598e-03, 2.086809138e-03,
+    1.930454164e-03, 1.784942346e-03, 1.649593236e-03, 1.523763174e-03,
+    1.406844240e-03, 1.298262388e-03, 1.197476289e-03, 1.103975112e-03,
+    1.017277827e-03, 9.369314648e-04, 8.625097689e-04, 7.936119218e-04,
+    7.298611454e-04, 6.709038280e-04, 6.164079532e-04, 5.660621682e-04,
+    5.195746780e-04, 4.766721395e-04, 4.370986717e-04, 4.006149829e-04,
+    3.669972357e-04, 3.360364062e-04, 3.075373243e-04, 2.813178580e-04,
+    2.572081285e-04, 2.350498544e-04, 2.146956540e-04, 1.960083027e-04,
+    1.788601658e-04, 1.631325867e-04, 1.487153349e-04, 1.355060667e-04,
+    1.234098017e-04, 1.123384791e-04, 1.022104552e-04, 9.295014752e-05,
+    8.448756125e-05, 7.675795496e-05, 6.970147660e-05, 6.326281436e-05,
+    5.739088738e-05, 5.203856927e-05, 4.716237891e-05, 4.272223669e-05,
+    3.868122440e-05, 3.500534513e-05, 3.166332317e-05, 2.862638758e-05,
+    2.586809933e-05, 2.336417674e-05, 2.109232082e-05, 1.903207703e-05,
+    1.716468978e-05, 1.547296779e-05, 1.394117226e-05, 1.255488951e-05,
+    1.130093642e-05, 1.016725946e-05, 9.142843737e-06, 8.217632057e-06,
+    7.382440799e-06, 6.628896244e-06, 5.949362276e-06, 5.336881259e-06,
+    4.785117198e-06, 4.288304353e-06, 3.841196758e-06, 3.439025932e-06,
+    3.077459269e-06, 2.752561841e-06, 2.460762971e-06, 2.198823950e-06,
+    1.963808245e-06, 1.753055358e-06, 1.564156150e-06, 1.394930450e-06,
+    1.243405904e-06, 1.107799676e-06, 9.865009361e-07, 8.780549479e-07,
+    7.811489127e-07, 6.945986684e-07, 6.173365250e-07, 5.484006351e-07,
+    4.869247618e-07, 4.321292977e-07, 3.833129654e-07, 3.398452861e-07,
+    3.011597585e-07, 2.667476053e-07, 2.361522604e-07, 2.089640674e-07,
+    1.848157893e-07, 1.633783313e-07, 1.443569886e-07, 1.274879367e-07,
+    1.125351758e-07
+};
+
+#define FANN_LUT_SIN_MAX_ERROR 7.5e-05
+static const fann_type fann_lut_sin_table[257] = {
+    0.000000000e+00, 2.454122901e-02, 4.906767607e-02, 7.356456667e-02,
+    9.801714122e-02, 1.224106774e-01, 1.467304677e-01, 1.709618866e-01,
+    1.950903237e-01, 2.191012353e-01, 2.429801822e-01, 2.667127550e-01,
+    2.902846634e-01, 3.136817515e-01, 3.368898630e-01, 3.598950505e-01,
+    3.826834261e-01, 4.052413106e-01, 4.275550842e-01, 4.496113360e-01,
+    4.713967443e-01, 4.928981960e-01, 5.141027570e-01, 5.349976420e-01,
+    5.555702448e-01, 5.758081675e-01, 5.956993103e-01, 6.152315736e-01,
+    6.343932748e-01, 6.531728506e-01, 6.715589762e-01, 6.895405650e-01,
+    7.071067691e-01, 7.242470980e-01, 7.409511209e-01, 7.572088242e-01,
+    7.730104327e-01, 7.883464098e-01, 8.032075167e-01, 8.175848126e-01,
+    8.314695954e-01, 8.448535800e-01, 8.577286005e-01, 8.700869679e-01,
+    8.819212914e-01, 8.932242990e-01, 9.039893150e-01, 9.142097831e-01,
+    9.238795042e-01, 9.329928160e-01, 9.415440559e-01, 9.495281577e-01,
+    9.569403529e-01, 9.637760520e-01, 9.700312614e-01, 9.757021070e-01,
+    9.807852507e-01, 9.852776527e-01, 9.891765118e-01, 9.924795628e-01,
+    9.951847196e-01, 9.972904325e-01, 9.987954497e-01, 9.996988177e-01,
+    1.000000000e+00, 9.996988177e-01, 9.987954497e-01, 9.972904325e-01,
+    9.951847196e-01, 9.924795628e-01, 9.891765118e-01, 9.852776527e-01,
+    9.807852507e-01, 9.757021070e-01, 9.700312614e-01, 9.637760520e-01,
+    9.569403529e-01, 9.495281577e-01, 9.415440559e-01, 9.329928160e-01,
+    9.238795042e-01, 9.142097831e-01, 9.039893150e-01, 8.932242990e-01,
+    8.819212914e-01, 8.700869679e-01, 8.577286005e-01, 8.448535800e-01,
+    8.314695954e-01, 8.175848126e-01, 8.032075167e-01, 7.883464098e-01,
+    7.730104327e-01, 7.572088242e-01, 7.409511209e-01, 7.242470980e-01,
+    7.071067691e-01, 6.895405650e-01, 6.715589762e-01, 6.531728506e-01,
+    6.343932748e-01, 6.152315736e-01, 5.956993103e-01, 5.758081675e-01,
+    5.555702448e-01, 5.349976420e-01, 5.141027570e-01, 4.928981960e-01,
+    4.713967443e-01, 4.496113360e-01, 4.275550842e-01, 4.052413106e-01,
+    3.826834261e-01, 3.598950505e-01, 3.368898630e-01, 3.136817515e-01,
+    2.902846634e-01, 2.667127550e-01, 2.429801822e-01, 2.191012353e-01,
+    1.950903237e-01, 1.709618866e-01, 1.467304677e-01, 1.224106774e-01,
+    9.801714122e-02, 7.356456667e-02, 4.906767607e-02, 2.454122901e-02,
+    1.224646853e-16, -2.454122901e-02, -4.906767607e-02, -7.356456667e-02,
+    -9.801714122e-02, -1.224106774e-01, -1.467304677e-01, -1.709618866e-01,
+    -1.950903237e-01, -2.191012353e-01, -2.429801822e-01, -2.667127550e-01,
+    -2.902846634e-01, -3.136817515e-01, -3.368898630e-01, -3.598950505e-01,
+    -3.826834261e-01, -4.052413106e-01, -4.275550842e-01, -4.496113360e-01,
+    -4.713967443e-01, -4.928981960e-01, -5.141027570e-01, -5.349976420e-01,
+    -5.555702448e-01, -5.758081675e-01, -5.956993103e-01, -6.152315736e-01,
+    -6.343932748e-01, -6.531728506e-01, -6.715589762e-01, -6.895405650e-01,
+    -7.071067691e-01, -7.242470980e-01, -7.409511209e-01, -7.572088242e-01,
+    -7.730104327e-01, -7.883464098e-01, -8.032075167e-01, -8.175848126e-01,
+    -8.314695954e-01, -8.448535800e-01, -8.577286005e-01, -8.700869679e-01,
+    -8.819212914e-01, -8.932242990e-01, -9.039893150e-01, -9.142097831e-01,
+    -9.238795042e-01, -9.329928160e-01, -9.415440559e-01, -9.495281577e-01,
+    -9.569403529e-01, -9.637760520e-01, -9.700312614e-01, -9.757021070e-01,
+    -9.807852507e-01, -9.852776527e-01, -9.891765118e-01, -9.924795628e-01,
+    -9.951847196e-01, -9.972904325e-01, -9.987954497e-01, -9.996988177e-01,
+    -1.000000000e+00, -9.996988177e-01, -9.987954497e-01, -9.972904325e-01,
+    -9.951847196e-01, -9.924795628e-01, -9.891765118e-01, -9.852776527e-01,
+    -9.807852507e-01, -9.757021070e-01, -9.700312614e-01, -9.637760520e-01,
+    -9.569403529e-01, -9.495281577e-01, -9.415440559e-01, -9.329928160e-01,
+    -9.238795042e-01, -9.142097831e-01, -9.039893150e-01, -8.932242990e-01,
+    -8.819212914e-01, -8.700869679e-01, -8.577286005e-01, -8.448535800e-01,
+    -8.314695954e-01, -8.175848126e-01, -8.032075167e-01, -7.883464098e-01,
+    -7.730104327e-01, -7.572088242e-01, -7.409511209e-01, -7.242470980e-01,
+    -7.071067691e-01, -6.895405650e-01, -6.715589762e-01, -6.531728506e-01,
+    -6.343932748e-01, -6.152315736e-01, -5.956993103e-01, -5.758081675e-01,
+    -5.555702448e-01, -5.349976420e-01, -5.141027570e-01, -4.928981960e-01,
+    -4.713967443e-01, -4.496113360e-01, -4.275550842e-01, -4.052413106e-01,
+    -3.826834261e-01, -3.598950505e-01, -3.368898630e-01, -3.136817515e-01,
+    -2.902846634e-01, -2.667127550e-01, -2.429801822e-01, -2.191012353e-01,
+    -1.950903237e-01, -1.709618866e-01, -1.467304677e-01, -1.224106774e-01,
+    -9.801714122e-02, -7.356456667e-02, -4.906767607e-02, -2.454122901e-02,
+    -2.449293705e-16
+};
+
+#else
+#error "FANN_LUT_SIZE must be 64, 128 or 256"
+#endif
+
+#endif
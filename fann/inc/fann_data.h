@@ -21,6 +21,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #define __fann_data_h__
 
 #include <stdio.h>
+#include <stdint.h>
 
 /* Section: FANN Datatypes
 
@@ -216,7 +217,6 @@ enum fann_activationfunc_enum
 	FANN_GAUSSIAN_SYMMETRIC,
 	/* Stepwise linear approximation to gaussian.
 	 * Faster than gaussian but a bit less precise.
-	 * NOT implemented yet.
 	 */
 	FANN_GAUSSIAN_STEPWISE,
 	FANN_ELLIOT,
@@ -367,6 +367,43 @@ static char const *const FANN_NETTYPE_NAMES[] = {
 };
 
 
+/* Enum: fann_engine_enum
+
+    Inference engines used by <fann_run>. The engine is selected once, when the
+    network is created, so that <fann_run> does not have to inspect the network
+    topology for every neuron.
+
+    FANN_ENGINE_GENERIC - Per-neuron loop, works with any network
+    FANN_ENGINE_DENSE - Layered, fully connected network whose layers use a
+        single activation function and steepness. Each layer is run as a
+        weight matrix by input vector product into a flat activation buffer,
+        and the activation function is applied once per layer.
+    FANN_ENGINE_SPARSE - Sparse network (connection_rate < 1) whose layers use
+        a single activation function and steepness. The connections are
+        stored CSR-style: the weights of each neuron are contiguous and
+        <fann_index_type> column indices point into the flat activation
+        buffer.
+*/
+enum fann_engine_enum
+{
+    FANN_ENGINE_GENERIC = 0,
+    FANN_ENGINE_DENSE,
+    FANN_ENGINE_SPARSE
+};
+
+/* Type: fann_index_type
+   Column index of a connection in the flat activation buffer, used by
+   FANN_ENGINE_SPARSE. 8 bits by default (networks of at most 256 neurons),
+   16 bits when compiled with FANN_INDEX16.
+*/
+#ifdef FANN_INDEX16
+typedef uint16_t fann_index_type;
+#define FANN_INDEX_MAX UINT16_MAX
+#else
+typedef uint8_t fann_index_type;
+#define FANN_INDEX_MAX UINT8_MAX
+#endif
+
 /* forward declarations for use with the callback */
 struct fann;
 struct fann_train_data;
@@ -410,6 +447,11 @@ FANN_EXTERNAL typedef int (FANN_API * fann_callback_type) (struct fann *ann, str
  * No data within these structures should be altered directly by the user.
  */
 
+/* The activation values are not stored in the neurons but in the flat
+ * <ann->values> array (see <fann_layer>), so that the dot products stream
+ * the weights and the values of the previous layer as two dense arrays.
+ * The sums are not stored at all, they are only needed for training.
+ */
 struct fann_neuron
 {
 	/* Index to the first and last connection
@@ -417,19 +459,11 @@ struct fann_neuron
 	 */
 	unsigned int first_con;
 	unsigned int last_con;
-	/* The sum of the inputs multiplied with the weights */
-	fann_type sum;
-	/* The value of the activation function applied to the sum */
-	fann_type value;
 	/* The steepness of the activation function */
 	fann_type activation_steepness;
 	/* Used to choose which activation function to use */
 	enum fann_activationfunc_enum activation_function;
-#ifdef __GNUC__
-} __attribute__ ((packed));
-#else
 };
-#endif
 
 /* A single layer in the neural network.
  */
@@ -445,6 +479,35 @@ struct fann_layer
 	/* A pointer to the neuron past the last neuron in the layer */
 	/* the number of neurons is last_neuron - first_neuron */
 	struct fann_neuron *last_neuron;
+
+	/* A pointer to the activation values of the layer, bias included: the
+	 * value of neuron first_neuron + i is values[i]. All the layers share the
+	 * flat <ann->values> buffer.
+	 */
+	fann_type *values;
+
+	/* Activation function and steepness shared by all the neurons of the
+	 * layer (only valid with the dense engine).
+	 */
+	enum fann_activationfunc_enum activation_function;
+	fann_type activation_steepness;
+
+	/* Breakpoints of the stepwise activation function of the layer, already
+	 * divided by its steepness in fixed point (see fann_update_stepwise).
+	 */
+	fann_type stepwise_values[6];
+
+#ifndef FIXEDFANN
+	/* Bound of the sums of the layer, 150 divided by its steepness (only
+	 * valid with the dense and sparse engines, see fann_update_max_sum).
+	 */
+	fann_type max_sum;
+#endif
+
+#ifdef FANN_Q15
+	/* Number of fractional bits of the weights feeding the layer */
+	unsigned int weight_decimal_point;
+#endif
 };
 
 /* Struct: struct fann_error
@@ -497,6 +560,9 @@ struct fann
 	 */
 	float connection_rate;
 
+	/* The inference engine, selected when the network is created */
+	enum fann_engine_enum engine;
+
 	/* is 1 if shortcut connections are used in the ann otherwise 0
 	 * Shortcut connections are connections that skip layers.
 	 * A fully connected ann with shortcut connections are a ann where
@@ -528,8 +594,13 @@ struct fann
 	/* The weight array */
 	fann_type *weights;
 
-	/* The connection array */
-	struct fann_neuron **connections;
+	/* The column index in <values> of the neuron feeding each connection
+	 * (sparse networks only)
+	 */
+	fann_index_type *columns;
+
+	/* The activation values of all the neurons, layer after layer */
+	fann_type *values;
 
 	/* Used to contain the errors used during training
 	 * Is allocated during first training session,
@@ -553,16 +624,20 @@ struct fann
 	 */
 	unsigned int multiplier;
 
+#endif
+
 	/* When in choosen (or in fixed point), the sigmoid function is
 	 * calculated as a stepwise linear function. In the
 	 * activation_results array, the result is saved, and in the
 	 * two values arrays, the values that gives the results are saved.
+	 * The gaussian is stepwise on the absolute value of the sum.
 	 */
 	fann_type sigmoid_results[6];
 	fann_type sigmoid_values[6];
 	fann_type sigmoid_symmetric_results[6];
 	fann_type sigmoid_symmetric_values[6];
-#endif
+	fann_type gaussian_results[6];
+	fann_type gaussian_values[6];
 
 	/* Total number of connections.
 	 * very useful, because the actual connections
@@ -823,4 +898,138 @@ struct fann_connection
     fann_type weight;
 };
 
+/* Constant: FANN_BATCH_NEURONS
+   Neurons of the largest network run in batches by <fann_run_batch>, bias
+   neurons included (32 by default, the thyroid network). The batch buffer
+   takes FANN_BATCH_NEURONS * FANN_BATCH values of SRAM.
+*/
+#ifndef FANN_BATCH_NEURONS
+#define FANN_BATCH_NEURONS 32
+#endif
+
+/* Constant: FANN_ACT_NEURONS
+   Activations of a network allocated in the .fann_act section (SRAM) rather
+   than the heap, which lnk_msp430fr5994.cmd places in FRAM (32 by default,
+   the thyroid network). Only one network at a time uses the buffer; larger
+   networks, or a second one, fall back to the heap.
+*/
+#ifndef FANN_ACT_NEURONS
+#define FANN_ACT_NEURONS 32
+#endif
+
+/* Constant: FANN_LEA_WORDS
+   Words of LEA RAM holding the weights, input vectors and results of the
+   dense layers with FANN_LEA (1024 by default, 2 KB of the 3.7 KB of
+   LEARAM). The layers that do not fit any more are run by the CPU.
+*/
+#ifndef FANN_LEA_WORDS
+#define FANN_LEA_WORDS 1024
+#endif
+
+/* Constant: FANN_LEA_LAYERS
+   Layers, after the input layer, that can run on the LEA with FANN_LEA (8 by
+   default): the following ones are run by the CPU.
+*/
+#ifndef FANN_LEA_LAYERS
+#define FANN_LEA_LAYERS 8
+#endif
+
+/* Constant: FANN_POWER_HISTORY
+   Number of power cycles remembered by <fann_power_history> (8 by default).
+*/
+#ifndef FANN_POWER_HISTORY
+#define FANN_POWER_HISTORY 8
+#endif
+
+/* Type: fann_power_history
+
+    Uptimes of the last <FANN_POWER_HISTORY> power cycles, to be placed in
+    non-volatile memory (FRAM). The uptime of a cycle is the last one recorded
+    while it was running (at the last checkpoint), i.e. a lower bound of its
+    on-time. All the fields start at 0.
+
+    uptime - Uptimes of the last power cycles, in ticks of the clock
+    count - Number of valid uptimes
+    next - Position of the next uptime
+    started - Set at the first start
+    alive - Last uptime recorded in the current power cycle
+
+    See also:
+        <fann_power_history_boot>, <fann_checkpoint_adapt>
+*/
+struct fann_power_history
+{
+    uint16_t uptime[FANN_POWER_HISTORY];
+    unsigned int count;
+    unsigned int next;
+    unsigned int started;
+    volatile uint16_t alive;
+};
+
+/* Type: fann_clock_type
+   Returns the time since the start of the current power cycle, in ticks of
+   a free-running timer (saturated at 0xFFFF).
+
+	>typedef uint16_t (FANN_API * fann_clock_type) (void);
+*/
+FANN_EXTERNAL typedef uint16_t (FANN_API * fann_clock_type) (void);
+
+/* Type: fann_checkpoint_costs
+
+    Cost model used by <fann_checkpoint_adapt>, in ticks of the clock of the
+    checkpoint at the clock frequency the program runs at: measure them with
+    <fann_checkpoint_measure> rather than converting cycles.
+
+    restart - From the start of a power cycle to the first neuron (start-up,
+        creation of the network, resume)
+    neuron - Running a neuron (average over the network)
+    save - Saving the activation of a neuron
+    commit - Committing a checkpoint (cursor, and task when the checkpoint
+        ends an inference), with the overhead of running the neurons as a
+        chunk
+*/
+struct fann_checkpoint_costs
+{
+    uint16_t restart;
+    uint16_t neuron;
+    uint16_t save;
+    uint16_t commit;
+};
+
+/* Type: fann_checkpoint
+
+    Progress of an inference run by <fann_run_resumable>, to be placed in
+    non-volatile memory (FRAM) together with the buffer it points to.
+
+    values - Copy of the activations of the network (<fann_get_total_neurons>
+        values, those of the input layer are not used since the input is given
+        again on resume). Required: the activations of the network are in
+        SRAM (.fann_act), with FANN_STATIC too, and lost at each reset. NULL
+        skips the copy and is only valid for a network whose activation
+        buffer is in FRAM and not initialised at boot.
+    interval - Number of neurons run between two checkpoints (at least 1)
+    cursor - Committed cursor: the neurons before it are computed and saved,
+        0 when no inference is in progress. Double-buffered, active selects
+        the valid copy and writing it is the commit point.
+
+    history, clock - Optional: at every commit the uptime returned by clock
+        is recorded in history, see <fann_checkpoint_adapt>; nothing is
+        recorded unless both are set
+
+    Only values and interval have to be initialised, e.g.
+    >#pragma PERSISTENT(checkpoint_values)
+    >fann_type checkpoint_values[32] = {0};
+    >#pragma PERSISTENT(checkpoint)
+    >struct fann_checkpoint checkpoint = { .values = checkpoint_values, .interval = 8 };
+*/
+struct fann_checkpoint
+{
+    volatile fann_type *values;
+    unsigned int interval;
+    volatile unsigned int cursor[2];
+    volatile unsigned int active;
+    struct fann_power_history *history;
+    fann_clock_type clock;
+};
+
 #endif
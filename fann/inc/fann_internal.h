@@ -59,6 +59,7 @@ struct fann *fann_allocate_structure(unsigned int num_layers);
 void fann_allocate_neurons(struct fann *ann);
 
 void fann_allocate_connections(struct fann *ann);
+void fann_select_engine(struct fann *ann);
 
 int fann_save_internal(struct fann *ann, const char *configuration_file,
                        unsigned int save_as_fixed);
@@ -70,6 +71,7 @@ int fann_save_train_internal_fd(struct fann_train_data *data, FILE * file, const
                                  unsigned int save_as_fixed, unsigned int decimal_point);
 
 void fann_update_stepwise(struct fann *ann);
+void fann_update_max_sum(struct fann *ann);
 void fann_seed_rand();
 
 void fann_error(struct fann_error *errdat, const enum fann_errno_enum errno_f, ...);
@@ -138,11 +140,32 @@ FANN_EXTERNAL void FANN_API fann_scale_data_to_range(fann_type ** data, unsigned
 
 #ifdef FIXEDFANN
 
+#ifdef FANN_Q15
+/* Q15 products are accumulated unshifted in 32 bits, see fann_q15_sum */
+#define fann_mult(x,y) ((int32_t) (x) * (y))
+#else
 #define fann_mult(x,y) ((x*y) >> decimal_point)
+#endif
 #define fann_div(x,y) (((x) << decimal_point)/y)
 #define fann_random_weight() (fann_type)(fann_rand(0,multiplier/10))
 #define fann_random_bias_weight() (fann_type)(fann_rand((0-multiplier)/10,multiplier/10))
 
+#ifdef FANN_Q15
+/* Q15 activations are Q0.15, sums (before the activation) and steepnesses are
+ * Q7.8, weights have a per layer number of fractional bits. */
+#define FANN_Q15_SUM_DECIMAL_POINT 8
+
+/* Converts a 32-bit accumulator (Q15 activations times weights) to a
+ * saturated Q7.8 sum */
+#define fann_q15_sum(acc, weight_decimal_point) \
+    ((fann_type) fann_clip((acc) >> ((weight_decimal_point) + 15 - FANN_Q15_SUM_DECIMAL_POINT), \
+                           (int32_t) INT16_MIN, (int32_t) INT16_MAX))
+
+typedef int32_t fann_sum_type;
+#else
+typedef fann_type fann_sum_type;
+#endif // FANN_Q15
+
 #else
 
 #define fann_mult(x,y) (x*y)
@@ -150,6 +173,8 @@ FANN_EXTERNAL void FANN_API fann_scale_data_to_range(fann_type ** data, unsigned
 #define fann_random_weight() (fann_rand(-0.1f,0.1f))
 #define fann_random_bias_weight() (fann_rand(-0.1f,0.1f))
 
+typedef fann_type fann_sum_type;
+
 #endif
 
 #endif
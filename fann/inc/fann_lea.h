@@ -0,0 +1,60 @@
+#ifndef __fann_lea_h__
+#define __fann_lea_h__
+
+/* Low-Energy Accelerator (LEA) backend of the Q15 dense engine, FANN_LEA.
+ * The weights of the dense layers stay in LEA RAM (.leaRAM, see
+ * lnk_msp430fr5994.cmd) and the sums of a layer are one matrix-vector
+ * product, msp_matrix_mpy_q15 of TI's DSPLib (add DSPLib to the project).
+ * Without LEA, on the host, the command is emulated below, see fann_run_lea
+ * in fann.c.
+ */
+
+#ifdef __MSP430_HAS_LEA__
+#include "DSPLib.h"
+#else
+#include <stdint.h>
+
+typedef int16_t _q15;
+typedef int32_t _iq31;
+
+typedef enum {
+    MSP_SUCCESS = 0,
+    MSP_SIZE_ERROR = 1
+} msp_status;
+
+typedef struct msp_matrix_mpy_q15_params {
+    uint16_t srcARows;
+    uint16_t srcACols;
+    uint16_t srcBRows;
+    uint16_t srcBCols;
+} msp_matrix_mpy_q15_params;
+
+/* Emulation of msp_matrix_mpy_q15: each element of the product is the sum of
+   the Q30 products accumulated in 32 bits, shifted right by 15 (truncated)
+   and saturated to a Q15 value. The columns must be of even length. */
+static msp_status msp_matrix_mpy_q15(const msp_matrix_mpy_q15_params *params, const _q15 *srcA,
+                                     const _q15 *srcB, _q15 *dst)
+{
+    uint16_t i, j, k;
+    uint32_t acc;
+    int32_t sum;
+
+    if (params->srcACols != params->srcBRows || (params->srcACols & 1) || (params->srcBCols & 1)) {
+        return MSP_SIZE_ERROR;
+    }
+    for (i = 0; i != params->srcARows; i++) {
+        for (j = 0; j != params->srcBCols; j++) {
+            acc = 0;
+            for (k = 0; k != params->srcACols; k++) {
+                acc += (uint32_t) ((int32_t) srcA[i * params->srcACols + k] * srcB[k * params->srcBCols + j]);
+            }
+            sum = (int32_t) acc >> 15;
+            *dst++ = (_q15) ((sum > INT16_MAX) ? INT16_MAX : (sum < INT16_MIN) ? INT16_MIN : sum);
+        }
+    }
+
+    return MSP_SUCCESS;
+}
+#endif // __MSP430_HAS_LEA__
+
+#endif // __fann_lea_h__
@@ -103,6 +103,27 @@ FANN_EXTERNAL struct fann_train_data *FANN_API fann_create_tests_from_header();
 FANN_EXTERNAL fann_type * FANN_API fann_test(struct fann *ann, fann_type * input,
 												 fann_type * desired_output);
 
+/* Function: fann_test_batch
+   Same as <fann_test> on num_samples inputs and desired outputs (rows of
+   <fann_get_num_input> and <fann_get_num_output> values), run with
+   <fann_run_batch>. The outputs are stored in outputs, which is returned.
+*/
+FANN_EXTERNAL fann_type * FANN_API fann_test_batch(struct fann *ann, fann_type * inputs,
+												   fann_type * desired_outputs,
+												   unsigned int num_samples,
+												   fann_type * outputs);
+
+/* Function: fann_test_output
+   Updates the mean square error as <fann_test> does, with an output computed
+   beforehand (e.g. layer by layer with <fann_run_layer>).
+
+   Returns the squared error of this output, i.e. what was added to the mean
+   square error before dividing it by the number of outputs tested, so that it
+   can also be accumulated outside of the network.
+*/
+FANN_EXTERNAL float FANN_API fann_test_output(struct fann *ann, fann_type * output,
+											  fann_type * desired_output);
+
 /* Function: fann_get_MSE
    Reads the mean square error from the network.
    
@@ -20,7 +20,12 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #ifndef __fixedfann_h__
 #define __fixedfann_h__
 
+#ifdef FANN_Q15
+#include <stdint.h>
+typedef int16_t fann_type;
+#else
 typedef long fann_type;
+#endif
 
 #undef FIXEDFANN
 #define FIXEDFANN
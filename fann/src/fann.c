@@ -19,6 +19,85 @@
 #include "config.h"
 #include "fann.h"
 
+#ifdef PROFILE_LAYERS
+#include "profiler.h"
+
+/* Regions of PROFILE_LAYERS: the computed layers (the last region counts the
+   layers beyond it), the dot products and the activation functions. */
+#define FANN_PROFILE_LAYERS 8
+
+static struct profiler_region fann_profile_layer[FANN_PROFILE_LAYERS] = {
+    PROFILER_REGION_INIT("layer 1"), PROFILER_REGION_INIT("layer 2"),
+    PROFILER_REGION_INIT("layer 3"), PROFILER_REGION_INIT("layer 4"),
+    PROFILER_REGION_INIT("layer 5"), PROFILER_REGION_INIT("layer 6"),
+    PROFILER_REGION_INIT("layer 7"), PROFILER_REGION_INIT("layers 8+")
+};
+static PROFILER_REGION(fann_profile_dot, "dot products");
+static PROFILER_REGION(fann_profile_activation, "activations");
+
+#define fann_profile_enter(region) profiler_enter(region)
+#define fann_profile_leave(region) profiler_leave(region)
+#else
+#define fann_profile_enter(region)
+#define fann_profile_leave(region)
+#endif // PROFILE_LAYERS
+
+#ifdef ENERGY
+#include "energy.h"
+#else
+#define energy_count(counter, n)
+#endif // ENERGY
+
+#if defined(FANN_LEA) && !defined(FANN_Q15)
+#error "FANN_LEA needs FANN_Q15"
+#endif
+
+#ifndef FANN_STATIC
+/* Activations of one network in SRAM, see fann_allocate_neurons. The static
+   network has its own buffer, see gen-infer --static. */
+#pragma DATA_SECTION(fann_act_values, ".fann_act")
+static fann_type fann_act_values[FANN_ACT_NEURONS];
+static struct fann *fann_act_owner = NULL;
+#endif // FANN_STATIC
+
+#ifdef FANN_LEA
+#include "fann_lea.h"
+
+/* Weights of the dense layers of one network, resident in LEA RAM: staged
+   once, at its first run after each boot (LEA RAM is SRAM), by
+   fann_lea_stage. fann_lea_layers[l] is the block of layer l + 1, NULL when
+   the CPU runs the layer. */
+#pragma DATA_SECTION(fann_lea_ram, ".leaRAM")
+#pragma DATA_ALIGN(fann_lea_ram, 4)
+static _q15 fann_lea_ram[FANN_LEA_WORDS];
+static struct fann *fann_lea_owner = NULL;
+static _q15 *fann_lea_layers[FANN_LEA_LAYERS];
+#endif // FANN_LEA
+
+/* Accesses to the network, for ENERGY. The weights and column indices are
+   read from FRAM: in place from .fann_weights, or from the heap (.sysmem is
+   in FRAM). The activations are in SRAM (.fann_act), unless the network is
+   too large for fann_act_values and they are in the heap. The output array
+   is in .fann_act with FANN_STATIC, in the heap otherwise. */
+#ifdef ENERGY
+#ifdef FANN_STATIC
+#define fann_act_in_sram(ann) 1
+#define fann_energy_output(n) energy_count(sram_writes, n)
+#else
+#define fann_act_in_sram(ann) ((ann)->values == fann_act_values)
+#define fann_energy_output(n) energy_count(fram_writes, n)
+#endif // FANN_STATIC
+#define fann_energy_weights(n) energy_count(fram_reads, n)
+#define fann_energy_act_read(ann, n) \
+    (fann_act_in_sram(ann) ? energy_count(sram_reads, n) : energy_count(fram_reads, n))
+#define fann_energy_act_write(ann, n) \
+    (fann_act_in_sram(ann) ? energy_count(sram_writes, n) : energy_count(fram_writes, n))
+#else
+#define fann_energy_output(n)
+#define fann_energy_weights(n)
+#define fann_energy_act_read(ann, n)
+#define fann_energy_act_write(ann, n)
+#endif // ENERGY
 
 /* INTERNAL FUNCTION
    Allocates the main structure and sets some default values.
@@ -48,6 +127,8 @@ struct fann *fann_allocate_structure(unsigned int num_layers)
     ann->learning_momentum = 0.0;
     ann->total_neurons = 0;
     ann->total_connections = 0;
+    ann->total_neurons_allocated = 0;
+    ann->total_connections_allocated = 0;
     ann->num_input = 0;
     ann->num_output = 0;
     ann->train_errors = NULL;
@@ -61,12 +142,14 @@ struct fann *fann_allocate_structure(unsigned int num_layers)
     ann->num_bit_fail = 0;
     ann->bit_fail_limit = (fann_type)0.35;
     ann->network_type = FANN_NETTYPE_LAYER;
+    ann->engine = FANN_ENGINE_GENERIC;
     ann->train_error_function = FANN_ERRORFUNC_TANH;
     ann->train_stop_function = FANN_STOPFUNC_MSE;
     ann->callback = NULL;
     ann->user_data = NULL; /* User is responsible for deallocation */
     ann->weights = NULL;
-    ann->connections = NULL;
+    ann->columns = NULL;
+    ann->values = NULL;
     ann->output = NULL;
 #ifndef FIXEDFANN
     ann->scale_mean_in = NULL;
@@ -153,8 +236,10 @@ struct fann *fann_allocate_structure(unsigned int num_layers)
 
     /* these values are only boring defaults, and should really
      * never be used, since the real values are always loaded from a file. */
-    unsigned int decimal_point = 13;
-    unsigned int multiplier = 1 << decimal_point;
+#ifdef FIXEDFANN
+    ann->decimal_point = 13;
+    ann->multiplier = 1 << ann->decimal_point;
+#endif
 
     /* allocate room for the layers */
     ann->first_layer = (struct fann_layer *) calloc(num_layers, sizeof(struct fann_layer));
@@ -176,10 +261,27 @@ FANN_EXTERNAL void FANN_API fann_destroy(struct fann *ann)
 {
     if(ann == NULL)
         return;
-    fann_safe_free(ann->weights);
-    fann_safe_free(ann->connections);
+#ifdef FANN_STATIC
+    /* statically allocated network, see fann_create_from_header */
+    return;
+#else
+    /* weights read in place from the header, see fann_create_msp430 */
+    if (ann->total_connections_allocated) {
+        fann_safe_free(ann->weights);
+        fann_safe_free(ann->columns);
+    }
     fann_safe_free(ann->first_layer->first_neuron);
     fann_safe_free(ann->first_layer);
+#ifdef FANN_LEA
+    if (fann_lea_owner == ann) {
+        fann_lea_owner = NULL;
+    }
+#endif // FANN_LEA
+    if (ann->values == fann_act_values) {
+        fann_act_owner = NULL;
+    } else {
+        fann_safe_free(ann->values);
+    }
     fann_safe_free(ann->output);
     fann_safe_free(ann->train_errors);
     fann_safe_free(ann->train_slopes);
@@ -204,6 +306,7 @@ FANN_EXTERNAL void FANN_API fann_destroy(struct fann *ann)
 #endif
 
     fann_safe_free(ann);
+#endif // FANN_STATIC
 }
 
 /* INTERNAL FUNCTION
@@ -227,10 +330,30 @@ void fann_allocate_neurons(struct fann *ann)
     printf("Allocated %u bytes for neurons.\n", ann->total_neurons * sizeof(struct fann_neuron));
 #endif // DEBUG_MALLOC
 
+    /* the activation values of all the layers are kept in one flat array, in
+       SRAM (.fann_act) when the network fits: the heap (.sysmem) is in FRAM */
+#ifndef FANN_STATIC
+    if (fann_act_owner == NULL && ann->total_neurons <= FANN_ACT_NEURONS) {
+        fann_act_owner = ann;
+        ann->values = memset(fann_act_values, 0, ann->total_neurons * sizeof(fann_type));
+    } else
+#endif // FANN_STATIC
+    {
+        ann->values = (fann_type *) calloc(ann->total_neurons, sizeof(fann_type));
+    }
+    if (ann->values == NULL) {
+        // fann_error((struct fann_error *) ann, FANN_E_CANT_ALLOCATE_MEM);
+        return;
+    }
+#ifdef DEBUG_MALLOC
+    printf("Allocated %u bytes for activation values.\n", ann->total_neurons * sizeof(fann_type));
+#endif // DEBUG_MALLOC
+
     for (layer_it = ann->first_layer; layer_it != ann->last_layer; layer_it++) {
         num_neurons = (unsigned int) (layer_it->last_neuron - layer_it->first_neuron);
         layer_it->first_neuron = neurons + num_neurons_so_far;
         layer_it->last_neuron = layer_it->first_neuron + num_neurons;
+        layer_it->values = ann->values + num_neurons_so_far;
         num_neurons_so_far += num_neurons;
     }
 
@@ -257,145 +380,1759 @@ void fann_allocate_connections(struct fann *ann)
 
     ann->total_connections_allocated = ann->total_connections;
 
-    /* TODO make special cases for all places where the connections
-     * is used, so that it is not needed for fully connected networks.
+    /* The column indices are only needed by sparse networks: fully
+     * connected ones are run reading the values of the previous layer (all
+     * the previous values for shortcut networks) in order. The columns are
+     * left NULL if the network has too many neurons for fann_index_type.
      */
-    ann->connections = (struct fann_neuron **) calloc(
+    if (ann->connection_rate >= 1 || ann->total_neurons - 1 > FANN_INDEX_MAX) {
+        return;
+    }
+
+    ann->columns = (fann_index_type *) calloc(
         ann->total_connections_allocated,
-        sizeof(struct fann_neuron *)
+        sizeof(fann_index_type)
     );
-    if (ann->connections == NULL) {
+    if (ann->columns == NULL) {
         // fann_error((struct fann_error *) ann, FANN_E_CANT_ALLOCATE_MEM);
         return;
     }
 #ifdef DEBUG_MALLOC
-    printf("Allocated %u bytes for connections.\n", 
-            ann->total_connections_allocated * sizeof(struct fann_neuron *));
+    printf("Allocated %u bytes for columns.\n",
+            ann->total_connections_allocated * sizeof(fann_index_type));
 #endif // DEBUG_MALLOC
 }
 
-FANN_EXTERNAL fann_type *FANN_API fann_run(struct fann * ann, fann_type * input)
+/* INTERNAL FUNCTION
+   Selects the inference engine. Networks whose layers use a single
+   activation function and steepness are run by the dense engine when they
+   are layered and fully connected, by the sparse engine when they are
+   sparse, everything else by the generic per-neuron loop. Must be called
+   once the neurons are set up.
+ */
+void fann_select_engine(struct fann *ann)
+{
+    struct fann_layer *layer_it;
+    struct fann_neuron *neuron_it, *last_neuron;
+    unsigned int num_inputs;
+    int dense;
+
+    ann->engine = FANN_ENGINE_GENERIC;
+
+    if (ann->values == NULL) {
+        return;
+    }
+
+    if (ann->connection_rate >= 1) {
+        if (ann->network_type != FANN_NETTYPE_LAYER) {
+            return;
+        }
+        dense = 1;
+    }
+    else {
+        dense = 0;
+    }
+
+    for (layer_it = ann->first_layer + 1; layer_it != ann->last_layer; layer_it++) {
+        neuron_it = layer_it->first_neuron;
+        last_neuron = layer_it->last_neuron;
+        /* the last neuron of each layer is the bias neuron */
+        if (ann->network_type == FANN_NETTYPE_LAYER) {
+            last_neuron--;
+        }
+        num_inputs = (unsigned int) ((layer_it - 1)->last_neuron - (layer_it - 1)->first_neuron);
+
+        layer_it->activation_function = neuron_it->activation_function;
+        layer_it->activation_steepness = neuron_it->activation_steepness;
+
+        for (; neuron_it != last_neuron; neuron_it++) {
+            if (neuron_it->activation_function != layer_it->activation_function ||
+                neuron_it->activation_steepness != layer_it->activation_steepness) {
+                return;
+            }
+            if (dense &&
+                (neuron_it->last_con - neuron_it->first_con != num_inputs ||
+                 (neuron_it != layer_it->first_neuron &&
+                  neuron_it->first_con != (neuron_it - 1)->last_con))) {
+                return;
+            }
+        }
+    }
+
+    ann->engine = dense ? FANN_ENGINE_DENSE : FANN_ENGINE_SPARSE;
+}
+
+/* INTERNAL FUNCTION
+   Breakpoints of a stepwise activation function for the given steepness.
+   In fixed point, the breakpoints of fann_update_stepwise divided by the
+   steepness, so that they apply to sums that are not multiplied by it; in
+   floating point the sums already include the steepness (see
+   fann_update_max_sum) and the breakpoints are used as they are. Returns 0
+   if the activation function is not computed stepwise.
+ */
+static int fann_stepwise_breakpoints(struct fann *ann, unsigned int activation_function,
+                                     fann_type steepness, fann_type *breakpoints)
+{
+    fann_type *values;
+    unsigned int i;
+
+#ifndef FIXEDFANN
+    (void) steepness;
+#endif
+
+    switch (activation_function) {
+#ifdef FIXEDFANN
+    case FANN_SIGMOID:
+#endif
+    case FANN_SIGMOID_STEPWISE:
+        values = ann->sigmoid_values;
+        break;
+#ifdef FIXEDFANN
+    case FANN_SIGMOID_SYMMETRIC:
+#endif
+    case FANN_SIGMOID_SYMMETRIC_STEPWISE:
+        values = ann->sigmoid_symmetric_values;
+        break;
+#ifdef FIXEDFANN
+    case FANN_GAUSSIAN:
+#endif
+    case FANN_GAUSSIAN_STEPWISE:
+        values = ann->gaussian_values;
+        break;
+    default:
+        return 0;
+    }
+
+    for (i = 0; i < 6; i++) {
+#ifdef FANN_Q15
+        int32_t sum = ((int32_t) values[i] << FANN_Q15_SUM_DECIMAL_POINT) / steepness;
+
+        breakpoints[i] = (fann_type) fann_clip(sum, (int32_t) INT16_MIN, (int32_t) INT16_MAX);
+#elif defined(FIXEDFANN)
+        breakpoints[i] = values[i] / steepness;
+#else
+        breakpoints[i] = values[i];
+#endif
+    }
+    return 1;
+}
+
+/* INTERNAL FUNCTION
+   Calculates the parameters of the stepwise linear sigmoid and gaussian
+   functions. The sigmoid results are 0.005, 0.05, 0.25, 0.75, 0.95 and 0.995
+   (and their symmetric counterparts), the gaussian ones 1, 0.95, 0.75, 0.25,
+   0.05 and 0.005, the values are the sums producing them. In fixed point
+   the values are multiplied twice by the multiplier so that dividing them by
+   a fixed point steepness yields a fixed point breakpoint; with FANN_Q15
+   they are Q7.8 sums, divided by the Q7.8 steepness.
+   The breakpoints of every layer are then computed once and for all (not
+   with the generic engine, whose layers may mix activation functions), see
+   fann_stepwise_breakpoints.
+ */
+void fann_update_stepwise(struct fann *ann)
+{
+    struct fann_layer *layer_it;
+    unsigned int i;
+#ifdef FIXEDFANN
+    fann_type multiplier = (fann_type) ann->multiplier;
+
+    ann->sigmoid_results[0] = fann_max((fann_type) (multiplier / 200.0 + 0.5), 1);
+    ann->sigmoid_results[1] = fann_max((fann_type) (multiplier / 20.0 + 0.5), 1);
+    ann->sigmoid_results[2] = fann_max((fann_type) (multiplier / 4.0 + 0.5), 1);
+    ann->sigmoid_results[3] = fann_min(multiplier - (fann_type) (multiplier / 4.0 + 0.5), multiplier - 1);
+    ann->sigmoid_results[4] = fann_min(multiplier - (fann_type) (multiplier / 20.0 + 0.5), multiplier - 1);
+    ann->sigmoid_results[5] = fann_min(multiplier - (fann_type) (multiplier / 200.0 + 0.5), multiplier - 1);
+
+    ann->sigmoid_symmetric_results[0] = fann_max((fann_type) ((multiplier / 100.0) - multiplier - 0.5), (fann_type) (1 - multiplier));
+    ann->sigmoid_symmetric_results[1] = fann_max((fann_type) ((multiplier / 10.0) - multiplier - 0.5), (fann_type) (1 - multiplier));
+    ann->sigmoid_symmetric_results[2] = fann_max((fann_type) ((multiplier / 2.0) - multiplier - 0.5), (fann_type) (1 - multiplier));
+    ann->sigmoid_symmetric_results[3] = fann_min(multiplier - (fann_type) (multiplier / 2.0 + 0.5), multiplier - 1);
+    ann->sigmoid_symmetric_results[4] = fann_min(multiplier - (fann_type) (multiplier / 10.0 + 0.5), multiplier - 1);
+    ann->sigmoid_symmetric_results[5] = fann_min(multiplier - (fann_type) (multiplier / 100.0 + 1.0), multiplier - 1);
+
+    ann->gaussian_results[0] = multiplier;
+    ann->gaussian_results[1] = fann_min(multiplier - (fann_type) (multiplier / 20.0 + 0.5), multiplier - 1);
+    ann->gaussian_results[2] = fann_min(multiplier - (fann_type) (multiplier / 4.0 + 0.5), multiplier - 1);
+    ann->gaussian_results[3] = fann_max((fann_type) (multiplier / 4.0 + 0.5), 1);
+    ann->gaussian_results[4] = fann_max((fann_type) (multiplier / 20.0 + 0.5), 1);
+    ann->gaussian_results[5] = fann_max((fann_type) (multiplier / 200.0 + 0.5), 1);
+
+    for (i = 0; i < 6; i++) {
+#ifdef FANN_Q15
+        ann->sigmoid_values[i] = (fann_type) ((log(multiplier / (float) ann->sigmoid_results[i] - 1) *
+                                               (float) (1 << FANN_Q15_SUM_DECIMAL_POINT)) / -2.0);
+        ann->sigmoid_symmetric_values[i] = (fann_type) ((log((multiplier - (float) ann->sigmoid_symmetric_results[i]) /
+                                                             ((float) ann->sigmoid_symmetric_results[i] + multiplier)) *
+                                                         (float) (1 << FANN_Q15_SUM_DECIMAL_POINT)) / -2.0);
+        ann->gaussian_values[i] = (fann_type) (sqrt(-log((float) ann->gaussian_results[i] / multiplier)) *
+                                               (float) (1 << FANN_Q15_SUM_DECIMAL_POINT));
+#else
+        ann->sigmoid_values[i] = (fann_type) (((log(multiplier / (float) ann->sigmoid_results[i] - 1) *
+                                                (float) multiplier) / -2.0) * (float) multiplier);
+        ann->sigmoid_symmetric_values[i] = (fann_type) (((log((multiplier - (float) ann->sigmoid_symmetric_results[i]) /
+                                                              ((float) ann->sigmoid_symmetric_results[i] + multiplier)) *
+                                                          (float) multiplier) / -2.0) * (float) multiplier);
+        ann->gaussian_values[i] = (fann_type) ((sqrt(-log((float) ann->gaussian_results[i] / multiplier)) *
+                                                (float) multiplier) * (float) multiplier);
+#endif // FANN_Q15
+    }
+#else
+    static const fann_type results[6] = {0.005f, 0.05f, 0.25f, 0.75f, 0.95f, 0.995f};
+
+    for (i = 0; i < 6; i++) {
+        ann->sigmoid_results[i] = results[i];
+        ann->sigmoid_values[i] = (fann_type) (log(1.0 / results[i] - 1) / -2.0);
+        ann->sigmoid_symmetric_results[i] = results[i] * 2 - 1;
+        ann->sigmoid_symmetric_values[i] = ann->sigmoid_values[i];
+        ann->gaussian_results[i] = (i == 0) ? 1 : results[5 - i];
+        ann->gaussian_values[i] = (fann_type) sqrt(-log(ann->gaussian_results[i]));
+    }
+#endif // FIXEDFANN
+
+    if (ann->engine == FANN_ENGINE_GENERIC) {
+        return;
+    }
+    for (layer_it = ann->first_layer + 1; layer_it != ann->last_layer; layer_it++) {
+        fann_stepwise_breakpoints(ann, layer_it->activation_function,
+                                  layer_it->activation_steepness, layer_it->stepwise_values);
+    }
+}
+
+#ifndef FIXEDFANN
+/* INTERNAL FUNCTION
+   Stores the bound of the sums of each layer (150 divided by the steepness)
+   for the dense and sparse engines. In floating point the steepness of every
+   neuron is folded into its weights by database/convert (and gen-infer
+   --static), so that the sums computed by fann_run already include it: this
+   saves a multiplication per neuron and a division per layer on every run,
+   and the weights can be read in place. Floating point only (in fixed point
+   the steepness is applied to the breakpoints of the stepwise functions
+   instead).
+ */
+void fann_update_max_sum(struct fann *ann)
+{
+    struct fann_layer *layer_it;
+
+    if (ann->engine == FANN_ENGINE_GENERIC) {
+        return;
+    }
+    for (layer_it = ann->first_layer + 1; layer_it != ann->last_layer; layer_it++) {
+        layer_it->max_sum = 150/layer_it->activation_steepness;
+    }
+}
+#endif // FIXEDFANN
+
+#ifdef FIXEDFANN
+#ifdef FANN_Q15
+/* INTERNAL FUNCTION
+   Dot product of a row of weights and the Q15 activations of the previous
+   layer, accumulated in 32 bits. On the MSP430 the signed multiply-accumulate
+   of the MPY32 peripheral is used, interrupts are disabled meanwhile since
+   the result registers are shared.
+ */
+static int32_t fann_dot_q15(const fann_type *weights, const fann_type *inputs,
+                            unsigned int num_inputs)
+{
+    unsigned int i;
+#ifdef __MSP430_HAS_MPY32__
+    unsigned short interrupt_state = __get_interrupt_state();
+    int32_t sum;
+
+    __disable_interrupt();
+    MPY32CTL0 &= ~(MPYSAT | MPYFRAC);
+    RESLO = 0;
+    RESHI = 0;
+    for (i = 0; i != num_inputs; i++) {
+        MACS = weights[i];
+        OP2 = inputs[i];
+    }
+    sum = ((int32_t) RESHI << 16) | RESLO;
+    __set_interrupt_state(interrupt_state);
+
+    return sum;
+#else
+    int32_t sum = 0;
+
+    for (i = 0; i != num_inputs; i++) {
+        sum += (int32_t) weights[i] * inputs[i];
+    }
+
+    return sum;
+#endif // __MSP430_HAS_MPY32__
+}
+
+/* INTERNAL FUNCTION
+   Same as fann_dot_q15 for a sparse row: the activations are gathered from
+   the flat activation buffer through the column indices. The loop is
+   unrolled by 4, its overhead would otherwise add up to the cost of the
+   gather and make a pruned row slower than a dense one.
+ */
+static int32_t fann_dot_sparse_q15(const fann_type *weights, const fann_index_type *columns,
+                                   const fann_type *values, unsigned int num_connections)
+{
+    unsigned int i;
+#ifdef __MSP430_HAS_MPY32__
+    unsigned short interrupt_state = __get_interrupt_state();
+    int32_t sum;
+
+    __disable_interrupt();
+    MPY32CTL0 &= ~(MPYSAT | MPYFRAC);
+    RESLO = 0;
+    RESHI = 0;
+    for (i = num_connections & 3; i-- > 0; ) {
+        MACS = weights[i];
+        OP2 = values[columns[i]];
+    }
+    for (i = num_connections & 3; i != num_connections; i += 4) {
+        MACS = weights[i];
+        OP2 = values[columns[i]];
+        MACS = weights[i + 1];
+        OP2 = values[columns[i + 1]];
+        MACS = weights[i + 2];
+        OP2 = values[columns[i + 2]];
+        MACS = weights[i + 3];
+        OP2 = values[columns[i + 3]];
+    }
+    sum = ((int32_t) RESHI << 16) | RESLO;
+    __set_interrupt_state(interrupt_state);
+
+    return sum;
+#else
+    int32_t sum = 0;
+
+    for (i = num_connections & 3; i-- > 0; ) {
+        sum += (int32_t) weights[i] * values[columns[i]];
+    }
+    for (i = num_connections & 3; i != num_connections; i += 4) {
+        sum += (int32_t) weights[i] * values[columns[i]] +
+               (int32_t) weights[i + 1] * values[columns[i + 1]] +
+               (int32_t) weights[i + 2] * values[columns[i + 2]] +
+               (int32_t) weights[i + 3] * values[columns[i + 3]];
+    }
+
+    return sum;
+#endif // __MSP430_HAS_MPY32__
+}
+
+#ifdef FANN_LEA
+/* INTERNAL FUNCTION
+   Copies the weights of the dense layers of ann to LEA RAM. The block of a
+   layer of n neurons and k inputs, bias included, holds the n x k weight
+   matrix, its rows padded to the even length of the LEA commands, the input
+   vector as a k x 2 matrix whose second column is zero (the columns of a
+   product are even too), and the n x 2 result. A layer is left to the CPU
+   when its block does not fit in FANN_LEA_WORDS or when one of its sums
+   may reach 2^30, which the Q15 result of the LEA cannot hold: database/
+   float-to-fixed only bounds the sums to 2^31, so a neuron whose absolute
+   weights add up to 2^15 or more (times activations of at most 2^15) is
+   run by fann_dot_q15.
+ */
+static void fann_lea_stage(struct fann *ann)
+{
+    struct fann_layer *layer_it;
+    const fann_type *weights;
+    unsigned int l, i, j, num_inputs, num_neurons, length, size, used = 0;
+    uint32_t magnitude;
+    _q15 *block;
+
+    fann_lea_owner = ann;
+    for (l = 0; l != FANN_LEA_LAYERS; l++) {
+        fann_lea_layers[l] = NULL;
+    }
+
+    for (layer_it = ann->first_layer + 1, l = 0;
+         layer_it != ann->last_layer && l != FANN_LEA_LAYERS; layer_it++, l++) {
+        num_inputs = (unsigned int) ((layer_it - 1)->last_neuron - (layer_it - 1)->first_neuron);
+        num_neurons = (unsigned int) (layer_it->last_neuron - layer_it->first_neuron) - 1;
+        length = (num_inputs + 1) & ~1u;
+        size = num_neurons * length + 2 * length + 2 * num_neurons;
+        if (used + size > FANN_LEA_WORDS) {
+            continue;
+        }
+
+        weights = ann->weights + layer_it->first_neuron->first_con;
+        for (i = 0; i != num_neurons; i++) {
+            magnitude = 0;
+            for (j = 0; j != num_inputs; j++) {
+                magnitude += (uint32_t) fann_abs((int32_t) weights[i * num_inputs + j]);
+            }
+            if (magnitude >= 32768) {
+                break;
+            }
+        }
+        if (i != num_neurons) {
+            continue;
+        }
+
+        block = fann_lea_ram + used;
+        for (i = 0; i != num_neurons; i++, weights += num_inputs) {
+            for (j = 0; j != num_inputs; j++) {
+                block[i * length + j] = weights[j];
+            }
+            if (length != num_inputs) {
+                block[i * length + num_inputs] = 0;
+            }
+        }
+        for (j = num_neurons * length; j != num_neurons * length + 2 * length; j++) {
+            block[j] = 0;
+        }
+        fann_lea_layers[l] = block;
+        used += size;
+
+        /* weights once, matrix and input vector */
+        energy_count(fram_reads, 2 * num_neurons * num_inputs);
+        energy_count(sram_writes, num_neurons * length + 2 * length);
+    }
+}
+
+/* INTERNAL FUNCTION
+   Sums of the neurons first to end (excluded) of a dense layer on the LEA:
+   the activations of the previous layer, bias included, are copied to the
+   input vector of the block of the layer and the sums are one
+   msp_matrix_mpy_q15 of the rows first to end by it. The Q15 result is the
+   32-bit sum of fann_dot_q15 shifted right by 15, i.e. with the
+   weight_decimal_point fractional bits of the weights, made a Q7.8 sum:
+   with 8 or more, this is the sum of fann_q15_sum; with fewer (the first
+   layer of thyroid has 5), the last 8 - weight_decimal_point fractional
+   bits of the sum are zero. Returns 0 when the CPU runs the layer, see
+   fann_lea_stage.
+ */
+static int fann_run_lea(struct fann *ann, struct fann_layer *layer_it,
+                        const fann_type *inputs, unsigned int num_inputs,
+                        unsigned int first, unsigned int end)
+{
+    msp_matrix_mpy_q15_params params;
+    unsigned int l = (unsigned int) (layer_it - ann->first_layer) - 1;
+    unsigned int num_neurons = (unsigned int) (layer_it->last_neuron - layer_it->first_neuron) - 1;
+    unsigned int length = (num_inputs + 1) & ~1u;
+    unsigned int i, shift = layer_it->weight_decimal_point;
+    _q15 *matrix, *vector, *result;
+    int32_t sum;
+
+    if (fann_lea_owner != ann) {
+        fann_lea_stage(ann);
+    }
+    if (l >= FANN_LEA_LAYERS || fann_lea_layers[l] == NULL) {
+        return 0;
+    }
+    matrix = fann_lea_layers[l];
+    vector = matrix + num_neurons * length;
+    result = vector + 2 * length;
+
+    for (i = 0; i != num_inputs; i++) {
+        vector[2 * i] = inputs[i];
+    }
+
+    params.srcARows = end - first;
+    params.srcACols = length;
+    params.srcBRows = length;
+    params.srcBCols = 2;
+    msp_matrix_mpy_q15(&params, matrix + first * length, vector, result);
+
+    for (i = first; i != end; i++, result += 2) {
+        if (shift >= FANN_Q15_SUM_DECIMAL_POINT) {
+            layer_it->values[i] = (fann_type) (*result >> (shift - FANN_Q15_SUM_DECIMAL_POINT));
+        }
+        else {
+            sum = (int32_t) *result << (FANN_Q15_SUM_DECIMAL_POINT - shift);
+            layer_it->values[i] = (fann_type) fann_clip(sum, (int32_t) INT16_MIN, (int32_t) INT16_MAX);
+        }
+    }
+
+    return 1;
+}
+#endif // FANN_LEA
+
+/* INTERNAL FUNCTION
+   Stepwise linear function on a Q7.8 sum, with 32-bit intermediates (int is
+   16 bits on the MSP430).
+ */
+static fann_type fann_stepwise_q15(const fann_type *v, const fann_type *r,
+                                   fann_type min, fann_type max, fann_type sum)
+{
+    unsigned int i;
+
+    if (sum < v[0])
+        return min;
+    if (sum >= v[5])
+        return max;
+
+    for (i = 1; sum >= v[i]; i++);
+
+    return (fann_type) (r[i - 1] + ((int32_t) (r[i] - r[i - 1]) * ((int32_t) sum - v[i - 1])) /
+                                   ((int32_t) v[i] - v[i - 1]));
+}
+
+/* INTERNAL FUNCTION
+   Applies the activation function of a whole layer to its Q7.8 sums, in
+   place, producing Q15 activations. As in the long fixed point mode the
+   breakpoints of the stepwise functions, v, are already divided by the
+   steepness (see fann_stepwise_breakpoints).
+ */
+static void fann_activate_layer(struct fann *ann, unsigned int activation_function,
+                                fann_type steepness, const fann_type *v,
+                                fann_type *values, unsigned int num_neurons)
+{
+    fann_type multiplier = (fann_type) ann->multiplier;
+    fann_type *value_it;
+    fann_type *last_value = values + num_neurons;
+    fann_type *results;
+    fann_type min;
+    int32_t sum;
+
+    switch (activation_function) {
+    case FANN_SIGMOID:
+    case FANN_SIGMOID_STEPWISE:
+    case FANN_SIGMOID_SYMMETRIC:
+    case FANN_SIGMOID_SYMMETRIC_STEPWISE:
+        if (activation_function == FANN_SIGMOID || activation_function == FANN_SIGMOID_STEPWISE) {
+            results = ann->sigmoid_results;
+            min = 0;
+        }
+        else {
+            results = ann->sigmoid_symmetric_results;
+            min = -multiplier;
+        }
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = fann_stepwise_q15(v, results, min, multiplier, *value_it);
+        }
+        break;
+    case FANN_GAUSSIAN:
+    case FANN_GAUSSIAN_STEPWISE:
+        for (value_it = values; value_it != last_value; value_it++) {
+            sum = fann_min(fann_abs((int32_t) *value_it), (int32_t) INT16_MAX);
+            *value_it = fann_stepwise_q15(v, ann->gaussian_results, multiplier, 0, (fann_type) sum);
+        }
+        break;
+    case FANN_THRESHOLD:
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = (*value_it < 0) ? 0 : multiplier;
+        }
+        break;
+    case FANN_THRESHOLD_SYMMETRIC:
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = (*value_it < 0) ? -multiplier : multiplier;
+        }
+        break;
+    case FANN_LINEAR:
+    case FANN_LINEAR_PIECE:
+    case FANN_LINEAR_PIECE_SYMMETRIC:
+        min = (activation_function == FANN_LINEAR_PIECE) ? 0 : -multiplier;
+        for (value_it = values; value_it != last_value; value_it++) {
+            /* Q7.8 * Q7.8 = Q14.16 */
+            sum = ((int32_t) steepness * *value_it) >> (2 * FANN_Q15_SUM_DECIMAL_POINT - 15);
+            *value_it = (fann_type) fann_clip(sum, (int32_t) min, (int32_t) multiplier);
+        }
+        break;
+    default:
+        /* the remaining functions need floating points */
+        // fann_error((struct fann_error *) ann, FANN_E_CANT_USE_ACTIVATION);
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = 0;
+        }
+        break;
+    }
+}
+#else
+
+/* INTERNAL FUNCTION
+   Applies the activation function of a whole layer to its sums, in place.
+   In fixed point the sums are not multiplied by the steepness: the
+   breakpoints of the stepwise functions, v, are divided by it instead (see
+   fann_stepwise_breakpoints). Only integer operations are used.
+ */
+static void fann_activate_layer(struct fann *ann, unsigned int activation_function,
+                                fann_type steepness, const fann_type *v,
+                                fann_type *values, unsigned int num_neurons)
+{
+    unsigned int decimal_point = ann->decimal_point;
+    fann_type multiplier = (fann_type) ann->multiplier;
+    fann_type *value_it;
+    fann_type *last_value = values + num_neurons;
+    fann_type *results;
+    fann_type min, sum;
+
+    switch (activation_function) {
+    case FANN_SIGMOID:
+    case FANN_SIGMOID_STEPWISE:
+    case FANN_SIGMOID_SYMMETRIC:
+    case FANN_SIGMOID_SYMMETRIC_STEPWISE:
+        if (activation_function == FANN_SIGMOID || activation_function == FANN_SIGMOID_STEPWISE) {
+            results = ann->sigmoid_results;
+            min = 0;
+        }
+        else {
+            results = ann->sigmoid_symmetric_results;
+            min = -multiplier;
+        }
+        for (value_it = values; value_it != last_value; value_it++) {
+            sum = *value_it;
+            *value_it = (fann_type) fann_stepwise(v[0], v[1], v[2], v[3], v[4], v[5],
+                                                  results[0], results[1], results[2],
+                                                  results[3], results[4], results[5],
+                                                  min, multiplier, sum);
+        }
+        break;
+    case FANN_GAUSSIAN:
+    case FANN_GAUSSIAN_STEPWISE:
+        results = ann->gaussian_results;
+        for (value_it = values; value_it != last_value; value_it++) {
+            sum = fann_abs(*value_it);
+            *value_it = (fann_type) fann_stepwise(v[0], v[1], v[2], v[3], v[4], v[5],
+                                                  results[0], results[1], results[2],
+                                                  results[3], results[4], results[5],
+                                                  multiplier, 0, sum);
+        }
+        break;
+    case FANN_THRESHOLD:
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = (*value_it < 0) ? 0 : multiplier;
+        }
+        break;
+    case FANN_THRESHOLD_SYMMETRIC:
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = (*value_it < 0) ? -multiplier : multiplier;
+        }
+        break;
+    case FANN_LINEAR:
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = fann_mult(steepness, *value_it);
+        }
+        break;
+    case FANN_LINEAR_PIECE:
+        for (value_it = values; value_it != last_value; value_it++) {
+            sum = fann_mult(steepness, *value_it);
+            *value_it = fann_clip(sum, 0, multiplier);
+        }
+        break;
+    case FANN_LINEAR_PIECE_SYMMETRIC:
+        for (value_it = values; value_it != last_value; value_it++) {
+            sum = fann_mult(steepness, *value_it);
+            *value_it = fann_clip(sum, -multiplier, multiplier);
+        }
+        break;
+    default:
+        /* the remaining functions need floating points */
+        // fann_error((struct fann_error *) ann, FANN_E_CANT_USE_ACTIVATION);
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = 0;
+        }
+        break;
+    }
+}
+#endif // FANN_Q15
+#else
+#ifdef FANN_ACTIVATION_LUT
+#include "fann_activation_lut.h"
+
+/* INTERNAL FUNCTION
+   Linear interpolation in a table of FANN_LUT_SIZE + 1 samples, position is
+   the (non-negative) index in the table. Beyond the table the last sample is
+   returned.
+ */
+static fann_type fann_lut(const fann_type *table, fann_type position)
+{
+    unsigned int i;
+
+    if (position >= FANN_LUT_SIZE) {
+        return table[FANN_LUT_SIZE];
+    }
+    i = (unsigned int) position;
+    return table[i] + (position - i) * (table[i + 1] - table[i]);
+}
+
+fann_type fann_lut_sigmoid(fann_type sum)
+{
+    if (sum < 0) {
+        return 1.0f - fann_lut(fann_lut_sigmoid_table, -sum * (FANN_LUT_SIZE / FANN_LUT_SIGMOID_RANGE));
+    }
+    return fann_lut(fann_lut_sigmoid_table, sum * (FANN_LUT_SIZE / FANN_LUT_SIGMOID_RANGE));
+}
+
+fann_type fann_lut_gaussian(fann_type sum)
+{
+    return fann_lut(fann_lut_gaussian_table, fann_abs(sum) * (FANN_LUT_SIZE / FANN_LUT_GAUSSIAN_RANGE));
+}
+
+/* sin(2 * pi * turns) */
+fann_type fann_lut_sin(fann_type turns)
+{
+    long whole = (long) turns;
+
+    /* keep the fractional part of the period, in [0, 1) */
+    turns -= whole;
+    if (turns < 0) {
+        turns += 1.0f;
+    }
+    return fann_lut(fann_lut_sin_table, turns * FANN_LUT_SIZE);
+}
+#endif // FANN_ACTIVATION_LUT
+
+/* INTERNAL FUNCTION
+   Applies the activation function of a whole layer to its sums, in place.
+   The switch is resolved once per layer instead of once per neuron. The
+   sums already include the steepness (see fann_update_max_sum), v holds the
+   breakpoints of the stepwise functions.
+ */
+static void fann_activate_layer(struct fann *ann, unsigned int activation_function,
+                                fann_type steepness, const fann_type *v,
+                                fann_type *values, unsigned int num_neurons)
+{
+    fann_type *value_it;
+    fann_type *last_value = values + num_neurons;
+    fann_type *results;
+    fann_type min, sum;
+
+    (void) steepness;
+
+    switch (activation_function) {
+    case FANN_LINEAR:
+        break;
+    case FANN_SIGMOID:
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = (fann_type) fann_sigmoid_real(*value_it);
+        }
+        break;
+    case FANN_SIGMOID_SYMMETRIC:
+        for (value_it = values; value_it != last_value; value_it++) {
+            *value_it = (fann_type) fann_sigmoid_symmetric_real(*value_it);
+        }
+        break;
+    case FANN_SIGMOID_STEPWISE:
+    case FANN_SIGMOID_SYMMETRIC_STEPWISE:
+        if (activation_function == FANN_SIGMOID_STEPWISE) {
+            results = ann->sigmoid_results;
+            min = 0;
+        }
+        else {
+            results = ann->sigmoid_symmetric_results;
+            min = -1;
+        }
+        for (value_it = values; value_it != last_value; value_it++) {
+            sum = *value_it;
+            *value_it = (fann_type) fann_stepwise(v[0], v[1], v[2], v[3], v[4], v[5],
+                                                  results[0], results[1], results[2],
+                                                  results[3], results[4], results[5],
+                                                  min, 1, sum);
+        }
+        break;
+    case FANN_GAUSSIAN_STEPWISE:
+        results = ann->gaussian_results;
+        for (value_it = values; value_it != last_value; value_it++) {
+            sum = fann_abs(*value_it);
+            *value_it = (fann_type) fann_stepwise(v[0], v[1], v[2], v[3], v[4], v[5],
+                                                  results[0], results[1], results[2],
+                                                  results[3], results[4], results[5],
+                                                  1, 0, sum);
+        }
+        break;
+    default:
+        for (value_it = values; value_it != last_value; value_it++) {
+            fann_activation_switch(activation_function, *value_it, *value_it);
+        }
+        break;
+    }
+}
+#endif // FIXEDFANN
+
+/* INTERNAL FUNCTION
+   Dense engine: every layer is a contiguous (num_neurons x num_inputs)
+   weight matrix multiplied by the activation vector of the previous layer.
+   Runs the neurons first to last (excluded) of the layer, bias included.
+ */
+static void fann_run_dense_layer(struct fann *ann, struct fann_layer *layer_it,
+                                 unsigned int first, unsigned int last)
+{
+    unsigned int i, end, num_inputs, num_neurons;
+    fann_type *weights, *inputs, *values;
+    fann_type steepness;
+#ifndef FANN_Q15
+    fann_type neuron_sum;
+#endif
+#ifdef FIXEDFANN
+#ifndef FANN_Q15
+    unsigned int decimal_point = ann->decimal_point;
+#endif
+    fann_type multiplier = (fann_type) ann->multiplier;
+#else
+    fann_type max_sum;
+    fann_type multiplier = 1;
+#endif
+
+    inputs = (layer_it - 1)->values;
+    num_inputs = (unsigned int) ((layer_it - 1)->last_neuron - (layer_it - 1)->first_neuron);
+    num_neurons = (unsigned int) (layer_it->last_neuron - layer_it->first_neuron) - 1;
+    end = fann_min(last, num_neurons);
+    weights = ann->weights + layer_it->first_neuron->first_con + first * num_inputs;
+    values = layer_it->values;
+
+    steepness = layer_it->activation_steepness;
+#ifndef FIXEDFANN
+    /* the weights include the steepness, see fann_update_max_sum */
+    max_sum = layer_it->max_sum;
+#endif
+
+    fann_profile_enter(&fann_profile_dot);
+    i = first;
+#ifdef FANN_LEA
+    if (i < end && fann_run_lea(ann, layer_it, inputs, num_inputs, first, end)) {
+        /* weights in LEA RAM, inputs copied to it, results */
+        energy_count(sram_reads, (end - first) * num_inputs + num_inputs + (end - first));
+        energy_count(sram_writes, num_inputs);
+        i = end;
+    }
+#endif // FANN_LEA
+    for (; i < end; i++, weights += num_inputs) {
+        fann_energy_weights(num_inputs);
+#ifdef FANN_Q15
+        values[i] = fann_q15_sum(fann_dot_q15(weights, inputs, num_inputs),
+                                 layer_it->weight_decimal_point);
+#else
+        unsigned int j = num_inputs & 3;    /* same as modulo 4 */
+
+        neuron_sum = 0;
+        switch (j) {
+        case 3:
+            neuron_sum += fann_mult(weights[2], inputs[2]);
+            /* fall through */
+        case 2:
+            neuron_sum += fann_mult(weights[1], inputs[1]);
+            /* fall through */
+        case 1:
+            neuron_sum += fann_mult(weights[0], inputs[0]);
+        case 0:
+            break;
+        }
+
+        for (; j != num_inputs; j += 4) {
+            neuron_sum +=
+                fann_mult(weights[j], inputs[j]) +
+                fann_mult(weights[j + 1], inputs[j + 1]) +
+                fann_mult(weights[j + 2], inputs[j + 2]) +
+                fann_mult(weights[j + 3], inputs[j + 3]);
+        }
+
+#ifndef FIXEDFANN
+        if (neuron_sum > max_sum)
+            neuron_sum = max_sum;
+        else if (neuron_sum < -max_sum)
+            neuron_sum = -max_sum;
+#endif
+
+        values[i] = neuron_sum;
+#endif // FANN_Q15
+    }
+    fann_profile_leave(&fann_profile_dot);
+
+    if (end > first) {
+        fann_profile_enter(&fann_profile_activation);
+        fann_activate_layer(ann, layer_it->activation_function, steepness,
+                            layer_it->stepwise_values, values + first, end - first);
+        fann_profile_leave(&fann_profile_activation);
+
+        /* inputs, sums, activations in place */
+        fann_energy_act_read(ann, (end - first) * num_inputs + (end - first));
+        fann_energy_act_write(ann, 2 * (end - first));
+        energy_count(multiplies, (end - first) * num_inputs);
+        energy_count(activations, end - first);
+    }
+
+    /* bias neuron */
+    if (last > num_neurons) {
+        values[num_neurons] = multiplier;
+        fann_energy_act_write(ann, 1);
+    }
+}
+
+/* INTERNAL FUNCTION
+   Sparse engine: the weights of each neuron are contiguous (CSR rows delimited
+   by first_con/last_con) and the matching activations are read from the flat
+   activation buffer through the column indices, so the cost is proportional
+   to the number of connections that survived pruning. Runs the neurons first
+   to last (excluded) of the layer.
+ */
+static void fann_run_sparse_layer(struct fann *ann, struct fann_layer *layer_it,
+                                  unsigned int first, unsigned int last)
+{
+    struct fann_neuron *neuron_it;
+    unsigned int i, end, num_connections, num_neurons;
+    fann_type *weights, *values, *layer_values;
+    fann_index_type *columns;
+    fann_type steepness;
+#ifndef FANN_Q15
+    unsigned int j;
+    fann_sum_type neuron_sum;
+#endif
+#ifdef FIXEDFANN
+#ifndef FANN_Q15
+    unsigned int decimal_point = ann->decimal_point;
+#endif
+    fann_type multiplier = (fann_type) ann->multiplier;
+#else
+    fann_type max_sum;
+    fann_type multiplier = 1;
+#endif
+
+    values = ann->values;
+    num_neurons = (unsigned int) (layer_it->last_neuron - layer_it->first_neuron);
+    if (ann->network_type == FANN_NETTYPE_LAYER) {
+        /* bias neuron */
+        num_neurons--;
+    }
+    end = fann_min(last, num_neurons);
+    layer_values = layer_it->values;
+
+    steepness = layer_it->activation_steepness;
+#ifndef FIXEDFANN
+    /* the weights include the steepness, see fann_update_max_sum */
+    max_sum = layer_it->max_sum;
+#endif
+
+    fann_profile_enter(&fann_profile_dot);
+    neuron_it = layer_it->first_neuron + first;
+    for (i = first; i < end; i++, neuron_it++) {
+        weights = ann->weights + neuron_it->first_con;
+        columns = ann->columns + neuron_it->first_con;
+        num_connections = neuron_it->last_con - neuron_it->first_con;
+
+        /* weights and columns, inputs, sum */
+        fann_energy_weights(2 * num_connections);
+        fann_energy_act_read(ann, num_connections);
+        fann_energy_act_write(ann, 1);
+        energy_count(multiplies, num_connections);
+
+#ifdef FANN_Q15
+        layer_values[i] = fann_q15_sum(fann_dot_sparse_q15(weights, columns, values, num_connections),
+                                       layer_it->weight_decimal_point);
+#else
+        /* unrolled by 4, see fann_dot_sparse_q15 */
+        neuron_sum = 0;
+        j = num_connections & 3;    /* same as modulo 4 */
+        switch (j) {
+        case 3:
+            neuron_sum += fann_mult(weights[2], values[columns[2]]);
+            /* fall through */
+        case 2:
+            neuron_sum += fann_mult(weights[1], values[columns[1]]);
+            /* fall through */
+        case 1:
+            neuron_sum += fann_mult(weights[0], values[columns[0]]);
+        case 0:
+            break;
+        }
+
+        for (; j != num_connections; j += 4) {
+            neuron_sum +=
+                fann_mult(weights[j], values[columns[j]]) +
+                fann_mult(weights[j + 1], values[columns[j + 1]]) +
+                fann_mult(weights[j + 2], values[columns[j + 2]]) +
+                fann_mult(weights[j + 3], values[columns[j + 3]]);
+        }
+
+#ifndef FIXEDFANN
+        if (neuron_sum > max_sum)
+            neuron_sum = max_sum;
+        else if (neuron_sum < -max_sum)
+            neuron_sum = -max_sum;
+#endif
+
+        layer_values[i] = neuron_sum;
+#endif // FANN_Q15
+    }
+    fann_profile_leave(&fann_profile_dot);
+
+    if (end > first) {
+        fann_profile_enter(&fann_profile_activation);
+        fann_activate_layer(ann, layer_it->activation_function, steepness,
+                            layer_it->stepwise_values, layer_values + first, end - first);
+        fann_profile_leave(&fann_profile_activation);
+
+        /* activations in place */
+        fann_energy_act_read(ann, end - first);
+        fann_energy_act_write(ann, end - first);
+        energy_count(activations, end - first);
+    }
+
+    if (ann->network_type == FANN_NETTYPE_LAYER && last > num_neurons) {
+        layer_values[num_neurons] = multiplier;
+        fann_energy_act_write(ann, 1);
+    }
+}
+
+/* INTERNAL FUNCTION
+   Generic engine: neuron by neuron, each with its own activation function
+   and steepness, for the networks fann_select_engine cannot hand to the
+   dense or sparse engine. Runs the neurons first to last (excluded) of the
+   layer.
+ */
+static void fann_run_generic_layer(struct fann *ann, struct fann_layer *layer_it,
+                                   unsigned int first, unsigned int last)
 {
-    struct fann_neuron *neuron_it, *last_neuron, *neurons, **neuron_pointers;
-    unsigned int i, num_connections, num_input, num_output;
-    fann_type neuron_sum, *output;
-    fann_type *weights;
-    struct fann_layer *layer_it, *last_layer;
+    struct fann_neuron *neuron_it, *last_neuron;
+    unsigned int i, num_connections;
+    fann_sum_type neuron_sum;
+    fann_type *weights, *inputs, *layer_values;
+    fann_index_type *columns;
     unsigned int activation_function;
     fann_type steepness;
 
     /* store some variabels local for fast access */
-    struct fann_neuron *first_neuron = ann->first_layer->first_neuron;
+    fann_type *values = ann->values;
 
+#ifdef FIXEDFANN
+#ifndef FANN_Q15
+    unsigned int decimal_point = ann->decimal_point;
+#endif
+    fann_type multiplier = (fann_type) ann->multiplier;
+    fann_type breakpoints[6];
+#else
     fann_type max_sum = 0;
+    fann_type last_steepness = 0;
+    fann_type multiplier = 1;
+#endif
 
-    /* first set the input */
-    num_input = ann->num_input;
-    for (i = 0; i != num_input; i++) {
-        first_neuron[i].value = input[i];
+    if (ann->network_type == FANN_NETTYPE_SHORTCUT) {
+        inputs = values;
+    }
+    else {
+        inputs = (layer_it - 1)->values;
     }
-    /* Set the bias neuron in the input layer */
-    (ann->first_layer->last_neuron - 1)->value = 1;
 
-    last_layer = ann->last_layer;
-    for (layer_it = ann->first_layer + 1; layer_it != last_layer; layer_it++) {
-        last_neuron = layer_it->last_neuron;
-        for (neuron_it = layer_it->first_neuron; neuron_it != last_neuron; neuron_it++) {
-            if (neuron_it->first_con == neuron_it->last_con) {
-                /* bias neurons */
-                neuron_it->value = 1;
-                continue;
+    layer_values = layer_it->values + first;
+    last_neuron = layer_it->first_neuron + last;
+    for (neuron_it = layer_it->first_neuron + first; neuron_it != last_neuron; neuron_it++, layer_values++) {
+        if (neuron_it->first_con == neuron_it->last_con) {
+            /* bias neurons */
+            *layer_values = multiplier;
+            fann_energy_act_write(ann, 1);
+            continue;
+        }
+
+        fann_profile_enter(&fann_profile_dot);
+        activation_function = neuron_it->activation_function;
+        steepness = neuron_it->activation_steepness;
+
+        neuron_sum = 0;
+        num_connections = neuron_it->last_con - neuron_it->first_con;
+        weights = ann->weights + neuron_it->first_con;
+
+        if (ann->connection_rate >= 1) {
+            /* unrolled loop start */
+            i = num_connections & 3;    /* same as modulo 4 */
+            switch (i) {
+            case 3:
+                neuron_sum += fann_mult(weights[2], inputs[2]);
+                /* fall through */
+            case 2:
+                neuron_sum += fann_mult(weights[1], inputs[1]);
+                /* fall through */
+            case 1:
+                neuron_sum += fann_mult(weights[0], inputs[0]);
+            case 0:
+                break;
+            }
+
+            for (; i != num_connections; i += 4) {
+                neuron_sum +=
+                    fann_mult(weights[i], inputs[i]) +
+                    fann_mult(weights[i + 1], inputs[i + 1]) +
+                    fann_mult(weights[i + 2], inputs[i + 2]) +
+                    fann_mult(weights[i + 3], inputs[i + 3]);
             }
+            /* unrolled loop end */
 
-            activation_function = neuron_it->activation_function;
-            steepness = neuron_it->activation_steepness;
-
-            neuron_sum = 0;
-            num_connections = neuron_it->last_con - neuron_it->first_con;
-            weights = ann->weights + neuron_it->first_con;
-
-            if (ann->connection_rate >= 1) {
-                if (ann->network_type == FANN_NETTYPE_SHORTCUT) {
-                    neurons = ann->first_layer->first_neuron;
-                }
-                else {
-                    neurons = (layer_it - 1)->first_neuron;
-                }
-
-
-                /* unrolled loop start */
-                i = num_connections & 3;    /* same as modulo 4 */
-                switch (i) {
-                case 3:
-                    neuron_sum += fann_mult(weights[2], neurons[2].value);
-                case 2:
-                    neuron_sum += fann_mult(weights[1], neurons[1].value);
-                case 1:
-                    neuron_sum += fann_mult(weights[0], neurons[0].value);
-                case 0:
-                    break;
-                }
-
-                for (; i != num_connections; i += 4) {
-                    neuron_sum +=
-                        fann_mult(weights[i], neurons[i].value) +
-                        fann_mult(weights[i + 1], neurons[i + 1].value) +
-                        fann_mult(weights[i + 2], neurons[i + 2].value) +
-                        fann_mult(weights[i + 3], neurons[i + 3].value);
-                }
-                /* unrolled loop end */
-
-                /*
-                 * for(i = 0;i != num_connections; i++){
-                 * printf("%f += %f*%f, ", neuron_sum, weights[i], neurons[i].value);
-                 * neuron_sum += fann_mult(weights[i], neurons[i].value);
-                 * }
-                 */
+            /*
+             * for(i = 0;i != num_connections; i++){
+             * printf("%f += %f*%f, ", neuron_sum, weights[i], inputs[i]);
+             * neuron_sum += fann_mult(weights[i], inputs[i]);
+             * }
+             */
+        }
+        else {
+            columns = ann->columns + neuron_it->first_con;
+
+            i = num_connections & 3;    /* same as modulo 4 */
+            switch (i) {
+            case 3:
+                neuron_sum += fann_mult(weights[2], values[columns[2]]);
+                /* fall through */
+            case 2:
+                neuron_sum += fann_mult(weights[1], values[columns[1]]);
+                /* fall through */
+            case 1:
+                neuron_sum += fann_mult(weights[0], values[columns[0]]);
+            case 0:
+                break;
             }
-            else {
-                neuron_pointers = ann->connections + neuron_it->first_con;
-
-                i = num_connections & 3;    /* same as modulo 4 */
-                switch (i) {
-                case 3:
-                    neuron_sum += fann_mult(weights[2], neuron_pointers[2]->value);
-                case 2:
-                    neuron_sum += fann_mult(weights[1], neuron_pointers[1]->value);
-                case 1:
-                    neuron_sum += fann_mult(weights[0], neuron_pointers[0]->value);
-                case 0:
-                    break;
-                }
-
-                for (; i != num_connections; i += 4) {
-                    neuron_sum +=
-                        fann_mult(weights[i], neuron_pointers[i]->value) +
-                        fann_mult(weights[i + 1], neuron_pointers[i + 1]->value) +
-                        fann_mult(weights[i + 2], neuron_pointers[i + 2]->value) +
-                        fann_mult(weights[i + 3], neuron_pointers[i + 3]->value);
-                }
+
+            for (; i != num_connections; i += 4) {
+                neuron_sum +=
+                    fann_mult(weights[i], values[columns[i]]) +
+                    fann_mult(weights[i + 1], values[columns[i + 1]]) +
+                    fann_mult(weights[i + 2], values[columns[i + 2]]) +
+                    fann_mult(weights[i + 3], values[columns[i + 3]]);
             }
+        }
+        fann_profile_leave(&fann_profile_dot);
 
-            neuron_sum = fann_mult(steepness, neuron_sum);
+        /* weights (and columns), inputs, activation */
+        fann_energy_weights(((ann->connection_rate >= 1) ? 1 : 2) * num_connections);
+        fann_energy_act_read(ann, num_connections);
+        fann_energy_act_write(ann, 1);
+        energy_count(multiplies, num_connections);
+        energy_count(activations, 1);
 
+        fann_profile_enter(&fann_profile_activation);
+#ifdef FANN_Q15
+        *layer_values = fann_q15_sum(neuron_sum, layer_it->weight_decimal_point);
+        fann_stepwise_breakpoints(ann, activation_function, steepness, breakpoints);
+        fann_activate_layer(ann, activation_function, steepness, breakpoints, layer_values, 1);
+#elif defined(FIXEDFANN)
+        *layer_values = neuron_sum;
+        fann_stepwise_breakpoints(ann, activation_function, steepness, breakpoints);
+        fann_activate_layer(ann, activation_function, steepness, breakpoints, layer_values, 1);
+#else
+        /* the weights include the steepness (see fann_update_max_sum),
+         * the bound only changes with it */
+        if (steepness != last_steepness) {
             max_sum = 150/steepness;
-            if (neuron_sum > max_sum)
-                neuron_sum = max_sum;
-            else if (neuron_sum < -max_sum)
-                neuron_sum = -max_sum;
+            last_steepness = steepness;
+        }
+        if (neuron_sum > max_sum)
+            neuron_sum = max_sum;
+        else if (neuron_sum < -max_sum)
+            neuron_sum = -max_sum;
 
-            neuron_it->sum = neuron_sum;
+        fann_activation_switch(activation_function, neuron_sum, *layer_values);
+#endif // FIXEDFANN
+        fann_profile_leave(&fann_profile_activation);
+    }
+}
 
-            fann_activation_switch(activation_function, neuron_sum, neuron_it->value);
-        }
+FANN_EXTERNAL void FANN_API fann_set_input(struct fann *ann, fann_type *input)
+{
+    unsigned int i, num_input = ann->num_input;
+    fann_type *values = ann->values;
+
+    for (i = 0; i != num_input; i++) {
+        values[i] = input[i];
     }
+    /* the tests are in FRAM */
+    energy_count(fram_reads, num_input);
+    fann_energy_act_write(ann, num_input + 1);
+    /* Set the bias neuron in the input layer */
+#ifdef FIXEDFANN
+    values[num_input] = (fann_type) ann->multiplier;
+#else
+    values[num_input] = 1;
+#endif
+}
+
+/* INTERNAL FUNCTION
+   Runs the neurons first to last (excluded) of a layer with the engine of
+   the network.
+ */
+static void fann_run_neurons(struct fann *ann, struct fann_layer *layer_it,
+                             unsigned int first, unsigned int last)
+{
+#ifdef PROFILE_LAYERS
+    struct profiler_region *region =
+        &fann_profile_layer[fann_min((unsigned int) (layer_it - ann->first_layer), FANN_PROFILE_LAYERS) - 1];
+
+    profiler_enter(region);
+#endif // PROFILE_LAYERS
+    switch (ann->engine) {
+    case FANN_ENGINE_DENSE:
+        fann_run_dense_layer(ann, layer_it, first, last);
+        break;
+    case FANN_ENGINE_SPARSE:
+        fann_run_sparse_layer(ann, layer_it, first, last);
+        break;
+    default:
+        fann_run_generic_layer(ann, layer_it, first, last);
+        break;
+    }
+#ifdef PROFILE_LAYERS
+    profiler_leave(region);
+#endif // PROFILE_LAYERS
+}
+
+/* INTERNAL FUNCTION
+   Copies the activations of the output layer to the output array.
+ */
+static fann_type *fann_set_output(struct fann *ann)
+{
+    fann_type *output, *layer_values;
+    unsigned int i, num_output;
 
-    /* set the output */
     output = ann->output;
     num_output = ann->num_output;
-    neurons = (ann->last_layer - 1)->first_neuron;
+    layer_values = (ann->last_layer - 1)->values;
     for (i = 0; i != num_output; i++) {
-        output[i] = neurons[i].value;
+        output[i] = layer_values[i];
+    }
+    fann_energy_act_read(ann, num_output);
+    fann_energy_output(num_output);
+    return output;
+}
+
+FANN_EXTERNAL fann_type *FANN_API fann_run_layer(struct fann *ann, unsigned int layer)
+{
+    struct fann_layer *layer_it = ann->first_layer + layer;
+
+    fann_run_neurons(ann, layer_it, 0,
+                     (unsigned int) (layer_it->last_neuron - layer_it->first_neuron));
+
+    if (layer_it != ann->last_layer - 1) {
+        return NULL;
+    }
+    return fann_set_output(ann);
+}
+
+FANN_EXTERNAL fann_type *FANN_API fann_run(struct fann * ann, fann_type * input)
+{
+    unsigned int layer, num_layers;
+
+    fann_set_input(ann, input);
+
+    num_layers = (unsigned int) (ann->last_layer - ann->first_layer);
+    for (layer = 1; layer != num_layers - 1; layer++) {
+        fann_run_layer(ann, layer);
+    }
+    return fann_run_layer(ann, layer);
+}
+
+#ifdef FANN_BATCH
+/* Activations of the samples of a batch, neuron-major: the FANN_BATCH
+   samples of a neuron are contiguous, so that each weight is read once per
+   batch and applied to all of them. In SRAM. */
+#pragma DATA_SECTION(fann_batch_values, ".fann_act")
+static fann_type fann_batch_values[FANN_BATCH_NEURONS * FANN_BATCH];
+
+/* INTERNAL FUNCTION
+   Dense engine on a batch of count samples: the weights of each neuron are
+   read once and multiplied by the activations of all the samples, summed in
+   the order of fann_run_dense_layer so that the results are the same.
+ */
+static void fann_run_dense_batch(struct fann *ann, struct fann_layer *layer_it, unsigned int count)
+{
+    unsigned int i, j, k, b, num_inputs, num_neurons;
+    fann_type *weights, *inputs, *sums;
+    const fann_type *x0, *x1, *x2, *x3;
+    fann_type w0, w1, w2, w3;
+    fann_sum_type acc[FANN_BATCH];
+#ifdef FIXEDFANN
+#ifndef FANN_Q15
+    unsigned int decimal_point = ann->decimal_point;
+#endif
+    fann_type multiplier = (fann_type) ann->multiplier;
+#else
+    fann_type max_sum = layer_it->max_sum;
+    fann_type multiplier = 1;
+#endif
+
+    num_inputs = (unsigned int) ((layer_it - 1)->last_neuron - (layer_it - 1)->first_neuron);
+    num_neurons = (unsigned int) (layer_it->last_neuron - layer_it->first_neuron) - 1;
+    weights = ann->weights + layer_it->first_neuron->first_con;
+    inputs = fann_batch_values + ((layer_it - 1)->values - ann->values) * FANN_BATCH;
+    sums = fann_batch_values + (layer_it->values - ann->values) * FANN_BATCH;
+
+    fann_profile_enter(&fann_profile_dot);
+    for (i = 0; i < num_neurons; i++, weights += num_inputs) {
+        for (b = 0; b < count; b++) {
+            acc[b] = 0;
+        }
+
+        j = num_inputs & 3;    /* same as modulo 4 */
+        for (k = j; k-- > 0; ) {
+            w0 = weights[k];
+            x0 = inputs + k * FANN_BATCH;
+            for (b = 0; b < count; b++) {
+                acc[b] += fann_mult(w0, x0[b]);
+            }
+        }
+
+        for (; j != num_inputs; j += 4) {
+            w0 = weights[j];
+            w1 = weights[j + 1];
+            w2 = weights[j + 2];
+            w3 = weights[j + 3];
+            x0 = inputs + j * FANN_BATCH;
+            x1 = x0 + FANN_BATCH;
+            x2 = x1 + FANN_BATCH;
+            x3 = x2 + FANN_BATCH;
+            for (b = 0; b < count; b++) {
+                acc[b] +=
+                    fann_mult(w0, x0[b]) +
+                    fann_mult(w1, x1[b]) +
+                    fann_mult(w2, x2[b]) +
+                    fann_mult(w3, x3[b]);
+            }
+        }
+
+        for (b = 0; b < count; b++, sums++) {
+#ifdef FANN_Q15
+            *sums = fann_q15_sum(acc[b], layer_it->weight_decimal_point);
+#elif defined(FIXEDFANN)
+            *sums = acc[b];
+#else
+            *sums = fann_clip(acc[b], -max_sum, max_sum);
+#endif // FANN_Q15
+        }
+        sums += FANN_BATCH - count;
+    }
+    fann_profile_leave(&fann_profile_dot);
+
+    fann_profile_enter(&fann_profile_activation);
+    sums = fann_batch_values + (layer_it->values - ann->values) * FANN_BATCH;
+    if (count == FANN_BATCH) {
+        fann_activate_layer(ann, layer_it->activation_function, layer_it->activation_steepness,
+                            layer_it->stepwise_values, sums, num_neurons * FANN_BATCH);
+    }
+    else {
+        for (i = 0; i < num_neurons; i++) {
+            fann_activate_layer(ann, layer_it->activation_function, layer_it->activation_steepness,
+                                layer_it->stepwise_values, sums + i * FANN_BATCH, count);
+        }
+    }
+    fann_profile_leave(&fann_profile_activation);
+
+    /* bias neuron */
+    sums += num_neurons * FANN_BATCH;
+    for (b = 0; b < count; b++) {
+        sums[b] = multiplier;
+    }
+
+    /* weights once, inputs of the batch, sums, activations in place */
+    fann_energy_weights(num_neurons * num_inputs);
+    energy_count(sram_reads, count * num_neurons * (num_inputs + 1));
+    energy_count(sram_writes, count * (2 * num_neurons + 1));
+    energy_count(multiplies, count * num_neurons * num_inputs);
+    energy_count(activations, count * num_neurons);
+}
+
+/* INTERNAL FUNCTION
+   Sparse engine on a batch of count samples, see fann_run_dense_batch: the
+   weights and columns of each neuron are read once per batch.
+ */
+static void fann_run_sparse_batch(struct fann *ann, struct fann_layer *layer_it, unsigned int count)
+{
+    struct fann_neuron *neuron_it;
+    unsigned int i, j, b, num_connections, num_neurons;
+    fann_type *weights, *sums;
+    const fann_type *x;
+    fann_index_type *columns;
+    fann_type w;
+    fann_sum_type acc[FANN_BATCH];
+#ifdef FIXEDFANN
+#ifndef FANN_Q15
+    unsigned int decimal_point = ann->decimal_point;
+#endif
+    fann_type multiplier = (fann_type) ann->multiplier;
+#else
+    fann_type max_sum = layer_it->max_sum;
+    fann_type multiplier = 1;
+#endif
+
+    num_neurons = (unsigned int) (layer_it->last_neuron - layer_it->first_neuron);
+    if (ann->network_type == FANN_NETTYPE_LAYER) {
+        /* bias neuron */
+        num_neurons--;
     }
+    sums = fann_batch_values + (layer_it->values - ann->values) * FANN_BATCH;
+
+    fann_profile_enter(&fann_profile_dot);
+    neuron_it = layer_it->first_neuron;
+    for (i = 0; i < num_neurons; i++, neuron_it++) {
+        weights = ann->weights + neuron_it->first_con;
+        columns = ann->columns + neuron_it->first_con;
+        num_connections = neuron_it->last_con - neuron_it->first_con;
+
+        for (b = 0; b < count; b++) {
+            acc[b] = 0;
+        }
+        for (j = 0; j != num_connections; j++) {
+            w = weights[j];
+            x = fann_batch_values + columns[j] * FANN_BATCH;
+            for (b = 0; b < count; b++) {
+                acc[b] += fann_mult(w, x[b]);
+            }
+        }
+
+        for (b = 0; b < count; b++, sums++) {
+#ifdef FANN_Q15
+            *sums = fann_q15_sum(acc[b], layer_it->weight_decimal_point);
+#elif defined(FIXEDFANN)
+            *sums = acc[b];
+#else
+            *sums = fann_clip(acc[b], -max_sum, max_sum);
+#endif // FANN_Q15
+        }
+        sums += FANN_BATCH - count;
+
+        /* weights and columns once, inputs of the batch */
+        fann_energy_weights(2 * num_connections);
+        energy_count(sram_reads, count * num_connections);
+        energy_count(multiplies, count * num_connections);
+    }
+    fann_profile_leave(&fann_profile_dot);
+
+    fann_profile_enter(&fann_profile_activation);
+    sums = fann_batch_values + (layer_it->values - ann->values) * FANN_BATCH;
+    for (i = 0; i < num_neurons; i++) {
+        fann_activate_layer(ann, layer_it->activation_function, layer_it->activation_steepness,
+                            layer_it->stepwise_values, sums + i * FANN_BATCH, count);
+    }
+    fann_profile_leave(&fann_profile_activation);
+
+    if (ann->network_type == FANN_NETTYPE_LAYER) {
+        sums += num_neurons * FANN_BATCH;
+        for (b = 0; b < count; b++) {
+            sums[b] = multiplier;
+        }
+        energy_count(sram_writes, count);
+    }
+
+    /* sums, activations in place */
+    energy_count(sram_reads, count * num_neurons);
+    energy_count(sram_writes, 2 * count * num_neurons);
+    energy_count(activations, count * num_neurons);
+}
+
+/* INTERNAL FUNCTION
+   Runs count (at most FANN_BATCH) samples through the network, layer by
+   layer, in fann_batch_values, and copies their outputs.
+ */
+static void fann_run_batch_samples(struct fann *ann, fann_type *inputs, unsigned int count,
+                                   fann_type *outputs)
+{
+    struct fann_layer *layer_it;
+    unsigned int i, b, num_input = ann->num_input, num_output = ann->num_output;
+    fann_type *values;
+#ifdef FIXEDFANN
+    fann_type multiplier = (fann_type) ann->multiplier;
+#else
+    fann_type multiplier = 1;
+#endif
+
+    /* inputs and bias of the input layer, transposed */
+    for (i = 0, values = fann_batch_values; i != num_input; i++, values += FANN_BATCH) {
+        for (b = 0; b < count; b++) {
+            values[b] = inputs[b * num_input + i];
+        }
+    }
+    for (b = 0; b < count; b++) {
+        values[b] = multiplier;
+    }
+    /* the tests are in FRAM */
+    energy_count(fram_reads, count * num_input);
+    energy_count(sram_writes, count * (num_input + 1));
+
+    for (layer_it = ann->first_layer + 1; layer_it != ann->last_layer; layer_it++) {
+#ifdef PROFILE_LAYERS
+        struct profiler_region *region =
+            &fann_profile_layer[fann_min((unsigned int) (layer_it - ann->first_layer), FANN_PROFILE_LAYERS) - 1];
+
+        profiler_enter(region);
+#endif // PROFILE_LAYERS
+        if (ann->engine == FANN_ENGINE_DENSE) {
+            fann_run_dense_batch(ann, layer_it, count);
+        }
+        else {
+            fann_run_sparse_batch(ann, layer_it, count);
+        }
+#ifdef PROFILE_LAYERS
+        profiler_leave(region);
+#endif // PROFILE_LAYERS
+    }
+
+    values = fann_batch_values + ((ann->last_layer - 1)->values - ann->values) * FANN_BATCH;
+    for (i = 0; i != num_output; i++, values += FANN_BATCH) {
+        for (b = 0; b < count; b++) {
+            outputs[b * num_output + i] = values[b];
+        }
+    }
+    energy_count(sram_reads, count * num_output);
+    energy_count(sram_writes, count * num_output);
+}
+#endif // FANN_BATCH
+
+FANN_EXTERNAL fann_type *FANN_API fann_run_batch(struct fann *ann, fann_type *inputs,
+                                                 unsigned int num_samples, fann_type *outputs)
+{
+    unsigned int i, count, num_input = ann->num_input, num_output = ann->num_output;
+    fann_type *output;
+
+#ifdef FANN_BATCH
+    if (ann->engine != FANN_ENGINE_GENERIC && ann->total_neurons <= FANN_BATCH_NEURONS) {
+        for (i = 0; i < num_samples; i += count) {
+            count = fann_min(num_samples - i, FANN_BATCH);
+            fann_run_batch_samples(ann, inputs + i * num_input, count, outputs + i * num_output);
+        }
+        return outputs;
+    }
+#endif // FANN_BATCH
+
+    /* one sample at a time */
+    for (i = 0; i < num_samples; i++) {
+        output = fann_run(ann, inputs + i * num_input);
+        for (count = 0; count != num_output; count++) {
+            outputs[i * num_output + count] = output[count];
+        }
+    }
+    return outputs;
+}
+
+/* INTERNAL FUNCTION
+   Saves the activations of the neurons from to cursor (excluded) and commits
+   the cursor. The activations after the committed cursor are never read on
+   resume, so they can be written in place; the cursor is written to the
+   inactive copy and the switch of the active copy is the commit point.
+ */
+static void fann_checkpoint_commit(struct fann *ann, struct fann_checkpoint *state,
+                                   unsigned int from, unsigned int cursor)
+{
+    volatile fann_type *saved = state->values;
+    fann_type *values = ann->values;
+    unsigned int i, next = !state->active;
+
+    if (saved != NULL) {
+        for (i = from; i != cursor; i++) {
+            saved[i] = values[i];
+        }
+    }
+
+    state->cursor[next] = cursor;
+    state->active = next;
+
+    /* the checkpoint is in FRAM */
+    if (saved != NULL) {
+        fann_energy_act_read(ann, cursor - from);
+        energy_count(fram_writes, cursor - from);
+    }
+    energy_count(fram_writes, 2);
+    energy_count(commits, 1);
+
+    if (state->history != NULL && state->clock != NULL) {
+        state->history->alive = state->clock();
+    }
+}
+
+FANN_EXTERNAL fann_type *FANN_API fann_run_resumable(struct fann *ann, fann_type *input,
+                                                      struct fann_checkpoint *state)
+{
+    struct fann_layer *layer_it, *last_layer = ann->last_layer;
+    struct fann_neuron *first_neuron = ann->first_layer->first_neuron;
+    volatile fann_type *saved = state->values;
+    fann_type *values = ann->values;
+    unsigned int i, cursor, committed, end, layer_start, layer_end;
+    unsigned int interval = fann_max(state->interval, 1);
+    unsigned int num_input = (unsigned int) (ann->first_layer->last_neuron - first_neuron);
+    unsigned int last = (unsigned int) ((last_layer - 1)->last_neuron - first_neuron);
+
+    /* the input is given again on resume, it is not saved */
+    fann_set_input(ann, input);
+
+    cursor = state->cursor[state->active];
+    if (cursor < num_input) {
+        /* new inference */
+        cursor = num_input;
+    }
+    else if (saved != NULL) {
+        /* resume */
+        for (i = num_input; i != cursor; i++) {
+            values[i] = saved[i];
+        }
+        energy_count(fram_reads, cursor - num_input);
+        fann_energy_act_write(ann, cursor - num_input);
+    }
+    committed = cursor;
+
+    for (layer_it = ann->first_layer + 1; layer_it != last_layer; layer_it++) {
+        layer_start = (unsigned int) (layer_it->first_neuron - first_neuron);
+        layer_end = (unsigned int) (layer_it->last_neuron - first_neuron);
+        while (cursor < layer_end) {
+            end = fann_min(layer_end, committed + interval);
+            fann_run_neurons(ann, layer_it, cursor - layer_start, end - layer_start);
+            cursor = end;
+            /* the end of the inference is committed below */
+            if (cursor - committed == interval && cursor != last) {
+                fann_checkpoint_commit(ann, state, committed, cursor);
+                committed = cursor;
+            }
+        }
+    }
+
+    fann_set_output(ann);
+
+    /* done, the next call starts a new inference */
+    fann_checkpoint_commit(ann, state, 0, 0);
     return ann->output;
 }
+
+FANN_EXTERNAL int FANN_API fann_power_history_boot(struct fann_power_history *history)
+{
+    unsigned int next;
+
+    /* a power failure in here records a cycle twice at worst */
+    if (history->started) {
+        next = history->next;
+        history->uptime[next] = history->alive;
+        if (++next == FANN_POWER_HISTORY) {
+            next = 0;
+        }
+        history->next = next;
+        if (history->count < FANN_POWER_HISTORY) {
+            history->count++;
+        }
+    }
+    history->started = 1;
+    history->alive = 0;
+
+    return history->count == FANN_POWER_HISTORY && history->next == 0;
+}
+
+/* INTERNAL FUNCTION
+   Neurons run per inference by fann_run_resumable, i.e. all but the input
+   layer.
+ */
+static unsigned int fann_checkpoint_neurons(struct fann *ann)
+{
+    return (unsigned int) (ann->total_neurons -
+                           (ann->first_layer->last_neuron - ann->first_layer->first_neuron));
+}
+
+/* INTERNAL FUNCTION
+   Neurons computed in the power cycles of the history when checkpointing
+   every interval neurons: in each cycle, the inferences of num_neurons that
+   fit after the restart, then the chunks of interval neurons (run, saved and
+   committed) of the next one. An inference is cut in chunks of interval
+   neurons and a last one, committed at its end without saves (see
+   fann_run_resumable). The recorded uptimes stop at the last checkpoint,
+   half a chunk of the current interval is added to estimate the on-time.
+ */
+static uint32_t fann_checkpoint_progress(struct fann_power_history *history,
+                                         const struct fann_checkpoint_costs *costs,
+                                         unsigned int interval, unsigned int num_neurons,
+                                         uint32_t current_chunk)
+{
+    uint32_t chunk, inference, on_time, left, progress = 0;
+    unsigned int k, chunks;
+
+    chunks = (num_neurons + interval - 1) / interval;
+    chunk = (uint32_t) interval * (costs->neuron + costs->save) + costs->commit;
+    inference = (uint32_t) num_neurons * costs->neuron +
+                (uint32_t) (chunks - 1) * (interval * costs->save + costs->commit) + costs->commit;
+    for (k = 0; k != history->count; k++) {
+        if (history->uptime[k] == 0) {
+            /* not even one checkpoint */
+            continue;
+        }
+        on_time = history->uptime[k] + current_chunk / 2;
+        if (on_time > costs->restart) {
+            left = on_time - costs->restart;
+            progress += left / inference * num_neurons +
+                        fann_min(left % inference / chunk, chunks - 1) * interval;
+        }
+    }
+    return progress;
+}
+
+FANN_EXTERNAL unsigned int FANN_API fann_checkpoint_adapt(struct fann *ann, struct fann_checkpoint *state,
+                                                          const struct fann_checkpoint_costs *costs)
+{
+    struct fann_power_history *history = state->history;
+    unsigned int interval, best_interval, num_neurons;
+    uint32_t current_chunk, progress, best_progress = 0;
+
+    if (history == NULL || history->count == 0) {
+        return state->interval;
+    }
+
+    /* neurons run per inference: coarser intervals checkpoint once per test */
+    num_neurons = fann_checkpoint_neurons(ann);
+    current_chunk = (uint32_t) fann_min(fann_max(state->interval, 1), num_neurons) *
+                    (costs->neuron + costs->save) + costs->commit;
+
+    /* candidates: powers of two, then the whole inference; on a tie the
+     * coarser interval is kept (fewer FRAM writes) */
+    best_interval = 1;
+    for (interval = 1; ; interval *= 2) {
+        if (interval > num_neurons) {
+            interval = num_neurons;
+        }
+        progress = fann_checkpoint_progress(history, costs, interval, num_neurons, current_chunk);
+        if (progress >= best_progress && (progress > 0 || interval == 1)) {
+            best_progress = progress;
+            best_interval = interval;
+        }
+        if (interval == num_neurons) {
+            break;
+        }
+    }
+
+    state->interval = best_interval;
+    return best_interval;
+}
+
+/* INTERNAL FUNCTION
+   Time of one inference run by fann_run_resumable into scratch, in ticks
+   of clock (meaningless if it saturates, see fann_checkpoint_measure).
+ */
+static uint16_t fann_checkpoint_time(struct fann *ann, fann_type *input, struct fann_checkpoint *scratch,
+                                     fann_clock_type clock)
+{
+    uint16_t start = clock();
+
+    fann_run_resumable(ann, input, scratch);
+    return (uint16_t) (clock() - start);
+}
+
+FANN_EXTERNAL int FANN_API fann_checkpoint_measure(struct fann *ann, struct fann_checkpoint *state,
+                                                   fann_type *input, fann_type *values,
+                                                   struct fann_checkpoint_costs *costs)
+{
+    struct fann_checkpoint scratch;
+    unsigned int i, num_neurons = fann_checkpoint_neurons(ann);
+    uint16_t start, once, every_neuron, saves;
+
+    if (state->clock == NULL || num_neurons < 2) {
+        return -1;
+    }
+
+    /* an inference committed once, at its end (no saves), then one
+     * committed after every neuron: num_neurons - 1 more commits and saves,
+     * the saves being timed on their own */
+    memset(&scratch, 0, sizeof(scratch));
+    scratch.values = values;
+    scratch.interval = num_neurons;
+    once = fann_checkpoint_time(ann, input, &scratch, state->clock);
+    scratch.interval = 1;
+    every_neuron = fann_checkpoint_time(ann, input, &scratch, state->clock);
+    start = state->clock();
+    for (i = 1; i != num_neurons; i++) {
+        values[i] = ann->values[i];
+    }
+    saves = (uint16_t) (state->clock() - start);
+    if (state->clock() == 0xFFFF || every_neuron < once + saves) {
+        return -1;
+    }
+
+    costs->save = saves / (num_neurons - 1);
+    costs->commit = (every_neuron - once - saves) / (num_neurons - 1);
+    costs->neuron = (once > costs->commit) ? (once - costs->commit) / num_neurons : 1;
+    return 0;
+}
+
+FANN_GET(unsigned int, total_neurons)
+FANN_GET(fann_type *, values)
+
+FANN_EXTERNAL unsigned int FANN_API fann_get_num_layers(struct fann *ann)
+{
+    return (unsigned int) (ann->last_layer - ann->first_layer);
+}
+
+#ifdef FIXEDFANN
+FANN_GET(unsigned int, decimal_point)
+FANN_GET(unsigned int, multiplier)
+#endif // FIXEDFANN
@@ -22,7 +22,11 @@
 #include "config.h"
 #include "fann.h"
 
-#ifndef FIXEDFANN
+/* Cascade training is not part of the firmware: it needs the training back
+ * end of FANN and the per-neuron sums and values, which the inference-only
+ * neuron layout of this port does not keep. Train on the host with FANN.
+ */
+#if defined(FANN_CASCADE) && !defined(FIXEDFANN)
 
 /* #define CASCADE_DEBUG */
 /* #define CASCADE_DEBUG_FULL */
@@ -972,7 +976,7 @@ void fann_install_candidate(struct fann *ann)
 	return;
 }
 
-#endif /* FIXEDFANN */
+#endif /* FANN_CASCADE && !FIXEDFANN */
 
 FANN_EXTERNAL unsigned int FANN_API fann_get_cascade_num_candidates(struct fann *ann)
 {
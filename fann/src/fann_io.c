@@ -20,25 +20,35 @@
 #include "fann.h"
 #include "fann_data.h"
 
+#if defined(FANN_STATIC)
+#include "thyroid_static.h"
+#elif defined(FANN_Q15)
+#include "thyroid_trained_q15.h"
+#elif defined(FIXEDFANN)
+#include "thyroid_trained_fixed.h"
+#else
 #include "thyroid_trained.h"
+#endif // FIXEDFANN
 
 
+#ifndef FANN_STATIC
 /**
  * INTERNAL FUNCTION
  *
  * The ANN is created from constant values contained in 
  * database/<example>_trained.h
  * where <example> is the subject example (e.g. xor, thyroid, etc.)
+ * When compiled with FIXEDFANN, database/<example>_trained_fixed.h
+ * (generated by database/float-to-fixed) is used instead, or
+ * database/<example>_trained_q15.h with FANN_Q15.
+ * The weights stay in the header (const, in FRAM): only the layers, the
+ * neurons and the activations are allocated.
  */
 struct fann *fann_create_msp430()
 {
-    uint8_t input_neuron;
-    uint8_t i;
-    uint8_t num_connections;
-    uint8_t tmp_val;
+    unsigned int i;
 
-    struct fann_neuron *first_neuron, *neuron_it, *last_neuron, **connected_neurons;
-    fann_type *weights;
+    struct fann_neuron *neuron_it, *last_neuron;
     struct fann_layer *layer_it;
     struct fann *ann = NULL;
 
@@ -49,6 +59,13 @@ struct fann *fann_create_msp430()
         LAYER_SIZE_3
     };
     uint8_t layer_size;
+#ifdef FANN_Q15
+    uint8_t weight_decimal_point_store[] = {
+        WEIGHT_DECIMAL_POINT_1,
+        WEIGHT_DECIMAL_POINT_2,
+        WEIGHT_DECIMAL_POINT_3
+    };
+#endif // FANN_Q15
     
     /* Allocate network. */
     // WARNING: dynamic allocation!
@@ -139,7 +156,7 @@ struct fann *fann_create_msp430()
 #endif // DEBUG_MALLOC
 
     // TODO: [not urgent] dynamically parse activation steepnesses (macro)
-    uint16_t cascade_activation_steepnesses[] = {
+    fann_type cascade_activation_steepnesses[] = {
         CASCADE_ACTIVATION_STEEPNESS_1,
         CASCADE_ACTIVATION_STEEPNESS_2,
         CASCADE_ACTIVATION_STEEPNESS_3,
@@ -151,7 +168,13 @@ struct fann *fann_create_msp430()
     }
 
 #ifdef FIXEDFANN
-    fann_update_stepwise(ann);
+    ann->decimal_point = DECIMAL_POINT;
+#ifdef FANN_Q15
+    /* 1.0 is not representable in Q0.15 */
+    ann->multiplier = (1UL << DECIMAL_POINT) - 1;
+#else
+    ann->multiplier = 1 << DECIMAL_POINT;
+#endif // FANN_Q15
 #endif // FIXEDFANN
 
 #ifdef DEBUG
@@ -163,7 +186,11 @@ struct fann *fann_create_msp430()
 
     for (layer_it = ann->first_layer; layer_it != ann->last_layer; layer_it++) {
 
-        layer_size = layer_size_store[i++];
+        layer_size = layer_size_store[i];
+#ifdef FANN_Q15
+        layer_it->weight_decimal_point = weight_decimal_point_store[i];
+#endif // FANN_Q15
+        i++;
         if (layer_size == 0) {
             fann_destroy(ann);
             return NULL;
@@ -231,36 +258,44 @@ struct fann *fann_create_msp430()
 
     last_neuron = (ann->last_layer - 1)->last_neuron;
     for (neuron_it = ann->first_layer->first_neuron; neuron_it != last_neuron; neuron_it++) {
-        num_connections = neurons[i][0];
-        tmp_val = neurons[i][1];
-        neuron_it->activation_steepness = neurons[i][2];
-        i++;
-
-        neuron_it->activation_function = (enum fann_activationfunc_enum) tmp_val;
+        neuron_it->activation_function = (enum fann_activationfunc_enum) neuron_activations[i];
+        neuron_it->activation_steepness = neuron_steepnesses[i];
         neuron_it->first_con = ann->total_connections;
-        ann->total_connections += num_connections;
+        ann->total_connections += neuron_inputs[i];
         neuron_it->last_con = ann->total_connections;
+        i++;
     }
 
-    // WARNING: dynamic allocation!
-    fann_allocate_connections(ann);
-    if (ann->errno_f == FANN_E_CANT_ALLOCATE_MEM) {
-        fann_destroy(ann);
-        return NULL;
-    }
+    /* Choose how the network will be run, once and for all. */
+    fann_select_engine(ann);
+    fann_update_stepwise(ann);
 
-    connected_neurons = ann->connections;
-    weights = ann->weights;
-    first_neuron = ann->first_layer->first_neuron;
+    /* The weights (with the steepness in floating point, see
+     * database/convert) and the column indices are read in place from the
+     * header, in FRAM: nothing is allocated or copied. */
+    ann->weights = (fann_type *) connection_weights;
+#ifndef FIXEDFANN
+    fann_update_max_sum(ann);
+#endif // FIXEDFANN
 
-    for (i = 0; i < ann->total_connections; i++) {
-        input_neuron = connections[i][0];
-        weights[i] = connections[i][1];
-        connected_neurons[i] = first_neuron + input_neuron;
+    /* Column indices: sparse networks only. */
+    if (ann->connection_rate < 1) {
+#if COLUMNS_INCLUDED
+        if (ann->total_neurons - 1 > FANN_INDEX_MAX) {
+            /* too many neurons for fann_index_type, see FANN_INDEX16 */
+            fann_destroy(ann);
+            return NULL;
+        }
+        ann->columns = (fann_index_type *) connection_columns;
+#else
+        fann_destroy(ann);
+        return NULL;
+#endif // COLUMNS_INCLUDED
     }
 
     return ann;
 }
+#endif // FANN_STATIC
 
 
 /**
@@ -268,9 +303,15 @@ struct fann *fann_create_msp430()
  */
 FANN_EXTERNAL struct fann *FANN_API fann_create_from_header()
 {
+#ifdef FANN_STATIC
+    /* The network is statically allocated in database/<example>_static.h
+     * (generated by database/gen-infer --static), nothing to do. */
+    return &thyroid_ann;
+#else
     struct fann *ann;
 
     ann = fann_create_msp430();
 
     return ann;
+#endif // FANN_STATIC
 }
@@ -25,9 +25,22 @@
 
 
 /* INTERNAL FUNCTION
-   Helper function to update the MSE value and return a diff which takes symmetric functions into account
+   Square of a difference of two outputs, as a float
 */
-fann_type fann_update_MSE(struct fann *ann, struct fann_neuron* neuron, fann_type neuron_diff)
+static float fann_squared_diff(struct fann *ann, fann_type neuron_diff)
+{
+#ifdef FIXEDFANN
+    return (neuron_diff / (float) ann->multiplier) * (neuron_diff / (float) ann->multiplier);
+#else
+    (void) ann;
+    return (float) (neuron_diff * neuron_diff);
+#endif
+}
+
+/* INTERNAL FUNCTION
+   Helper function to update the MSE value and return the squared diff it added, which takes symmetric functions into account
+*/
+float fann_update_MSE(struct fann *ann, struct fann_neuron* neuron, fann_type neuron_diff)
 {
     float neuron_diff2;
 
@@ -56,11 +69,7 @@ fann_type fann_update_MSE(struct fann *ann, struct fann_neuron* neuron, fann_typ
             break;
     }
 
-#ifdef FIXEDFANN
-    neuron_diff2 = (neuron_diff / (float) ann->multiplier) * (neuron_diff / (float) ann->multiplier);
-#else
-    neuron_diff2 = (float) (neuron_diff * neuron_diff);
-#endif
+    neuron_diff2 = fann_squared_diff(ann, neuron_diff);
 
     ann->MSE_value += neuron_diff2;
 
@@ -70,28 +79,61 @@ fann_type fann_update_MSE(struct fann *ann, struct fann_neuron* neuron, fann_typ
         ann->num_bit_fail++;
     }
 
-    return neuron_diff;
+    return neuron_diff2;
 }
 
 
 FANN_EXTERNAL fann_type *FANN_API fann_test(struct fann *ann, fann_type * input,
                                             fann_type * desired_output)
 {
-    fann_type neuron_value;
     fann_type *output_begin = fann_run(ann, input);
+
+    fann_test_output(ann, output_begin, desired_output);
+
+    return output_begin;
+}
+
+FANN_EXTERNAL fann_type *FANN_API fann_test_batch(struct fann *ann, fann_type * inputs,
+                                                  fann_type * desired_outputs,
+                                                  unsigned int num_samples,
+                                                  fann_type * outputs)
+{
+    unsigned int i;
+
+    fann_run_batch(ann, inputs, num_samples, outputs);
+
+    for (i = 0; i != num_samples; i++)
+    {
+        fann_test_output(ann, outputs + i * ann->num_output, desired_outputs + i * ann->num_output);
+    }
+
+    return outputs;
+}
+
+FANN_EXTERNAL float FANN_API fann_test_output(struct fann *ann, fann_type * output_begin,
+                                              fann_type * desired_output)
+{
+    fann_type neuron_value;
     fann_type *output_it;
     const fann_type *output_end = output_begin + ann->num_output;
     fann_type neuron_diff;
     struct fann_neuron *output_neuron = (ann->last_layer - 1)->first_neuron;
+    float squared_error = 0;
 
     /* calculate the error */
     for(output_it = output_begin; output_it != output_end; output_it++)
     {
         neuron_value = *output_it;
 
+#ifdef FANN_Q15
+        /* the difference of two Q15 values may not fit in 16 bits */
+        neuron_diff = (fann_type) fann_clip((int32_t) *desired_output - neuron_value,
+                                            (int32_t) INT16_MIN, (int32_t) INT16_MAX);
+#else
         neuron_diff = (*desired_output - neuron_value);
+#endif // FANN_Q15
 
-        neuron_diff = fann_update_MSE(ann, output_neuron, neuron_diff);
+        squared_error += fann_update_MSE(ann, output_neuron, neuron_diff);
 
         desired_output++;
         output_neuron++;
@@ -99,7 +141,7 @@ FANN_EXTERNAL fann_type *FANN_API fann_test(struct fann *ann, fann_type * input,
         ann->num_MSE++;
     }
 
-    return output_begin;
+    return squared_error;
 }
 
 /* get the mean square error.
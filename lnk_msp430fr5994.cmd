@@ -150,6 +150,9 @@ SECTIONS
         GROUP(READ_WRITE_MEMORY)
         {
 
+            /* Intermittent state: #pragma persistent of main_intermittent.c and interpow.lib */
+            .fann_state    : { *main_intermittent.obj (.TI.persistent)
+                               *interpow.lib<*> (.TI.persistent) }
             .TI.persistent : {}              /* For #pragma persistent            */
             .cio           : {}              /* C I/O Buffer                      */
             .sysmem        : {}              /* Dynamic memory allocation area    */
@@ -179,6 +182,12 @@ SECTIONS
 #else
     .const            : {} >> FRAM | FRAM2  /* Constant data                     */
 #endif
+    .tests            : {} > FRAM2          /* Packed test sets (database/convert) */
+#ifndef __LARGE_DATA_MODEL__
+    .fann_weights     : {} > FRAM           /* Network weights, not copied at boot */
+#else
+    .fann_weights     : {} >> FRAM | FRAM2  /* Network weights, not copied at boot */
+#endif
 
 #ifndef __LARGE_CODE_MODEL__
     .text             : {} > FRAM           /* Code                              */
@@ -208,6 +217,7 @@ SECTIONS
     .bss        : {} > RAM                  /* Global & static vars              */
     .data       : {} > RAM                  /* Global & static vars              */
     .TI.noinit  : {} > RAM                  /* For #pragma noinit                */
+    .fann_act   : {} > RAM                  /* Network activations (hot)         */
     .stack      : {} > RAM (HIGH)           /* Software system stack             */
 
     .tinyram    : {} > TINYRAM              /* Tiny RAM                          */
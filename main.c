@@ -1,3 +1,6 @@
+/* Not intermittent-safe: see main_intermittent.c (INTERMITTENT). */
+#ifndef INTERMITTENT
+
 #include <msp430.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -6,15 +9,57 @@
 #include <stdint.h>
 
 #include "fann.h"
+#ifdef PACKED_TESTS
+#include "thyroid_packed.h"
+#else
 #include "thyroid_test.h"
+#endif // PACKED_TESTS
+#ifdef FANN_INFER
+#include "thyroid_infer.h"
+#endif // FANN_INFER
 #include "profiler.h"
+#ifdef ENERGY
+#include "energy.h"
+#endif // ENERGY
 /*Intermittent Tester*/
 #include <tester.h>
 #include <noise.h>
 
 /* Debug variable. */
 fann_type *calc_out;
-static char string[] = "Hello! Hello! Hello! Hello! Hello! Hello! Hello! Hello! \n";
+
+#ifdef FANN_INFER
+/* Output of the generated inference function. */
+fann_type infer_out[THYROID_NUM_OUTPUT];
+#endif // FANN_INFER
+
+#ifdef FANN_BATCH
+/* Tests run together by fann_test_batch, and their outputs. */
+#define TEST_BATCH FANN_BATCH
+fann_type batch_out[TEST_BATCH][3];
+#else
+#define TEST_BATCH 1
+#endif // FANN_BATCH
+
+#ifdef PACKED_TESTS
+/* Current tests, read from the packed test set (all the 3600 tests, in FRAM2). */
+fann_type test_input[TEST_BATCH][THYROID_PACKED_NUM_INPUT];
+fann_type test_output[TEST_BATCH][THYROID_PACKED_NUM_OUTPUT];
+#define TEST_INPUT(i) test_input[(i) % TEST_BATCH]
+#define TEST_OUTPUT(i) test_output[(i) % TEST_BATCH]
+#else
+#define TEST_INPUT(i) input[i]
+#define TEST_OUTPUT(i) output[i]
+#endif // PACKED_TESTS
+
+#if defined(FANN_INFER) && defined(FIXEDFANN)
+#define TO_FLOAT(ann, x) ((float) (x) / THYROID_MULTIPLIER)
+#elif defined(FIXEDFANN)
+/* Convert a fixed point value to float (for printing only). */
+#define TO_FLOAT(ann, x) ((float) (x) / fann_get_multiplier(ann))
+#else
+#define TO_FLOAT(ann, x) (x)
+#endif // FIXEDFANN
 
 /**
  * main.c
@@ -42,12 +87,75 @@ int main(void)
     //tester_autoreset(0, noise_3, 0);
     tester_notify_start();
 
-    /* Fann structure. */
-    struct fann *ann;
-
+#ifdef PROFILE
     uint32_t clk_cycles = 0;
+
+    /* The overflow interrupt of the profiler timer extends its count. */
+    __bis_SR_register(GIE);
+#endif // PROFILE
     uint16_t i;
 
+#ifdef PACKED_TESTS
+    packed_tests_open(&thyroid_tests, thyroid_packed_records);
+#endif // PACKED_TESTS
+
+#ifdef FANN_INFER
+    /* Straight-line network generated by database/gen-infer: nothing to
+     * initialise, the MSE is computed here as fann_test would. */
+    uint16_t k;
+    float neuron_diff;
+    float mse = 0;
+
+#ifdef PROFILE
+    /* Start counting clock cycles. */
+    profiler_start();
+#endif // PROFILE
+
+    /* Run tests. */
+    for (i = 0; i < num_data; i++) {
+#ifdef PACKED_TESTS
+        packed_test_read(&thyroid_tests, i, TEST_INPUT(i), TEST_OUTPUT(i));
+#endif // PACKED_TESTS
+        thyroid_infer(TEST_INPUT(i), infer_out);
+        calc_out = infer_out;
+        for (k = 0; k < THYROID_NUM_OUTPUT; k++) {
+            neuron_diff = (float) (TEST_OUTPUT(i)[k] - calc_out[k]) / THYROID_MULTIPLIER;
+#if THYROID_OUTPUT_SYMMETRIC
+            neuron_diff /= 2;
+#endif
+            mse += neuron_diff * neuron_diff;
+        }
+#ifdef DEBUG
+        /* Print results and errors (very expensive operations). */
+        printf("Test %u:\n"
+               "  result = (%f, %f, %f)\n"
+               "expected = (%f, %f, %f)\n\n",
+               i + 1,
+               TO_FLOAT(ann, calc_out[0]), TO_FLOAT(ann, calc_out[1]), TO_FLOAT(ann, calc_out[2]),
+               TO_FLOAT(ann, TEST_OUTPUT(i)[0]), TO_FLOAT(ann, TEST_OUTPUT(i)[1]), TO_FLOAT(ann, TEST_OUTPUT(i)[2]));
+#endif // DEBUG
+    }
+
+#ifdef PROFILE
+    /* Stop counting clock cycles. */
+    clk_cycles = profiler_stop();
+
+    /* Print profiling. */
+    printf("Run %u tests:\n"
+           "-> execution " PROFILER_UNIT " = %lu (%lu per test)\n"
+           "-> execution time = %.3f ms (%.3f ms per test)\n\n",
+           i,
+           (unsigned long) clk_cycles, (unsigned long) (clk_cycles / i),
+           (float) clk_cycles / PROFILER_PER_MS, (float) clk_cycles / PROFILER_PER_MS / i);
+#endif // PROFILE
+
+    /* Print error. */
+    printf("MSE error on %d test data: %f\n\n", num_data, mse / (num_data * THYROID_NUM_OUTPUT));
+#else
+    /* Fann structure. */
+    struct fann *ann;
+    uint16_t k, batch;
+
 #ifdef PROFILE
     /* Start counting clock cycles. */
     profiler_start();
@@ -59,45 +167,75 @@ int main(void)
         return -1;
     }
 
+#ifdef FIXEDFANN
+    /* Test data must be generated with the decimal point of the network. */
+    if (fann_get_decimal_point(ann) != TEST_DECIMAL_POINT) {
+        printf("Decimal point mismatch: network %u, test data %u\n",
+               fann_get_decimal_point(ann), TEST_DECIMAL_POINT);
+        fann_destroy(ann);
+        return -1;
+    }
+#endif // FIXEDFANN
+
 #ifdef PROFILE
     /* Stop counting clock cycles. */
     clk_cycles = profiler_stop();
 
     /* Print profiling. */
     printf("ANN initialisation:\n"
-           "-> execution cycles = %lu\n"
+           "-> execution " PROFILER_UNIT " = %lu\n"
            "-> execution time = %.3f ms\n\n",
-           clk_cycles, (float) clk_cycles / 8000);
+           (unsigned long) clk_cycles, (float) clk_cycles / PROFILER_PER_MS);
 #endif // PROFILE
 
     /* Reset Mean Square Error. */
     fann_reset_MSE(ann);
 
+#ifdef ENERGY
+    /* Count the operations of the tests only. */
+    energy_reset();
+#endif // ENERGY
+
 #ifdef PROFILE
     /* Start counting clock cycles. */
     profiler_start();
 #endif // PROFILE
 
-    /* Run tests. */
-    for (i = 0; i < num_data; i++) {
-        calc_out = fann_test(ann, input[i], output[i]);
+    /* Run tests, TEST_BATCH at a time. */
+    for (i = 0; i < num_data; i += batch) {
+        batch = (num_data - i < TEST_BATCH) ? num_data - i : TEST_BATCH;
+#ifdef PACKED_TESTS
+        for (k = i; k < i + batch; k++) {
+            packed_test_read(&thyroid_tests, k, TEST_INPUT(k), TEST_OUTPUT(k));
+        }
+#endif // PACKED_TESTS
+#ifdef FANN_BATCH
+        fann_test_batch(ann, TEST_INPUT(i), TEST_OUTPUT(i), batch, batch_out[0]);
+#endif // FANN_BATCH
+        for (k = i; k < i + batch; k++) {
+#ifdef FANN_BATCH
+            calc_out = batch_out[k - i];
+#else
+            calc_out = fann_test(ann, TEST_INPUT(k), TEST_OUTPUT(k));
+#endif // FANN_BATCH
 #ifdef DEBUG
-        /* Print results and errors (very expensive operations). */
-        printf("Test %u:\n"
-               "  result = (%f, %f, %f)\n"
-               "expected = (%f, %f, %f)\n"
-               "   delta = (%f, %f, %f)\n\n",
-               i + 1,
-               calc_out[0], calc_out[1], calc_out[2],
-               output[i][0], output[i][1], output[i][2],
-               (float) fann_abs(calc_out[0] - output[i][0]),
-               (float) fann_abs(calc_out[1] - output[i][1]),
-               (float) fann_abs(calc_out[2] - output[i][2]));
+            /* Print results and errors (very expensive operations). */
+            printf("Test %u:\n"
+                   "  result = (%f, %f, %f)\n"
+                   "expected = (%f, %f, %f)\n"
+                   "   delta = (%f, %f, %f)\n\n",
+                   k + 1,
+                   TO_FLOAT(ann, calc_out[0]), TO_FLOAT(ann, calc_out[1]), TO_FLOAT(ann, calc_out[2]),
+                   TO_FLOAT(ann, TEST_OUTPUT(k)[0]), TO_FLOAT(ann, TEST_OUTPUT(k)[1]), TO_FLOAT(ann, TEST_OUTPUT(k)[2]),
+                   (float) TO_FLOAT(ann, fann_abs(calc_out[0] - TEST_OUTPUT(k)[0])),
+                   (float) TO_FLOAT(ann, fann_abs(calc_out[1] - TEST_OUTPUT(k)[1])),
+                   (float) TO_FLOAT(ann, fann_abs(calc_out[2] - TEST_OUTPUT(k)[2])));
 #else
-        /* Breakpoint here and check the difference between calc_out[k] and
-         * output[i][k], with k = 0, 1, 2. */
-        __no_operation();
+            /* Breakpoint here and check the difference between calc_out[j] and
+             * TEST_OUTPUT(k)[j], with j = 0, 1, 2. */
+            __no_operation();
 #endif // DEBUG
+        }
     }
 
 #ifdef PROFILE
@@ -106,18 +244,29 @@ int main(void)
 
     /* Print profiling. */
     printf("Run %u tests:\n"
-           "-> execution cycles = %lu (%lu per test)\n"
+           "-> execution " PROFILER_UNIT " = %lu (%lu per test)\n"
            "-> execution time = %.3f ms (%.3f ms per test)\n\n",
            i,
-           clk_cycles, clk_cycles / i,
-           (float) clk_cycles / 8000, (float) clk_cycles / 8000 / i);
+           (unsigned long) clk_cycles, (unsigned long) (clk_cycles / i),
+           (float) clk_cycles / PROFILER_PER_MS, (float) clk_cycles / PROFILER_PER_MS / i);
 #endif // PROFILE
 
+#ifdef PROFILE_LAYERS
+    /* Print the cycles of each layer, dot products and activations. */
+    profiler_report();
+#endif // PROFILE_LAYERS
+
+#ifdef ENERGY
+    /* Print the operations and the estimated energy per test. */
+    energy_report(i);
+#endif // ENERGY
+
     /* Print error. */
     printf("MSE error on %d test data: %f\n\n", num_data, fann_get_MSE(ann));
 
     /* Clean-up. */
     fann_destroy(ann);
+#endif // FANN_INFER
 
     __no_operation();
 
@@ -131,3 +280,5 @@ int main(void)
 
     return 0;
 }
+
+#endif // INTERMITTENT
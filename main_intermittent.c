@@ -0,0 +1,444 @@
+/*
+ * main_intermittent.c
+ *
+ * Taskified version of the thyroid test program, for transiently-powered
+ * operation (define INTERMITTENT to build it instead of main.c).
+ *
+ * The program is split in interpow tasks (see utils/interpow.h):
+ *   init      once, on the very first start: checks the network
+ *   next      selects the next test, or ends the run
+ *   layer     computes one layer of the network (fann_run_layer), or the
+ *             whole network with FANN_CHECKPOINT_INTERVAL
+ *   mse       accumulates the squared error of the test
+ *   done      prints the MSE and the re-execution statistics
+ * The test index, the activations of the network and the accumulated error
+ * live in interpow fields (FRAM, double-buffered for the self-fields), so a
+ * power failure only loses the task that was running: at most one layer of
+ * one test is computed again. Defining FANN_CHECKPOINT_INTERVAL=N runs the
+ * network with fann_run_resumable instead, which checkpoints every N neurons:
+ * use it when a layer does not fit in a power-on period. With
+ * FANN_CHECKPOINT_ADAPTIVE as well, N is chosen again every FANN_POWER_HISTORY
+ * power cycles from their uptimes (fann_checkpoint_adapt) and the costs of
+ * the checkpoints, measured once at run time (fann_checkpoint_measure).
+ *
+ * The network itself is volatile and is created again at every start, before
+ * resuming: use FANN_STATIC to make this free.
+ */
+
+#ifdef INTERMITTENT
+
+#include <msp430.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fann.h"
+#include "thyroid_test.h"
+#include "interpow.h"
+/*Intermittent Tester*/
+#include <tester.h>
+#include <noise.h>
+
+/* Neurons of the thyroid network, bias neurons included (22 + 6 + 4). */
+#define NUM_VALUES 32
+#define NUM_OUTPUT (sizeof(output[0]) / sizeof(output[0][0]))
+
+/* Interpow field type of fann_type (long is 32 bits on the MSP430). */
+#if defined(FANN_Q15)
+#define FANN_FIELD INT16
+#define read_fann_field(fld, dst, self) read_field_16(fld, (int16_t *) (dst), self, &PersState)
+#define write_fann_field(fld, src, self) write_field_16(fld, (int16_t *) (src), self, &PersState)
+#elif defined(FIXEDFANN)
+#define FANN_FIELD INT32
+#define read_fann_field(fld, dst, self) read_field_32(fld, (int32_t *) (dst), self, &PersState)
+#define write_fann_field(fld, src, self) write_field_32(fld, (int32_t *) (src), self, &PersState)
+#else
+#define FANN_FIELD FLOAT32
+#define read_fann_field(fld, dst, self) read_field_f32(fld, dst, self, &PersState)
+#define write_fann_field(fld, src, self) write_field_f32(fld, src, self, &PersState)
+#endif // FANN_Q15
+
+void init(void);
+void next(void);
+void layer(void);
+void mse(void);
+void done(void);
+
+/* Tasks. */
+#pragma PERSISTENT(task_init)
+NewTask(task_init, init, 0)
+#pragma PERSISTENT(task_next)
+NewTask(task_next, next, 1)
+#pragma PERSISTENT(task_layer)
+NewTask(task_layer, layer, 1)
+#pragma PERSISTENT(task_mse)
+NewTask(task_mse, mse, 1)
+#pragma PERSISTENT(task_done)
+NewTask(task_done, done, 0)
+
+#pragma PERSISTENT(PersState)
+InitialTask(task_init)
+
+/* Index of the next test to run. */
+#pragma PERSISTENT(PersSField0(task_next, test))
+#pragma PERSISTENT(PersSField1(task_next, test))
+NewSelfField(task_next, test, UINT16, 1, SELF_FIELD_CODE_1)
+
+/* Test being run, for the layers and the error. */
+#pragma PERSISTENT(PersField(task_next, task_layer, test))
+NewField(task_next, task_layer, test, UINT16, 1)
+#pragma PERSISTENT(PersField(task_next, task_mse, test))
+NewField(task_next, task_mse, test, UINT16, 1)
+
+#ifndef FANN_CHECKPOINT_INTERVAL
+/* Layer to compute next (0: new test) and activations of all the neurons. */
+#pragma PERSISTENT(PersSField0(task_layer, layer))
+#pragma PERSISTENT(PersSField1(task_layer, layer))
+NewSelfField(task_layer, layer, UINT16, 1, SELF_FIELD_CODE_1)
+#pragma PERSISTENT(PersSField0(task_layer, values))
+#pragma PERSISTENT(PersSField1(task_layer, values))
+NewSelfField(task_layer, values, FANN_FIELD, NUM_VALUES, SELF_FIELD_CODE_2)
+#endif // FANN_CHECKPOINT_INTERVAL
+
+/* Output of the network for the current test. */
+#pragma PERSISTENT(PersField(task_layer, task_mse, output))
+NewField(task_layer, task_mse, output, FANN_FIELD, NUM_OUTPUT)
+
+/* Sum of the squared errors (MSE value) of the tests run so far. */
+#pragma PERSISTENT(PersSField0(task_mse, error))
+#pragma PERSISTENT(PersSField1(task_mse, error))
+NewSelfField(task_mse, error, FLOAT32, 1, SELF_FIELD_CODE_1)
+#pragma PERSISTENT(PersField(task_mse, task_done, error))
+NewField(task_mse, task_done, error, FLOAT32, 1)
+
+/* Statistics: starts of the program and task executions, committed or not. */
+#pragma PERSISTENT(boots)
+uint16_t boots = 0;
+#pragma PERSISTENT(task_runs)
+uint32_t task_runs = 0;
+
+#ifdef FANN_CHECKPOINT_INTERVAL
+#ifdef FANN_CHECKPOINT_ADAPTIVE
+/* Uptimes of the last power cycles. */
+#pragma PERSISTENT(history)
+struct fann_power_history history = {0};
+
+/* Costs of the checkpoints, in microseconds of uptime at the clock the
+ * program runs at (MCLK is left at 1 MHz after a reset): measured once with
+ * fann_checkpoint_measure, see main. */
+#pragma PERSISTENT(checkpoint_costs)
+struct fann_checkpoint_costs checkpoint_costs = {0};
+#pragma PERSISTENT(costs_measured)
+uint16_t costs_measured = 0;
+#pragma PERSISTENT(measure_wait)
+uint16_t measure_wait = 0;
+#pragma PERSISTENT(measure_backoff)
+uint16_t measure_backoff = 0;
+#pragma PERSISTENT(measure_values)
+fann_type measure_values[NUM_VALUES] = {0};
+
+/**
+ * Time since the start, in microseconds (TA1 on SMCLK at 1 MHz).
+ */
+uint16_t uptime(void)
+{
+    return (TA1CTL & TAIFG) ? 0xFFFF : TA1R;
+}
+#endif // FANN_CHECKPOINT_ADAPTIVE
+
+/* Progress of the inference of the current test. */
+#pragma PERSISTENT(checkpoint_values)
+fann_type checkpoint_values[NUM_VALUES] = {0};
+#pragma PERSISTENT(checkpoint)
+struct fann_checkpoint checkpoint = {
+    .values = checkpoint_values,
+    .interval = FANN_CHECKPOINT_INTERVAL,
+#ifdef FANN_CHECKPOINT_ADAPTIVE
+    .history = &history,
+    .clock = uptime
+#endif // FANN_CHECKPOINT_ADAPTIVE
+};
+
+/* Tasks computing the network for each test. */
+#define LAYER_TASKS(ann) 1
+#else
+#define LAYER_TASKS(ann) (fann_get_num_layers(ann) - 1)
+#endif // FANN_CHECKPOINT_INTERVAL
+
+/* Network, created at every start. */
+struct fann *ann;
+
+/* Set by the done task. */
+uint8_t finished = 0;
+
+#if defined(FIXEDFANN)
+/* Convert a fixed point value to float (for printing only). */
+#define TO_FLOAT(ann, x) ((float) (x) / fann_get_multiplier(ann))
+#else
+#define TO_FLOAT(ann, x) (x)
+#endif // FIXEDFANN
+
+
+/**
+ * Check the network against the fields and the test data.
+ */
+void init(void)
+{
+    task_runs++;
+
+    if (fann_get_total_neurons(ann) > NUM_VALUES) {
+        printf("Network too large: %u neurons, %u fit in the fields\n",
+               fann_get_total_neurons(ann), NUM_VALUES);
+        finished = 1;
+        return;
+    }
+#ifdef FIXEDFANN
+    /* Test data must be generated with the decimal point of the network. */
+    if (fann_get_decimal_point(ann) != TEST_DECIMAL_POINT) {
+        printf("Decimal point mismatch: network %u, test data %u\n",
+               fann_get_decimal_point(ann), TEST_DECIMAL_POINT);
+        finished = 1;
+        return;
+    }
+#endif // FIXEDFANN
+
+    StartTask(task_next)
+}
+
+
+/**
+ * Select the next test, or end the run.
+ */
+void next(void)
+{
+    uint16_t test;
+    uint16_t next_test;
+
+    task_runs++;
+
+    ReadSelfField_U16(task_next, test, &test)
+    if (test == num_data) {
+        StartTask(task_done)
+        return;
+    }
+
+    WriteField_U16(task_next, task_layer, test, &test)
+    WriteField_U16(task_next, task_mse, test, &test)
+
+    next_test = test + 1;
+    WriteSelfField_U16(task_next, test, &next_test)
+
+    StartTask(task_layer)
+}
+
+
+#ifdef FANN_CHECKPOINT_INTERVAL
+/**
+ * Compute the network for the current test, resuming from the last
+ * checkpoint.
+ */
+void layer(void)
+{
+    fann_type *calc_out;
+    uint16_t test;
+
+    task_runs++;
+
+    ReadField_U16(task_next, task_layer, test, &test)
+    calc_out = fann_run_resumable(ann, input[test], &checkpoint);
+
+    write_fann_field(&GetField(task_layer, task_mse, output), calc_out, 0);
+    StartTask(task_mse)
+}
+#else
+/**
+ * Compute one layer of the network for the current test.
+ */
+void layer(void)
+{
+    fann_type values[NUM_VALUES];
+    fann_type *calc_out;
+    uint16_t test;
+    uint16_t layer;
+    uint16_t next_layer;
+
+    task_runs++;
+
+    ReadSelfField_U16(task_layer, layer, &layer)
+    if (layer == 0) {
+        /* new test */
+        ReadField_U16(task_next, task_layer, test, &test)
+        fann_set_input(ann, input[test]);
+        layer = 1;
+    }
+    else {
+        /* activations of the layers computed so far */
+        read_fann_field(&GetField(task_layer, task_layer, values), values, 1);
+        memcpy(fann_get_values(ann), values, fann_get_total_neurons(ann) * sizeof(fann_type));
+    }
+
+    calc_out = fann_run_layer(ann, layer);
+
+    memcpy(values, fann_get_values(ann), fann_get_total_neurons(ann) * sizeof(fann_type));
+    write_fann_field(&GetField(task_layer, task_layer, values), values, 1);
+
+    if (calc_out == NULL) {
+        next_layer = layer + 1;
+        WriteSelfField_U16(task_layer, layer, &next_layer)
+        StartTask(task_layer)
+        return;
+    }
+
+    write_fann_field(&GetField(task_layer, task_mse, output), calc_out, 0);
+    next_layer = 0;
+    WriteSelfField_U16(task_layer, layer, &next_layer)
+    StartTask(task_mse)
+}
+#endif // FANN_CHECKPOINT_INTERVAL
+
+
+/**
+ * Accumulate the squared error of the current test.
+ */
+void mse(void)
+{
+    fann_type calc_out[NUM_OUTPUT];
+    uint16_t test;
+    float error;
+
+    task_runs++;
+
+    ReadField_U16(task_next, task_mse, test, &test)
+    read_fann_field(&GetField(task_layer, task_mse, output), calc_out, 0);
+    ReadSelfField_F32(task_mse, error, &error)
+
+    /* The MSE of the network itself is volatile, only the squared error of
+     * this test is used. */
+    error += fann_test_output(ann, calc_out, output[test]);
+
+    WriteSelfField_F32(task_mse, error, &error)
+    WriteField_F32(task_mse, task_done, error, &error)
+
+#ifdef DEBUG
+    /* Print results (very expensive operation). */
+    printf("Test %u:\n"
+           "  result = (%f, %f, %f)\n"
+           "expected = (%f, %f, %f)\n\n",
+           test + 1,
+           TO_FLOAT(ann, calc_out[0]), TO_FLOAT(ann, calc_out[1]), TO_FLOAT(ann, calc_out[2]),
+           TO_FLOAT(ann, output[test][0]), TO_FLOAT(ann, output[test][1]), TO_FLOAT(ann, output[test][2]));
+#endif // DEBUG
+
+    /* Report results, sent once per test even if the task is re-executed. */
+    //tester_send_data(test, calc_out, NUM_OUTPUT * sizeof(fann_type));
+
+    StartTask(task_next)
+}
+
+
+/**
+ * Print the MSE of the run and how much work was re-executed.
+ */
+void done(void)
+{
+    uint32_t num_tasks;
+    float error;
+
+    task_runs++;
+
+    ReadField_F32(task_mse, task_done, error, &error)
+
+    /* init, next, layers and mse for every test, last next and done */
+    num_tasks = 1 + (uint32_t) num_data * (LAYER_TASKS(ann) + 2) + 2;
+
+    printf("MSE error on %d test data: %f\n\n", num_data, error / (num_data * NUM_OUTPUT));
+    printf("%u starts, %lu task executions for %lu tasks (%lu re-executed)\n\n",
+           boots, (unsigned long) task_runs, (unsigned long) num_tasks,
+           (unsigned long) (task_runs - num_tasks));
+#ifdef FANN_CHECKPOINT_INTERVAL
+    printf("Checkpoint interval: %u neurons\n\n", checkpoint.interval);
+#endif // FANN_CHECKPOINT_INTERVAL
+
+    tester_notify_end();
+    finished = 1;
+}
+
+
+/**
+ * main_intermittent.c
+ */
+int main(void)
+{
+#ifdef FANN_CHECKPOINT_ADAPTIVE
+    int adapt;
+#endif // FANN_CHECKPOINT_ADAPTIVE
+
+    /* Stop watchdog timer. */
+    WDTCTL = WDTPW | WDTHOLD;
+
+    /* Prepare LED. */
+    PM5CTL0 &= ~LOCKLPM5; // Disable the GPIO power-on default high-impedance mode
+                          // to activate previously configured port settings
+    P1DIR |= BIT0;
+    P1OUT &= ~BIT0;
+
+    boots++;
+
+    /*Power load simulation*/
+    /* You need to use these statements in the beginning your intermittent program*/
+#ifdef AUTORESET
+    tester_autoreset(0, noise_3, 0);
+#endif // AUTORESET
+    tester_notify_start();
+
+#ifdef FANN_CHECKPOINT_ADAPTIVE
+    /* Start the uptime clock. */
+    TA1CTL = TASSEL__SMCLK | MC__CONTINUOUS | TACLR;
+#endif // FANN_CHECKPOINT_ADAPTIVE
+
+    /* The network is volatile, the progress is kept in the fields. */
+    ann = fann_create_from_header();
+    if (!ann) {
+        return -1;
+    }
+
+#ifdef FANN_CHECKPOINT_ADAPTIVE
+    /* Record the previous power cycle, adapt the checkpoint interval. The
+     * costs are measured on the second start (the first with a recorded
+     * cycle) and, if the power fails meanwhile, again after 1, 2, 4...
+     * histories, so that cycles too short for a measurement are not spent
+     * measuring. */
+    adapt = fann_power_history_boot(&history);
+    if (!costs_measured && (adapt || history.count == 1)) {
+        if (measure_wait > 0) {
+            measure_wait--;
+        }
+        else {
+            measure_backoff = measure_backoff ? 2 * measure_backoff : 1;
+            measure_wait = measure_backoff;
+            checkpoint_costs.restart = uptime();
+            if (fann_checkpoint_measure(ann, &checkpoint, input[0], measure_values, &checkpoint_costs) == 0) {
+                costs_measured = 1;
+                adapt = 1;
+            }
+        }
+    }
+    if (adapt && costs_measured) {
+        fann_checkpoint_adapt(ann, &checkpoint, &checkpoint_costs);
+    }
+#endif // FANN_CHECKPOINT_ADAPTIVE
+
+    while (!finished) {
+        Resume()
+    }
+
+    fann_destroy(ann);
+
+    /* Turn on LED: Use for debugging */
+
+    P1OUT |= BIT0;
+
+    return 0;
+}
+
+#endif // INTERMITTENT
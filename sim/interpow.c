@@ -0,0 +1,124 @@
+/*
+ * interpow.c
+ *
+ * Host reimplementation of the InterPow library (utils/libs/interpow.lib is
+ * an MSP430 binary), for the intermittent power simulator. Same interface,
+ * utils/interpow.h:
+ *   - channel fields are read and written in place;
+ *   - a self-field has two buffers: reads use the committed one, writes go to
+ *     the other one and mark the field, the marked fields of the task are
+ *     committed by switching buffers (sf_state) when the task starts the next
+ *     one.
+ * start_task is made atomic with a small non-volatile log, replayed by
+ * resume_program if the power fails in the middle of a switch.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "interpow.h"
+
+/* Self-fields written by the running task (volatile: lost at a reset, the
+ * task is executed again). */
+static uint16_t written;
+
+/* Log of the task switch in progress. */
+#pragma PERSISTENT(switch_from)
+static __task *volatile switch_from = NULL;
+#pragma PERSISTENT(switch_task)
+static __task *volatile switch_task = NULL;
+#pragma PERSISTENT(switch_sf_state)
+static volatile uint16_t switch_sf_state = 0;
+#pragma PERSISTENT(switch_pending)
+static volatile uint8_t switch_pending = 0;
+
+
+static void *self_buffer(__self_field *field, __program_state *state, uint8_t committed)
+{
+    uint8_t second = (state->curr_task->sf_state & field->code) != 0;
+
+    return (second == committed) ? field->base_addr_1 : field->base_addr_0;
+}
+
+static void read_field(void *field, void *dst, size_t size, uint8_t is_self, __program_state *state)
+{
+    if (is_self) {
+        __self_field *self = (__self_field *) field;
+        memcpy(dst, self_buffer(self, state, 1), self->length * size);
+    }
+    else {
+        __field *channel = (__field *) field;
+        memcpy(dst, channel->base_addr, channel->length * size);
+    }
+}
+
+static void write_field(void *field, const void *src, size_t size, uint8_t is_self, __program_state *state)
+{
+    if (is_self) {
+        __self_field *self = (__self_field *) field;
+        memcpy(self_buffer(self, state, 0), src, self->length * size);
+        written |= self->code;
+    }
+    else {
+        __field *channel = (__field *) field;
+        memcpy(channel->base_addr, src, channel->length * size);
+    }
+}
+
+#define READ_WRITE(SUFFIX, TYPE)                                                \
+    void read_field_##SUFFIX(void *field, TYPE *dst, uint8_t is_self,          \
+                             __program_state *state)                            \
+    {                                                                           \
+        read_field(field, dst, sizeof(TYPE), is_self, state);                   \
+    }                                                                           \
+    void write_field_##SUFFIX(void *field, TYPE *src, uint8_t is_self,         \
+                              __program_state *state)                           \
+    {                                                                           \
+        write_field(field, src, sizeof(TYPE), is_self, state);                  \
+    }                                                                           \
+    void write_field_element_##SUFFIX(__field *field, TYPE *src, uint16_t pos)  \
+    {                                                                           \
+        ((TYPE *) field->base_addr)[pos] = *src;                                \
+    }
+
+READ_WRITE(8, int8_t)
+READ_WRITE(u8, uint8_t)
+READ_WRITE(16, int16_t)
+READ_WRITE(u16, uint16_t)
+READ_WRITE(32, int32_t)
+READ_WRITE(u32, uint32_t)
+READ_WRITE(f32, float)
+
+
+/* Apply the logged task switch (idempotent). */
+static void apply_switch(__program_state *state)
+{
+    switch_from->sf_state = switch_sf_state;
+    state->curr_task = switch_task;
+    switch_pending = 0;
+}
+
+void start_task(__task *task, __program_state *state)
+{
+    uint16_t sf_state = state->curr_task->sf_state;
+
+    if (state->curr_task->has_self_channel) {
+        sf_state ^= written;
+    }
+    written = 0;
+
+    switch_from = state->curr_task;
+    switch_task = task;
+    switch_sf_state = sf_state;
+    switch_pending = 1;
+    apply_switch(state);
+}
+
+void resume_program(__program_state *state)
+{
+    if (switch_pending) {
+        apply_switch(state);
+    }
+    written = 0;
+    state->curr_task->task_function();
+}
@@ -0,0 +1,86 @@
+/*
+ * msp430.h
+ *
+ * Host stub of the MSP430FR5994 device header, for the intermittent power
+ * simulator (see sim.c). Only the registers and intrinsics used by the
+ * programs of this repository are provided. Registers are plain variables
+ * defined in sim.c with their reset values: like SRAM, they go back to these
+ * values at every reset.
+ */
+
+#ifndef SIM_MSP430_H_
+#define SIM_MSP430_H_
+
+#include <stdint.h>
+
+/* Watchdog, ports, power management. */
+extern volatile uint16_t WDTCTL, PM5CTL0, PMMCTL0;
+extern volatile uint16_t P1DIR, P1OUT, P2SEL0, P2SEL1;
+
+#define WDTPW                   0x5A00
+#define WDTHOLD                 0x0080
+#define LOCKLPM5                0x0001
+#define PMMPW                   0xA500
+#define PMMSWBOR                0x0004
+
+#define BIT0                    0x0001
+#define BIT1                    0x0002
+#define BIT2                    0x0004
+#define BIT3                    0x0008
+#define BIT4                    0x0010
+#define BIT5                    0x0020
+#define BIT6                    0x0040
+#define BIT7                    0x0080
+
+/* Clock system: DCO at 8 MHz, MCLK and SMCLK divided by 8 after reset. */
+extern volatile uint16_t CSCTL0, CSCTL1, CSCTL2, CSCTL3, CSCTL4;
+
+#define CSKEY                   0xA500
+#define DCOFSEL                 0x000E
+#define DCOFSEL_6               0x000C
+#define DIVM                    0x0007
+#define DIVS                    0x0070
+#define DIVS_3                  0x0030
+#define SMCLKOFF                0x0002
+
+/* Timers A0 (used by tester_autoreset) and A1. TAxR is read through the
+ * simulator, which counts the time. */
+extern volatile uint16_t TA0CTL, TA0CCTL0, TA0CCR0, TA1CTL, TA1CCTL0, TA1CCR0;
+uint16_t sim_timer_count(int timer);
+#define TA0R                    sim_timer_count(0)
+#define TA1R                    sim_timer_count(1)
+
+#define TASSEL__SMCLK           0x0200
+#define MC                      0x0030
+#define MC__UP                  0x0010
+#define MC__CONTINUOUS          0x0020
+#define TACLR                   0x0004
+#define TAIFG                   0x0001
+#define CCIE                    0x0010
+
+/* UART, always ready: the bytes sent are discarded. */
+extern volatile uint16_t UCA1CTLW0, UCA1MCTLW, UCA1BRW, UCA1TXBUF;
+
+#define UCA1IFG                 UCTXIFG
+#define UCSWRST                 0x0001
+#define UCSSEL__SMCLK           0x0080
+#define UCOS16                  0x0001
+#define UCTXIFG                 0x0002
+#define UCTXCPTIFG              0x0008
+
+/* Status register. */
+#define GIE                     0x0008
+
+extern volatile uint16_t sim_sr;
+void sim_delay_cycles(unsigned long cycles);
+
+#define __bis_SR_register(x)    (sim_sr |= (x))
+#define __bic_SR_register(x)    (sim_sr &= ~(x))
+#define __delay_cycles(x)       sim_delay_cycles(x)
+#define __no_operation()        ((void) 0)
+
+/* Interrupt service routines are called by the simulator. */
+#define TIMER0_A0_VECTOR        0
+#define interrupt(vector)       used
+
+#endif /* SIM_MSP430_H_ */
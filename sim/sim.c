@@ -0,0 +1,367 @@
+/*
+ * sim.c
+ *
+ * Intermittent power simulator: runs a program of this repository (main.c or
+ * main_intermittent.c, renamed app_main) on the host, with resets.
+ *
+ * Memory: the variables declared with #pragma PERSISTENT are registered by the
+ * build (see Makefile) and survive the resets, like FRAM; every other global
+ * variable of the program, registers included, goes back to its initial value,
+ * like SRAM. The program is restarted from app_main.
+ *
+ * Time: the program is compiled with -fsanitize-coverage=trace-pc, each basic
+ * block costs a fixed number of MCLK cycles (-c), at the frequency set in
+ * CSCTL3 (8 MHz DCO). This is only approximate: library calls, such as the
+ * soft-float operations of the MSP430, are not counted.
+ *
+ * The delays of the tester handshakes (__delay_cycles) are not counted.
+ *
+ * Resets: the power fails when the on-time of the current cycle, taken from a
+ * trace in microseconds (-t), is over, and when the program resets itself,
+ * e.g. through tester_autoreset: timer A0 is simulated and its interrupt calls
+ * Timer0_A0_ISR, which triggers a software BOR.
+ *
+ * Each schedule starts from a freshly flashed program, with the trace (and the
+ * noise pattern of tester_autoreset) starting at a random position, and is
+ * compared with a reference run without resets.
+ */
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "msp430.h"
+#include "tester.h"
+
+/* Registers, with their reset values. */
+volatile uint16_t WDTCTL = 0x6904, PM5CTL0 = LOCKLPM5, PMMCTL0 = 0x9640;
+volatile uint16_t P1DIR, P1OUT, P2SEL0, P2SEL1;
+volatile uint16_t CSCTL0 = 0x9600, CSCTL1 = 0x000C, CSCTL2 = 0x0033, CSCTL3 = 0x0033, CSCTL4 = 0xCDC9;
+volatile uint16_t TA0CTL, TA0CCTL0, TA0CCR0, TA1CTL, TA1CCTL0, TA1CCR0;
+volatile uint16_t UCA1CTLW0 = UCSWRST, UCA1MCTLW, UCA1BRW, UCA1TXBUF;
+volatile uint16_t sim_sr;
+
+/* Program under simulation. */
+int app_main(void);
+void Timer0_A0_ISR(void);
+extern uint16_t noise_3[NOISE_LEN];
+extern unsigned int noise_idx;
+
+/* Linker symbols delimiting .data and .bss. */
+extern char __data_start[], _end[];
+
+#define MAX_PERSISTENT 256
+
+/* Non-volatile variables, registered before main. */
+static struct {
+    void *addr;
+    unsigned long size;
+} persistent[MAX_PERSISTENT];
+static unsigned int num_persistent;
+
+/* State of the simulator, on the heap so that the resets do not touch it. */
+struct sim_state {
+    /* parameters */
+    unsigned int cycles_per_block;
+    unsigned long max_resets;
+    unsigned int *trace;
+    unsigned int trace_len;
+    unsigned int scale;
+    int resets_enabled;
+
+    /* initial image of .data and .bss */
+    char *image;
+    char *saved;
+
+    /* current run, times in eighths of microsecond (DCO cycles) */
+    jmp_buf reset_point;
+    unsigned int trace_idx;
+    unsigned long long on_time;
+    unsigned long long budget;
+    unsigned long long timer[2];
+    unsigned long long total_time;
+    unsigned long long cycles;
+    unsigned long resets;
+};
+
+static struct sim_state *sim;
+
+
+void sim_persistent(void *addr, unsigned long size)
+{
+    if (num_persistent == MAX_PERSISTENT) {
+        fprintf(stderr, "sim: too many persistent variables\n");
+        exit(2);
+    }
+    persistent[num_persistent].addr = addr;
+    persistent[num_persistent].size = size;
+    num_persistent++;
+}
+
+/* Flash the program: every variable back to its initial value. */
+static void reflash(void)
+{
+    memcpy(__data_start, sim->image, _end - __data_start);
+}
+
+/* Reset: the volatile variables are lost, the persistent ones kept. */
+static void reset(void)
+{
+    unsigned int i;
+    char *saved = sim->saved;
+
+    for (i = 0; i != num_persistent; i++) {
+        memcpy(saved, persistent[i].addr, persistent[i].size);
+        saved += persistent[i].size;
+    }
+    reflash();
+    saved = sim->saved;
+    for (i = 0; i != num_persistent; i++) {
+        memcpy(persistent[i].addr, saved, persistent[i].size);
+        saved += persistent[i].size;
+    }
+}
+
+static void power_failure(void)
+{
+    longjmp(sim->reset_point, 1);
+}
+
+/* Advance the time by the given MCLK cycles. */
+static void advance(unsigned long cycles)
+{
+    struct sim_state *s = sim;
+    unsigned int divm = CSCTL3 & DIVM;
+    unsigned int divs = (CSCTL3 & DIVS) >> 4;
+    unsigned long long time = (unsigned long long) cycles << divm;
+
+    s->cycles += cycles;
+    s->on_time += time;
+
+    /* timer A0, up mode: interrupt at TA0CCR0 */
+    if (TA0CTL & MC) {
+        s->timer[0] += time;
+        if ((s->timer[0] >> divs) >= TA0CCR0 && TA0CCR0 && (TA0CTL & MC) == MC__UP) {
+            s->timer[0] = 0;
+            if ((TA0CCTL0 & CCIE) && (sim_sr & GIE) && s->resets_enabled) {
+                Timer0_A0_ISR();
+                if (PMMCTL0 & PMMSWBOR) {
+                    power_failure();
+                }
+            }
+        }
+    }
+
+    /* timer A1, continuous mode */
+    if (TA1CTL & MC) {
+        s->timer[1] += time;
+        if ((s->timer[1] >> divs) > 0xFFFF) {
+            s->timer[1] -= 0x10000ULL << divs;
+            TA1CTL |= TAIFG;
+        }
+    }
+
+    if (s->budget && s->on_time >= s->budget) {
+        power_failure();
+    }
+}
+
+void __sanitizer_cov_trace_pc(void)
+{
+    /* not counted before the simulation starts (constructors) */
+    if (sim != NULL) {
+        advance(sim->cycles_per_block);
+    }
+}
+
+/* The delays of the programs are the handshakes with the tester (100 ms at
+ * start, 10 ms per UART transfer), done with the autoreset timer halted: they
+ * are not part of the simulated time. */
+void sim_delay_cycles(unsigned long cycles)
+{
+    (void) cycles;
+}
+
+uint16_t sim_timer_count(int timer)
+{
+    return (uint16_t) (sim->timer[timer] >> ((CSCTL3 & DIVS) >> 4));
+}
+
+/* Start a power cycle. */
+static void power_on(void)
+{
+    struct sim_state *s = sim;
+
+    s->on_time = 0;
+    s->timer[0] = 0;
+    s->timer[1] = 0;
+    s->budget = 0;
+    if (s->resets_enabled && s->trace_len) {
+        s->budget = (unsigned long long) s->trace[s->trace_idx] * 8 * s->scale / 100;
+        if (s->budget == 0) {
+            s->budget = 1;
+        }
+        s->trace_idx = (s->trace_idx + 1) % s->trace_len;
+    }
+}
+
+/* Run the program from a fresh flash until it returns; 0 if it does not
+ * complete within max_resets resets. */
+static int run(unsigned int start)
+{
+    struct sim_state *s = sim;
+
+    reflash();
+    s->total_time = 0;
+    s->cycles = 0;
+    s->resets = 0;
+    s->trace_idx = s->trace_len ? start % s->trace_len : 0;
+    noise_idx = start % NOISE_LEN;
+
+    if (setjmp(s->reset_point)) {
+        s->total_time += s->on_time;
+        if (++s->resets > s->max_resets) {
+            return 0;
+        }
+        reset();
+    }
+    power_on();
+    app_main();
+    s->total_time += s->on_time;
+    return 1;
+}
+
+static unsigned int *read_trace(const char *name, unsigned int *len)
+{
+    unsigned int *trace = NULL;
+    unsigned int value, n = 0;
+    FILE *file;
+
+    if (strcmp(name, "noise_3") == 0) {
+        trace = malloc(NOISE_LEN * sizeof(unsigned int));
+        for (n = 0; n != NOISE_LEN; n++) {
+            trace[n] = noise_3[n];
+        }
+        *len = NOISE_LEN;
+        return trace;
+    }
+    file = fopen(name, "r");
+    if (file == NULL) {
+        return NULL;
+    }
+    while (fscanf(file, "%u%*[^0-9]", &value) == 1) {
+        trace = realloc(trace, (n + 1) * sizeof(unsigned int));
+        trace[n++] = value;
+    }
+    fclose(file);
+    *len = n;
+    return trace;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s [-t trace] [-n schedules] [-s seed] [-c cycles] [-x scale] [-r resets] [-q]\n"
+            "  -t trace      on-times in microseconds: noise_3 or a file (default: only\n"
+            "                the resets of the program, e.g. tester_autoreset)\n"
+            "  -n schedules  number of reset schedules to run (default 1)\n"
+            "  -s seed       seed of the start positions in the traces (default 1)\n"
+            "  -c cycles     MCLK cycles per basic block (default 8)\n"
+            "  -x scale      scale of the on-times, in percent (default 100)\n"
+            "  -r resets     resets after which a schedule is aborted (default 100000)\n"
+            "  -q            discard the output of the program\n",
+            name);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    struct sim_state *s;
+    unsigned long long reference, min_time = ~0ULL, max_time = 0, sum_time = 0;
+    unsigned long sum_resets = 0;
+    unsigned int schedule, schedules = 1, completed = 0, seed = 1;
+    unsigned long size;
+    int opt, quiet = 0;
+    const char *trace = NULL;
+
+    s = calloc(1, sizeof(struct sim_state));
+    s->cycles_per_block = 8;
+    s->max_resets = 100000;
+    s->scale = 100;
+
+    while ((opt = getopt(argc, argv, "t:n:s:c:x:r:q")) != -1) {
+        switch (opt) {
+        case 't': trace = optarg; break;
+        case 'n': schedules = atoi(optarg); break;
+        case 's': seed = atoi(optarg); break;
+        case 'c': s->cycles_per_block = atoi(optarg); break;
+        case 'x': s->scale = atoi(optarg); break;
+        case 'r': s->max_resets = atol(optarg); break;
+        case 'q': quiet = 1; break;
+        default: usage(argv[0]);
+        }
+    }
+    if (trace != NULL) {
+        s->trace = read_trace(trace, &s->trace_len);
+        if (s->trace == NULL || s->trace_len == 0) {
+            fprintf(stderr, "%s: no such trace\n", trace);
+            return 2;
+        }
+    }
+    if (quiet) {
+        fflush(stdout);
+        dup2(open("/dev/null", O_WRONLY), STDOUT_FILENO);
+    }
+
+    /* initial image, taken before the program runs */
+    sim = s;
+    size = 0;
+    for (opt = 0; opt != (int) num_persistent; opt++) {
+        size += persistent[opt].size;
+    }
+    s->saved = malloc(size);
+    s->image = malloc(_end - __data_start);
+    memcpy(s->image, __data_start, _end - __data_start);
+
+    /* reference run, without resets */
+    s->resets_enabled = 0;
+    run(0);
+    fflush(stdout);
+    reference = s->total_time;
+    fprintf(stderr, "reference: %.3f ms, %llu cycles, %u persistent variables\n",
+            reference / 8000.0, s->cycles, num_persistent);
+
+    s->resets_enabled = 1;
+    srand(seed);
+    for (schedule = 0; schedule != schedules; schedule++) {
+        if (!run(rand())) {
+            fflush(stdout);
+            fprintf(stderr, "schedule %u: no completion after %lu resets\n", schedule, s->max_resets);
+            continue;
+        }
+        fflush(stdout);
+        fprintf(stderr, "schedule %u: %.3f ms, %lu resets, %+.1f%% over the reference\n",
+                schedule, s->total_time / 8000.0, s->resets,
+                100.0 * ((double) s->total_time - reference) / reference);
+        completed++;
+        sum_time += s->total_time;
+        sum_resets += s->resets;
+        if (s->total_time < min_time) min_time = s->total_time;
+        if (s->total_time > max_time) max_time = s->total_time;
+    }
+
+    if (completed) {
+        fprintf(stderr, "%u/%u schedules completed: %.3f/%.3f/%.3f ms (min/avg/max), "
+                "%.1f resets, %+.1f%% over the reference on average\n",
+                completed, schedules, min_time / 8000.0, sum_time / 8000.0 / completed,
+                max_time / 8000.0, (double) sum_resets / completed,
+                100.0 * ((double) sum_time / completed - reference) / reference);
+    }
+    else {
+        fprintf(stderr, "0/%u schedules completed\n", schedules);
+    }
+    return completed == schedules ? 0 : 1;
+}
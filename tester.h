@@ -16,7 +16,9 @@
 #include <msp430.h>
 #include <stdint.h>
 
-#ifdef FIXEDFANN
+#if defined(FANN_Q15)
+typedef int16_t fann_type;
+#elif defined(FIXEDFANN)
 typedef long fann_type;
 #else
 typedef float fann_type;
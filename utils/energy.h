@@ -0,0 +1,95 @@
+/*
+ * energy.h
+ *
+ * Energy accounting: counters of the operations of the inference that cost
+ * energy (FRAM and SRAM accesses to the network, multiply-accumulates,
+ * activation functions, checkpoint commits), compiled in with ENERGY, and
+ * their conversion to an estimated energy with a table of costs per
+ * operation.
+ *
+ * The counters are incremented by the engines of fann_run with the number of
+ * operations of each layer, so they are exact on any target, the host
+ * included: compare engine variants with them. The energy is an estimate:
+ * adjust the costs to measurements of the board.
+ */
+
+#ifndef ENERGY_H_
+#define ENERGY_H_
+
+#include <stdint.h>
+
+
+/**
+ * Operation counters.
+ */
+struct energy_counters {
+    uint32_t fram_reads;    /* accesses to a fann_type (or column index) */
+    uint32_t fram_writes;
+    uint32_t sram_reads;
+    uint32_t sram_writes;
+    uint32_t multiplies;    /* multiply-accumulates of the dot products */
+    uint32_t activations;   /* activation functions of the neurons */
+    uint32_t commits;       /* checkpoint commits */
+};
+
+
+/**
+ * Energy of each operation, in nJ. Multiplies and activations include the
+ * cycles of the arithmetic of the number format.
+ */
+struct energy_costs {
+    float fram_read;
+    float fram_write;
+    float sram_read;
+    float sram_write;
+    float multiply;
+    float activation;
+    float commit;
+};
+
+
+/**
+ * Counters of the operations since the last energy_reset.
+ */
+extern struct energy_counters energy;
+
+
+/**
+ * Costs used by energy_report, set for the number format of the build
+ * (MSP430FR5994 at 8 MHz and 3 V): change them to calibrate the estimate.
+ */
+extern struct energy_costs energy_costs;
+
+
+#ifdef ENERGY
+#define energy_count(counter, n) (energy.counter += (n))
+#else
+#define energy_count(counter, n)
+#endif // ENERGY
+
+
+/**
+ * Clear the counters.
+ */
+void energy_reset(void);
+
+
+/**
+ * Estimated energy of the operations counted.
+ *
+ * @param counters operations.
+ * @param costs energy of each operation.
+ * @return energy in nJ.
+ */
+float energy_estimate(const struct energy_counters *counters, const struct energy_costs *costs);
+
+
+/**
+ * Print the operations counted and their energy, in total and per test.
+ *
+ * @param tests number of tests run since the last energy_reset.
+ */
+void energy_report(unsigned int tests);
+
+
+#endif /* ENERGY_H_ */
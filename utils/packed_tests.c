@@ -0,0 +1,41 @@
+/*
+ * packed_tests.c
+ *
+ * Packed test sets, see packed_tests.h.
+ */
+
+#include "packed_tests.h"
+
+void packed_test_read(const struct packed_tests *tests, uint16_t i, fann_type *input, fann_type *output)
+{
+    packed_address record = tests->records + (packed_address) i * tests->record_words * sizeof(uint16_t);
+    packed_address quantized = record + tests->flag_words * sizeof(uint16_t);
+    uint16_t flags[PACKED_MAX_FLAG_WORDS];
+    uint16_t k, q, cls;
+    int16_t column;
+
+    for (k = 0; k < tests->flag_words; k++) {
+        flags[k] = packed_read_word(record + k * sizeof(uint16_t));
+    }
+
+    for (k = 0; k < tests->num_input; k++) {
+        column = tests->columns[k];
+        if (column >= 0) {
+            input[k] = ((flags[column >> 4] >> (column & 15)) & 1) ? tests->one : 0;
+        } else {
+            column = -1 - column;
+            q = packed_read_word(quantized + column * sizeof(uint16_t));
+#ifdef FIXEDFANN
+            input[k] = tests->minimum[column] +
+                       (fann_type) (((uint32_t) q * (uint16_t) tests->scale[column] + 0x8000) >> 16);
+#else
+            input[k] = tests->minimum[column] + q * tests->scale[column];
+#endif // FIXEDFANN
+        }
+    }
+
+    cls = (flags[tests->class_bit >> 4] >> (tests->class_bit & 15)) & tests->class_mask;
+    for (k = 0; k < tests->num_output; k++) {
+        output[k] = (k == cls) ? tests->high : tests->low;
+    }
+}
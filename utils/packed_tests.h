@@ -0,0 +1,81 @@
+/*
+ * packed_tests.h
+ *
+ * Test sets in a packed binary format, generated by database/convert,
+ * and read one test at a time for fann_test: the whole test set fits in
+ * FRAM2 instead of taking fann_type arrays in FRAM.
+ *
+ * A test is a record of 16-bit words: the inputs that are always 0 or 1 and
+ * the class of the test (the index of the high one-hot output) are bit-packed
+ * in the leading words, the other inputs are quantized to a word each,
+ * between the minimum and the maximum of the input over the test set.
+ *
+ * With the restricted (or small) data model of the TI compiler, pointers are
+ * 16-bit: the records, above 64 KB, are read with 20-bit addresses.
+ */
+
+#ifndef PACKED_TESTS_H_
+#define PACKED_TESTS_H_
+
+#include <stdint.h>
+
+#include "fann.h"
+
+#if defined(__TI_COMPILER_VERSION__) && !defined(__LARGE_DATA_MODEL__)
+#include <msp430.h>
+
+typedef unsigned long packed_address;
+#define packed_address_of(records) _symval(&(records))
+#define packed_read_word(address) __data20_read_short(address)
+#else
+typedef uintptr_t packed_address;
+#define packed_address_of(records) ((packed_address) (records))
+#define packed_read_word(address) (*(const uint16_t *) (address))
+#endif
+
+/* Leading words of a record read at once. */
+#define PACKED_MAX_FLAG_WORDS 8
+
+
+/**
+ * Packed test set.
+ */
+struct packed_tests {
+    packed_address records;     /* set with packed_tests_open */
+    uint16_t num_data;
+    uint16_t num_input;
+    uint16_t num_output;
+    uint16_t record_words;      /* words of a record */
+    uint16_t flag_words;        /* leading words of the binary inputs and the class */
+    uint16_t class_bit;         /* first bit of the class in the leading words */
+    uint16_t class_mask;
+    const int16_t *columns;     /* per input: bit of a binary input, or -1 - index of a quantized one */
+    const fann_type *minimum;   /* per quantized input */
+    const fann_type *scale;     /* per quantized input: step (float) or range (fixed point) */
+    fann_type one;              /* value of a binary input set */
+    fann_type low;              /* values of the outputs */
+    fann_type high;
+};
+
+
+/**
+ * Locate the records of a test set.
+ *
+ * @param tests test set generated by convert (<name>_tests).
+ * @param array records of the test set (<name>_packed_records).
+ */
+#define packed_tests_open(tests, array) ((tests)->records = packed_address_of(array))
+
+
+/**
+ * Read a test.
+ *
+ * @param tests test set, opened.
+ * @param i index of the test.
+ * @param input inputs of the test, num_input values.
+ * @param output expected outputs of the test, num_output values.
+ */
+void packed_test_read(const struct packed_tests *tests, uint16_t i, fann_type *input, fann_type *output);
+
+
+#endif /* PACKED_TESTS_H_ */
@@ -0,0 +1,197 @@
+/*
+ * profiler.c
+ *
+ * Cycle counting and region profiling, see profiler.h.
+ */
+
+#include <stdio.h>
+
+#include "profiler.h"
+
+#ifndef __MSP430__
+#include <time.h>
+#endif // __MSP430__
+
+uint32_t cycle_count;
+
+/* Start of profiler_start. */
+static struct profiler_region profiler_total = PROFILER_REGION_INIT("total");
+
+/* Regions entered so far, in order, for profiler_report. */
+static struct profiler_region *regions = 0;
+static struct profiler_region **regions_end = &regions;
+
+/* Cycles between two readings of the time, and of the overflow interrupt of
+ * the timer (entry, TA2IV, count, return), subtracted from the measurements. */
+static uint32_t overhead;
+static uint16_t isr_cycles = 0;
+static uint16_t initialised = 0;
+
+#ifdef __MSP430__
+/* Overflows of timer A2, the upper 16 bits of the time. */
+static volatile uint16_t overflows;
+
+/**
+ * Time in cycles.
+ */
+static uint32_t profiler_now(void)
+{
+    unsigned short interrupt_state = __get_interrupt_state();
+    uint16_t high, low;
+
+    __disable_interrupt();
+    low = TA2R;
+    high = overflows;
+    /* overflow not served yet */
+    if ((TA2CTL & TAIFG) && low < 0x8000) {
+        high++;
+    }
+    __set_interrupt_state(interrupt_state);
+
+    return ((uint32_t) high << 16) | low;
+}
+
+static void profiler_init(void)
+{
+    uint16_t start, without, with;
+
+    TA2CTL = TASSEL__SMCLK | MC__CONTINUOUS | TACLR | TAIE;
+
+    /* cost of the overflow interrupt: the flag set by software requests it
+     * (served only if the caller has enabled the interrupts), the same
+     * readings around an instruction clearing the flag are the reference */
+    start = TA2R;
+    TA2CTL &= ~TAIFG;
+    without = TA2R - start;
+    start = TA2R;
+    TA2CTL |= TAIFG;
+    with = TA2R - start;
+    isr_cycles = (with > without) ? with - without : 0;
+
+    /* that was not an overflow */
+    TA2CTL &= ~TAIFG;
+    TA2CTL |= TACLR;
+    overflows = 0;
+}
+
+// Timer2_A1 interrupt service routine (overflow)
+#if defined(__TI_COMPILER_VERSION__) || defined(__IAR_SYSTEMS_ICC__)
+#pragma vector = TIMER2_A1_VECTOR
+__interrupt void Timer2_A1_ISR (void)
+#elif defined(__GNUC__)
+void __attribute__ ((interrupt(TIMER2_A1_VECTOR))) Timer2_A1_ISR (void)
+#else
+#error Compiler not supported!
+#endif
+{
+    switch (__even_in_range(TA2IV, TAIV__TAIFG)) {
+    case TAIV__TAIFG:
+        overflows++;
+        break;
+    default:
+        break;
+    }
+}
+#else
+static uint16_t overflows = 0;
+
+/**
+ * Time in nanoseconds.
+ */
+static uint32_t profiler_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) (now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+static void profiler_init(void)
+{
+}
+#endif // __MSP430__
+
+/**
+ * Cycles since the entry of a region, without the interrupts of the timer
+ * and the readings of the time.
+ */
+static uint32_t profiler_elapsed(const struct profiler_region *region)
+{
+    uint32_t elapsed = profiler_now() - region->start;
+    uint32_t subtracted = (uint16_t) (overflows - region->overflows) * (uint32_t) isr_cycles + overhead;
+
+    return (elapsed > subtracted) ? elapsed - subtracted : 0;
+}
+
+void profiler_enter(struct profiler_region *region)
+{
+    uint32_t start;
+
+    if (!initialised) {
+        initialised = 1;
+        profiler_init();
+        start = profiler_now();
+        overhead = profiler_now() - start;
+    }
+    if (!region->registered) {
+        region->registered = 1;
+        *regions_end = region;
+        regions_end = &region->next;
+    }
+    region->overflows = overflows;
+    region->start = profiler_now();
+}
+
+void profiler_leave(struct profiler_region *region)
+{
+    uint32_t elapsed = profiler_elapsed(region);
+
+    region->calls++;
+    region->total += elapsed;
+    if (elapsed < region->min) {
+        region->min = elapsed;
+    }
+    if (elapsed > region->max) {
+        region->max = elapsed;
+    }
+}
+
+void profiler_start()
+{
+    profiler_enter(&profiler_total);
+}
+
+uint32_t profiler_stop()
+{
+    cycle_count = profiler_elapsed(&profiler_total);
+    return cycle_count;
+}
+
+void profiler_reset(void)
+{
+    struct profiler_region *region;
+
+    for (region = regions; region; region = region->next) {
+        region->calls = 0;
+        region->total = 0;
+        region->min = UINT32_MAX;
+        region->max = 0;
+    }
+}
+
+void profiler_report(void)
+{
+    struct profiler_region *region;
+
+    printf("%-16s %8s %12s %10s %10s %10s\n", "region", "calls", PROFILER_UNIT, "min", "max", "average");
+    for (region = regions; region; region = region->next) {
+        if (region == &profiler_total || region->calls == 0) {
+            continue;
+        }
+        printf("%-16s %8lu %12lu %10lu %10lu %10lu\n", region->name,
+               (unsigned long) region->calls, (unsigned long) region->total,
+               (unsigned long) region->min, (unsigned long) region->max,
+               (unsigned long) (region->total / region->calls));
+    }
+    printf("\n");
+}
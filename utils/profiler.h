@@ -6,6 +6,19 @@
  * NOTE: the time spent inside Timer interrupts is accurately subtracted
  *       from the final measurement.
  *
+ * On the MSP430, cycles are counted with timer A2 on SMCLK, which must run
+ * at the MCLK frequency (as after a reset, or with tester_autoreset); its
+ * overflow interrupt extends the count to 32 bits. The interrupts are left to
+ * the caller: enable them (GIE) before the first profiler_start or
+ * profiler_enter, which measures the cost of that interrupt. On other targets
+ * (Linux), the time is counted in nanoseconds, with clock_gettime.
+ * PROFILER_UNIT and PROFILER_PER_MS give the unit of the counts.
+ *
+ * Besides profiler_start/profiler_stop, named regions can be profiled: a
+ * region is entered and left any number of times, and regions can be nested
+ * or overlap. The time of a region includes the profiling of the regions
+ * inside it.
+ *
  * Created on: Nov 1, 2017
  *     Author: Carlo Delle Donne
  */
@@ -13,10 +26,53 @@
 #ifndef PROFILER_H_
 #define PROFILER_H_
 
+#ifdef __MSP430__
 #include <msp430.h>
+#endif
 #include <stdint.h>
 
 
+/**
+ * Unit of the counts, and counts per millisecond (PROFILER_MCLK_KHZ, the
+ * MCLK frequency in kHz, on the MSP430).
+ */
+#ifdef __MSP430__
+#ifndef PROFILER_MCLK_KHZ
+#define PROFILER_MCLK_KHZ 8000
+#endif
+#define PROFILER_UNIT "cycles"
+#define PROFILER_PER_MS PROFILER_MCLK_KHZ
+#else
+#define PROFILER_UNIT "ns"
+#define PROFILER_PER_MS 1000000
+#endif // __MSP430__
+
+
+/**
+ * Profiled region: declare it with PROFILER_REGION, statically.
+ */
+struct profiler_region {
+    const char *name;
+    uint32_t calls;         /* times the region was left */
+    uint32_t total;         /* cycles, over all calls */
+    uint32_t min;
+    uint32_t max;
+    uint32_t start;         /* time of the current entry */
+    uint16_t overflows;     /* timer overflows at the current entry */
+    uint16_t registered;
+    struct profiler_region *next;
+};
+
+#define PROFILER_REGION_INIT(name) { (name), 0, 0, UINT32_MAX, 0, 0, 0, 0, 0 }
+#define PROFILER_REGION(var, name) struct profiler_region var = PROFILER_REGION_INIT(name)
+
+
+/**
+ * Cycles counted by the last profiler_stop.
+ */
+extern uint32_t cycle_count;
+
+
 /**
  * Start counting cycles.
  */
@@ -31,4 +87,32 @@ void profiler_start();
 uint32_t profiler_stop();
 
 
+/**
+ * Enter a region.
+ *
+ * @param region region, not entered yet.
+ */
+void profiler_enter(struct profiler_region *region);
+
+
+/**
+ * Leave a region, adding the cycles since profiler_enter to its statistics.
+ *
+ * @param region region entered.
+ */
+void profiler_leave(struct profiler_region *region);
+
+
+/**
+ * Clear the statistics of all the regions entered so far.
+ */
+void profiler_reset(void);
+
+
+/**
+ * Print the statistics of all the regions entered so far.
+ */
+void profiler_report(void);
+
+
 #endif /* PROFILER_H_ */